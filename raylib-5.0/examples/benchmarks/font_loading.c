@@ -0,0 +1,83 @@
+/*******************************************************************************************
+*
+*   raylib benchmark - font loading
+*
+*   Measures LoadFontData() glyphs rasterization, shared by worker pool threads
+*   (SUPPORT_WORKER_THREADS), and GenImageFontAtlas() single pass packing
+*
+*   Usage: font_loading <font.ttf> [fontSize] [glyphCount] [iterations]
+*   NOTE: Glyphs are requested consecutively starting at codepoint 32 (Space),
+*   use a CJK font and a big glyph count to measure large fonts loading
+*
+*   Copyright (c) 2014-2023 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>              // Required for: printf()
+#include <stdlib.h>             // Required for: atoi()
+#include <time.h>               // Required for: clock_gettime()
+
+// Get monotonic time in seconds
+// NOTE: GetTime() requires an initialized window
+static double GetBenchmarkTime(void)
+{
+    struct timespec time = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return (double)time.tv_sec + (double)time.tv_nsec*1e-9;
+}
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        printf("Usage: %s <font.ttf> [fontSize] [glyphCount] [iterations]\n", argv[0]);
+        return 1;
+    }
+
+    const char *fileName = argv[1];
+    int fontSize = (argc > 2)? atoi(argv[2]) : 75;
+    int glyphCount = (argc > 3)? atoi(argv[3]) : 3000;
+    int iterations = (argc > 4)? atoi(argv[4]) : 5;
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    if (fileData == NULL) return 1;
+
+    double rasterTime = 0.0;
+    double packTime = 0.0;
+
+    for (int i = 0; i < iterations; i++)
+    {
+        double startTime = GetBenchmarkTime();
+        GlyphInfo *glyphs = LoadFontData(fileData, dataSize, fontSize, NULL, glyphCount, FONT_DEFAULT);
+        rasterTime += GetBenchmarkTime() - startTime;
+
+        if (glyphs == NULL) break;
+
+        Rectangle *recs = NULL;
+        startTime = GetBenchmarkTime();
+        Image atlas = GenImageFontAtlas(glyphs, &recs, glyphCount, fontSize, 4, 0);
+        packTime += GetBenchmarkTime() - startTime;
+
+        UnloadImage(atlas);
+        MemFree(recs);
+        UnloadFontData(glyphs, glyphCount);
+    }
+
+    UnloadFileData(fileData);
+
+    printf("Font: %s, size: %i, glyphs: %i, iterations: %i\n", GetFileName(fileName), fontSize, glyphCount, iterations);
+    printf("  LoadFontData():      %8.2f ms  (%.0f glyphs/s)\n", rasterTime*1000.0/iterations, glyphCount*iterations/rasterTime);
+    printf("  GenImageFontAtlas(): %8.2f ms\n", packTime*1000.0/iterations);
+    printf("  Total:               %8.2f ms\n", (rasterTime + packTime)*1000.0/iterations);
+
+    return 0;
+}
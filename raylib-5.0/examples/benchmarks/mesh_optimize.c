@@ -0,0 +1,220 @@
+/*******************************************************************************************
+*
+*   raylib benchmark - mesh optimize
+*
+*   Measures OptimizeMesh() effect on drawing: average cache miss ratio (ACMR, simulated
+*   FIFO post-transform cache) and GPU draw time for the same mesh before and after optimization
+*
+*   Usage: mesh_optimize [model.obj|model.glb] [frames]
+*   NOTE: A generated sphere with shuffled triangles is used if no model is provided,
+*   draw time is measured rendering to texture, waiting GPU with a pixels readback
+*
+*   Copyright (c) 2014-2023 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"
+
+#include <stdio.h>              // Required for: printf()
+#include <stdlib.h>             // Required for: atoi(), rand(), srand()
+#include <string.h>             // Required for: memcpy()
+#include <math.h>               // Required for: fmaxf()
+
+#define RENDER_SIZE              1024
+#define DRAWS_PER_FRAME            20
+#define VERTEX_CACHE_SIZE          32       // Same as MESH_VERTEX_CACHE_SIZE (rmodels.c)
+#define MESH_VERTEX_BUFFERS         9       // Same as MAX_MESH_VERTEX_BUFFERS (config.h)
+
+//------------------------------------------------------------------------------------
+// Module functions declaration
+//------------------------------------------------------------------------------------
+static Model LoadModelSource(const char *fileName);             // Load model from file or generate it (shuffled triangles sphere)
+static float GetModelACMR(Model model);                         // Get model average cache miss ratio (FIFO cache)
+static double GetModelDrawTime(Model model, RenderTexture2D target, int frames);    // Get model draw time by frame (seconds)
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    const char *fileName = (argc > 1)? argv[1] : NULL;
+    int frames = (argc > 2)? atoi(argv[2]) : 50;
+
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    SetTraceLogLevel(LOG_WARNING);
+    InitWindow(320, 240, "raylib benchmark - mesh optimize");
+
+    RenderTexture2D target = LoadRenderTexture(RENDER_SIZE, RENDER_SIZE);
+
+    // NOTE: Same model loaded twice, one copy is optimized before uploading to GPU
+    Model source = LoadModelSource(fileName);
+    Model optimized = LoadModelSource(fileName);
+
+    if ((source.meshCount == 0) || (optimized.meshCount == 0))
+    {
+        printf("Model not available\n");
+        CloseWindow();
+        return 1;
+    }
+
+    int sourceVertexCount = 0;
+    int triangleCount = 0;
+    for (int i = 0; i < source.meshCount; i++)
+    {
+        sourceVertexCount += source.meshes[i].vertexCount;
+        triangleCount += source.meshes[i].triangleCount;
+    }
+
+    double startTime = GetTime();
+    for (int i = 0; i < optimized.meshCount; i++) OptimizeMesh(&optimized.meshes[i]);
+    double optimizeTime = GetTime() - startTime;
+
+    int optimizedVertexCount = 0;
+    for (int i = 0; i < optimized.meshCount; i++) optimizedVertexCount += optimized.meshes[i].vertexCount;
+
+    float sourceAcmr = GetModelACMR(source);
+    float optimizedAcmr = GetModelACMR(optimized);
+
+    for (int i = 0; i < source.meshCount; i++) UploadMesh(&source.meshes[i], false);
+    for (int i = 0; i < optimized.meshCount; i++) UploadMesh(&optimized.meshes[i], false);
+
+    // Warm up: shaders and buffers first use
+    GetModelDrawTime(source, target, 2);
+    GetModelDrawTime(optimized, target, 2);
+
+    double sourceTime = GetModelDrawTime(source, target, frames);
+    double optimizedTime = GetModelDrawTime(optimized, target, frames);
+
+    printf("Model: %s, meshes: %i, triangles: %i, frames: %i (%i draws/frame, %ix%i)\n", (fileName != NULL)? GetFileName(fileName) : "generated",
+        source.meshCount, triangleCount, frames, DRAWS_PER_FRAME, RENDER_SIZE, RENDER_SIZE);
+    printf("  OptimizeMesh(): %.2f ms\n", optimizeTime*1000.0);
+    printf("  Source:    vertices: %7i  ACMR: %.3f  draw: %8.3f ms/frame\n", sourceVertexCount, sourceAcmr, sourceTime*1000.0);
+    printf("  Optimized: vertices: %7i  ACMR: %.3f  draw: %8.3f ms/frame\n", optimizedVertexCount, optimizedAcmr, optimizedTime*1000.0);
+
+    UnloadModel(optimized);
+    UnloadModel(source);
+    UnloadRenderTexture(target);
+
+    CloseWindow();
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module functions definition
+//------------------------------------------------------------------------------------
+// Load model from file or generate it (shuffled triangles sphere)
+// NOTE: Meshes GPU buffers are unloaded, OptimizeMesh() must be called before UploadMesh()
+static Model LoadModelSource(const char *fileName)
+{
+    Model model = { 0 };
+
+    if (fileName != NULL) model = LoadModel(fileName);
+    else
+    {
+        // Unindexed sphere with triangles in random order (worst case for vertex cache)
+        Mesh mesh = GenMeshSphere(1.0f, 160, 160);
+
+        srand(1);
+        for (int i = mesh.triangleCount - 1; i > 0; i--)
+        {
+            int j = rand()%(i + 1);
+            float temp[9] = { 0 };
+
+            memcpy(temp, mesh.vertices + i*9, 9*sizeof(float));
+            memcpy(mesh.vertices + i*9, mesh.vertices + j*9, 9*sizeof(float));
+            memcpy(mesh.vertices + j*9, temp, 9*sizeof(float));
+            memcpy(temp, mesh.normals + i*9, 9*sizeof(float));
+            memcpy(mesh.normals + i*9, mesh.normals + j*9, 9*sizeof(float));
+            memcpy(mesh.normals + j*9, temp, 9*sizeof(float));
+            memcpy(temp, mesh.texcoords + i*6, 6*sizeof(float));
+            memcpy(mesh.texcoords + i*6, mesh.texcoords + j*6, 6*sizeof(float));
+            memcpy(mesh.texcoords + j*6, temp, 6*sizeof(float));
+        }
+
+        model = LoadModelFromMesh(mesh);
+    }
+
+    // Mesh data is kept in CPU, GPU buffers are generated again on UploadMesh()
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        Mesh *mesh = &model.meshes[i];
+
+        for (int k = 0; k < MESH_VERTEX_BUFFERS; k++) rlUnloadVertexBuffer(mesh->vboId[k]);
+        rlUnloadVertexArray(mesh->vaoId);
+        MemFree(mesh->vboId);
+
+        mesh->vaoId = 0;
+        mesh->vboId = NULL;
+    }
+
+    return model;
+}
+
+// Get model average cache miss ratio (ACMR), vertex shader invocations by triangle
+// NOTE: A FIFO post-transform cache of VERTEX_CACHE_SIZE entries is simulated, lower is better (0.5 is ideal)
+static float GetModelACMR(Model model)
+{
+    int missCount = 0;
+    int triangleCount = 0;
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        Mesh mesh = model.meshes[i];
+        unsigned int *cacheTime = (unsigned int *)MemAlloc(mesh.vertexCount*sizeof(unsigned int));
+        unsigned int time = VERTEX_CACHE_SIZE + 1;
+
+        for (int k = 0; k < mesh.triangleCount*3; k++)
+        {
+            int index = (mesh.indices != NULL)? mesh.indices[k] : k;
+
+            // Vertex in cache if inserted in the last VERTEX_CACHE_SIZE misses
+            if ((time - cacheTime[index]) > VERTEX_CACHE_SIZE)
+            {
+                cacheTime[index] = time++;
+                missCount++;
+            }
+        }
+
+        triangleCount += mesh.triangleCount;
+        MemFree(cacheTime);
+    }
+
+    return (triangleCount > 0)? (float)missCount/triangleCount : 0.0f;
+}
+
+// Get model draw time by frame (seconds)
+// NOTE: Model is drawn DRAWS_PER_FRAME times by frame, GPU work is waited reading back target pixels
+static double GetModelDrawTime(Model model, RenderTexture2D target, int frames)
+{
+    BoundingBox bounds = GetModelBoundingBox(model);
+    Vector3 center = { (bounds.min.x + bounds.max.x)/2.0f, (bounds.min.y + bounds.max.y)/2.0f, (bounds.min.z + bounds.max.z)/2.0f };
+    float size = fmaxf(bounds.max.x - bounds.min.x, fmaxf(bounds.max.y - bounds.min.y, bounds.max.z - bounds.min.z));
+
+    Camera camera = { 0 };
+    camera.position = (Vector3){ center.x + size, center.y + size*0.5f, center.z + size };
+    camera.target = center;
+    camera.up = (Vector3){ 0.0f, 1.0f, 0.0f };
+    camera.fovy = 45.0f;
+    camera.projection = CAMERA_PERSPECTIVE;
+
+    double startTime = GetTime();
+
+    for (int f = 0; f < frames; f++)
+    {
+        BeginTextureMode(target);
+            ClearBackground(RAYWHITE);
+
+            BeginMode3D(camera);
+                for (int i = 0; i < DRAWS_PER_FRAME; i++) DrawModel(model, (Vector3){ 0.0f, 0.0f, 0.0f }, 1.0f, WHITE);
+            EndMode3D();
+        EndTextureMode();
+    }
+
+    Image image = LoadImageFromTexture(target.texture);
+    double drawTime = GetTime() - startTime;
+    UnloadImage(image);
+
+    return drawTime/frames;
+}
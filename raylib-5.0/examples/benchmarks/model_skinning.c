@@ -0,0 +1,168 @@
+/*******************************************************************************************
+*
+*   raylib benchmark - model skinning
+*
+*   Measures animated model skinning: UpdateModelAnimationVertices() skins all meshes on CPU
+*   (vertex blocks shared by worker pool threads), UpdateModelAnimation() uses GPU skinning
+*   for meshes supported by skinning shader (SUPPORT_GPU_SKINNING) and CPU skinning otherwise
+*
+*   Usage: model_skinning [model.iqm|model.glb] [frames]
+*   NOTE: A generated mesh (1M vertices, 32 bones) is used if no animated model is provided
+*
+*   Copyright (c) 2014-2023 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "raymath.h"
+
+#include <stdio.h>              // Required for: printf()
+#include <stdlib.h>             // Required for: atoi(), rand()
+
+#define GENERATED_VERTEX_COUNT   1000000
+#define GENERATED_BONE_COUNT          32
+
+//------------------------------------------------------------------------------------
+// Module functions declaration
+//------------------------------------------------------------------------------------
+static Model GenModelSkinned(int vertexCount, int boneCount, ModelAnimation **anims);    // Generate skinned model with a random animation
+static float GetRandomFloat(void);                                                      // Get random float value in [-1..1] range
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    const char *fileName = (argc > 1)? argv[1] : NULL;
+    int frames = (argc > 2)? atoi(argv[2]) : 100;
+
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    SetTraceLogLevel(LOG_WARNING);
+    InitWindow(320, 240, "raylib benchmark - model skinning");
+
+    Model model = { 0 };
+    ModelAnimation *anims = NULL;
+    int animsCount = 0;
+
+    if (fileName != NULL)
+    {
+        model = LoadModel(fileName);
+        anims = LoadModelAnimations(fileName, &animsCount);
+    }
+    else
+    {
+        model = GenModelSkinned(GENERATED_VERTEX_COUNT, GENERATED_BONE_COUNT, &anims);
+        animsCount = 1;
+    }
+
+    if ((anims == NULL) || (animsCount == 0) || !IsModelAnimationValid(model, anims[0]))
+    {
+        printf("Model animation not available\n");
+        CloseWindow();
+        return 1;
+    }
+
+    int vertexCount = 0;
+    for (int i = 0; i < model.meshCount; i++) vertexCount += model.meshes[i].vertexCount;
+
+    // Warm up: worker pool threads creation, skinning shader loading
+    UpdateModelAnimationVertices(model, anims[0], 0);
+    UpdateModelAnimation(model, anims[0], 0);
+
+    double startTime = GetTime();
+    for (int i = 0; i < frames; i++) UpdateModelAnimationVertices(model, anims[0], i);
+    double cpuTime = GetTime() - startTime;
+
+    startTime = GetTime();
+    for (int i = 0; i < frames; i++) UpdateModelAnimation(model, anims[0], i);
+    double updateTime = GetTime() - startTime;
+
+    printf("Model: %s, meshes: %i, vertices: %i, bones: %i, frames: %i\n", (fileName != NULL)? GetFileName(fileName) : "generated",
+        model.meshCount, vertexCount, model.boneCount, frames);
+    printf("  UpdateModelAnimationVertices(): %8.3f ms/frame  (%.2f Mvertices/s)\n", cpuTime*1000.0/frames, (double)vertexCount*frames/cpuTime/1000000.0);
+    printf("  UpdateModelAnimation():         %8.3f ms/frame  (GPU skinned meshes only compute bone matrices)\n", updateTime*1000.0/frames);
+
+    UnloadModelAnimations(anims, animsCount);
+    UnloadModel(model);
+
+    CloseWindow();
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module functions definition
+//------------------------------------------------------------------------------------
+// Generate skinned model with a random animation
+// NOTE: Every vertex is weighted by 4 random bones, animation frames rotate bones around Y axis
+static Model GenModelSkinned(int vertexCount, int boneCount, ModelAnimation **anims)
+{
+    Mesh mesh = { 0 };
+    mesh.vertexCount = vertexCount;
+    mesh.triangleCount = vertexCount/3;
+    mesh.vertices = (float *)MemAlloc(vertexCount*3*sizeof(float));
+    mesh.normals = (float *)MemAlloc(vertexCount*3*sizeof(float));
+    mesh.animVertices = (float *)MemAlloc(vertexCount*3*sizeof(float));
+    mesh.animNormals = (float *)MemAlloc(vertexCount*3*sizeof(float));
+    mesh.boneIds = (unsigned char *)MemAlloc(vertexCount*4*sizeof(unsigned char));
+    mesh.boneWeights = (float *)MemAlloc(vertexCount*4*sizeof(float));
+
+    for (int i = 0; i < vertexCount; i++)
+    {
+        Vector3 normal = Vector3Normalize((Vector3){ GetRandomFloat(), GetRandomFloat(), GetRandomFloat() });
+
+        mesh.vertices[i*3] = GetRandomFloat()*10.0f;
+        mesh.vertices[i*3 + 1] = GetRandomFloat()*10.0f;
+        mesh.vertices[i*3 + 2] = GetRandomFloat()*10.0f;
+        mesh.normals[i*3] = normal.x;
+        mesh.normals[i*3 + 1] = normal.y;
+        mesh.normals[i*3 + 2] = normal.z;
+
+        for (int j = 0; j < 4; j++)
+        {
+            mesh.boneIds[i*4 + j] = (unsigned char)(rand()%boneCount);
+            mesh.boneWeights[i*4 + j] = 0.25f;
+        }
+    }
+
+    UploadMesh(&mesh, true);
+
+    Model model = LoadModelFromMesh(mesh);
+    model.boneCount = boneCount;
+    model.bones = (BoneInfo *)MemAlloc(boneCount*sizeof(BoneInfo));
+    model.bindPose = (Transform *)MemAlloc(boneCount*sizeof(Transform));
+
+    ModelAnimation *anim = (ModelAnimation *)MemAlloc(sizeof(ModelAnimation));
+    anim->boneCount = boneCount;
+    anim->frameCount = 60;
+    anim->bones = (BoneInfo *)MemAlloc(boneCount*sizeof(BoneInfo));
+    anim->framePoses = (Transform **)MemAlloc(anim->frameCount*sizeof(Transform *));
+
+    for (int i = 0; i < boneCount; i++)
+    {
+        model.bones[i].parent = -1;
+        anim->bones[i].parent = -1;
+        model.bindPose[i] = (Transform){ (Vector3){ GetRandomFloat(), GetRandomFloat(), GetRandomFloat() }, QuaternionIdentity(), Vector3One() };
+    }
+
+    for (int f = 0; f < anim->frameCount; f++)
+    {
+        anim->framePoses[f] = (Transform *)MemAlloc(boneCount*sizeof(Transform));
+
+        for (int i = 0; i < boneCount; i++)
+        {
+            anim->framePoses[f][i] = model.bindPose[i];
+            anim->framePoses[f][i].rotation = QuaternionFromAxisAngle((Vector3){ 0.0f, 1.0f, 0.0f }, (float)(f + i)*DEG2RAD);
+        }
+    }
+
+    *anims = anim;
+
+    return model;
+}
+
+// Get random float value in [-1..1] range
+static float GetRandomFloat(void)
+{
+    return (float)rand()/(float)RAND_MAX*2.0f - 1.0f;
+}
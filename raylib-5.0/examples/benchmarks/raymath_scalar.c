@@ -0,0 +1,32 @@
+/*******************************************************************************************
+*
+*   raylib benchmark - raymath scalar reference (used by raymath_simd benchmark)
+*
+*   raymath functions compiled without RAYMATH_SIMD, applied over arrays to compare
+*   results and performance with SIMD versions
+*
+*   Copyright (c) 2015-2023 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#define RAYMATH_STATIC_INLINE
+#include "raymath.h"
+
+#if defined(RAYMATH_SIMD)
+    #error "Scalar reference must be compiled without RAYMATH_SIMD"
+#endif
+
+//------------------------------------------------------------------------------------
+// Module functions definition
+//------------------------------------------------------------------------------------
+// Multiply arrays of matrices with MatrixMultiplyArray() (scalar)
+void ScalarMatrixMultiplyArray(Matrix *result, const Matrix *left, const Matrix *right, int count)
+{
+    MatrixMultiplyArray(result, left, right, count);
+}
+
+// Transform array of vectors with Vector3TransformArray() (scalar)
+void ScalarVector3TransformArray(Vector3 *result, const Vector3 *v, int count, Matrix mat)
+{
+    Vector3TransformArray(result, v, count, mat);
+}
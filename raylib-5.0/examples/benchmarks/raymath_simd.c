@@ -0,0 +1,153 @@
+/*******************************************************************************************
+*
+*   raylib benchmark - raymath SIMD
+*
+*   Checks raymath SIMD batch functions (RAYMATH_SIMD) results match scalar functions (bitwise)
+*   and measures both versions performance (operations/second), arrays of 1024 elements
+*
+*   Usage: raymath_simd [iterations]
+*   NOTE: Scalar reference is compiled separately (raymath_scalar.c), returns 1 if results differ
+*   NOTE: On ARM64, build with -DRAYMATH_SIMD_ENABLE_NEON to check NEON functions
+*
+*   Copyright (c) 2015-2023 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#define RAYMATH_SIMD
+#define RAYMATH_STATIC_INLINE
+#include "raymath.h"
+
+#include <stdio.h>              // Required for: printf()
+#include <stdlib.h>             // Required for: atoi(), rand(), malloc(), free()
+#include <string.h>             // Required for: memcmp(), memcpy()
+#include <stdbool.h>            // Required for: bool
+#include <time.h>               // Required for: clock_gettime()
+
+#define ARRAY_COUNT     1024
+#define VECTOR_COUNT    1027        // Not multiple of 4, checks remaining vectors on batch transform
+
+//------------------------------------------------------------------------------------
+// Module functions declaration
+//------------------------------------------------------------------------------------
+// Scalar reference functions (raymath_scalar.c)
+extern void ScalarMatrixMultiplyArray(Matrix *result, const Matrix *left, const Matrix *right, int count);
+extern void ScalarVector3TransformArray(Vector3 *result, const Vector3 *v, int count, Matrix mat);
+
+static double GetBenchmarkTime(void);           // Get monotonic time in seconds
+static float GetRandomFloat(void);              // Get random float value in [-10..10] range
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    int iterations = (argc > 1)? atoi(argv[1]) : 2000;
+
+#if defined(RAYMATH_SIMD_SSE)
+    printf("raymath SIMD: SSE\n");
+#elif defined(RAYMATH_SIMD_NEON)
+    printf("raymath SIMD: NEON\n");
+#else
+    printf("raymath SIMD: not supported by target, scalar code compared with itself\n");
+#endif
+
+    Matrix *left = (Matrix *)malloc(ARRAY_COUNT*sizeof(Matrix));
+    Matrix *right = (Matrix *)malloc(ARRAY_COUNT*sizeof(Matrix));
+    Matrix *scalar = (Matrix *)malloc(ARRAY_COUNT*sizeof(Matrix));
+    Matrix *simd = (Matrix *)malloc(ARRAY_COUNT*sizeof(Matrix));
+    Vector3 *vectors = (Vector3 *)malloc(VECTOR_COUNT*sizeof(Vector3));
+    Vector3 *scalarVectors = (Vector3 *)malloc(VECTOR_COUNT*sizeof(Vector3));
+    Vector3 *simdVectors = (Vector3 *)malloc(VECTOR_COUNT*sizeof(Vector3));
+
+    for (int i = 0; i < ARRAY_COUNT*16; i++)
+    {
+        (&left[0].m0)[i] = GetRandomFloat();
+        (&right[0].m0)[i] = GetRandomFloat();
+    }
+
+    for (int i = 0; i < VECTOR_COUNT; i++) vectors[i] = (Vector3){ GetRandomFloat(), GetRandomFloat(), GetRandomFloat() };
+
+    int failCount = 0;
+
+    printf("%-26s %10s %10s %8s  %s\n", "Function", "Scalar", "SIMD", "Speedup", "Results");
+
+    // Batch matrix multiplication
+    ScalarMatrixMultiplyArray(scalar, left, right, ARRAY_COUNT);
+    MatrixMultiplyArray(simd, left, right, ARRAY_COUNT);
+    bool equal = (memcmp(scalar, simd, ARRAY_COUNT*sizeof(Matrix)) == 0);
+
+    double startTime = GetBenchmarkTime();
+    for (int i = 0; i < iterations; i++) ScalarMatrixMultiplyArray(scalar, left, right, ARRAY_COUNT);
+    double scalarTime = GetBenchmarkTime() - startTime;
+
+    startTime = GetBenchmarkTime();
+    for (int i = 0; i < iterations; i++) MatrixMultiplyArray(simd, left, right, ARRAY_COUNT);
+    double simdTime = GetBenchmarkTime() - startTime;
+
+    printf("%-26s %8.1f M/s %6.1f M/s %7.2fx  %s\n", "MatrixMultiplyArray()", (double)ARRAY_COUNT*iterations/scalarTime/1000000.0,
+        (double)ARRAY_COUNT*iterations/simdTime/1000000.0, scalarTime/simdTime, equal? "equal" : "DIFFERENT");
+
+    if (!equal) failCount++;
+
+    // Batch transform, including remaining vectors (count not multiple of 4)
+    ScalarVector3TransformArray(scalarVectors, vectors, VECTOR_COUNT, left[0]);
+    Vector3TransformArray(simdVectors, vectors, VECTOR_COUNT, left[0]);
+    equal = (memcmp(scalarVectors, simdVectors, VECTOR_COUNT*sizeof(Vector3)) == 0);
+
+    startTime = GetBenchmarkTime();
+    for (int i = 0; i < iterations; i++) ScalarVector3TransformArray(scalarVectors, vectors, VECTOR_COUNT, left[i%ARRAY_COUNT]);
+    scalarTime = GetBenchmarkTime() - startTime;
+
+    startTime = GetBenchmarkTime();
+    for (int i = 0; i < iterations; i++) Vector3TransformArray(simdVectors, vectors, VECTOR_COUNT, left[i%ARRAY_COUNT]);
+    simdTime = GetBenchmarkTime() - startTime;
+
+    printf("%-26s %8.1f M/s %6.1f M/s %7.2fx  %s\n", "Vector3TransformArray()", (double)VECTOR_COUNT*iterations/scalarTime/1000000.0,
+        (double)VECTOR_COUNT*iterations/simdTime/1000000.0, scalarTime/simdTime, equal? "equal" : "DIFFERENT");
+
+    if (!equal) failCount++;
+
+    // In place batch functions, result array is the same as source array
+    memcpy(scalarVectors, vectors, VECTOR_COUNT*sizeof(Vector3));
+    memcpy(simdVectors, vectors, VECTOR_COUNT*sizeof(Vector3));
+    ScalarVector3TransformArray(scalarVectors, scalarVectors, VECTOR_COUNT, left[1]);
+    Vector3TransformArray(simdVectors, simdVectors, VECTOR_COUNT, left[1]);
+
+    memcpy(scalar, left, ARRAY_COUNT*sizeof(Matrix));
+    memcpy(simd, left, ARRAY_COUNT*sizeof(Matrix));
+    ScalarMatrixMultiplyArray(scalar, scalar, right, ARRAY_COUNT);
+    MatrixMultiplyArray(simd, simd, right, ARRAY_COUNT);
+
+    equal = (memcmp(scalarVectors, simdVectors, VECTOR_COUNT*sizeof(Vector3)) == 0) && (memcmp(scalar, simd, ARRAY_COUNT*sizeof(Matrix)) == 0);
+    printf("%-26s %38s\n", "In place batch functions", equal? "equal" : "DIFFERENT");
+
+    if (!equal) failCount++;
+
+    free(left);
+    free(right);
+    free(scalar);
+    free(simd);
+    free(vectors);
+    free(scalarVectors);
+    free(simdVectors);
+
+    return (failCount > 0)? 1 : 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module functions definition
+//------------------------------------------------------------------------------------
+// Get monotonic time in seconds
+static double GetBenchmarkTime(void)
+{
+    struct timespec time = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return (double)time.tv_sec + (double)time.tv_nsec*1e-9;
+}
+
+// Get random float value in [-10..10] range
+static float GetRandomFloat(void)
+{
+    return ((float)rand()/(float)RAND_MAX*2.0f - 1.0f)*10.0f;
+}
@@ -0,0 +1,172 @@
+/*******************************************************************************************
+*
+*   raylib benchmark - render batch
+*
+*   Measures render batch quads throughput (quads/second, batch uploads and draws included):
+*   per-vertex rlgl calls (rlBegin()/rlVertex*()), quads written directly with rlBeginQuads()
+*   and textures drawn with DrawTexturePro()
+*
+*   Usage: render_batch [quads] [frames]
+*   NOTE: Render batch vertex layout is selected when building raylib, to compare both layouts
+*   run this benchmark against raylib built with and without RLGL_RENDER_BATCH_INTERLEAVED (config.h)
+*
+*   Copyright (c) 2014-2023 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"
+
+#include <stdio.h>              // Required for: printf()
+#include <stdlib.h>             // Required for: atoi()
+#include <string.h>             // Required for: memcpy()
+
+#define RENDER_SIZE              512
+#define QUAD_SIZE                1.0f     // Small quads, rasterization cost is not measured
+
+typedef enum {
+    BATCH_RLVERTEX = 0,         // Quads submitted with rlBegin()/rlVertex*() calls
+    BATCH_QUADS_BUFFER,         // Quads written directly with rlBeginQuads()
+    BATCH_DRAW_TEXTURE          // Quads drawn with DrawTexturePro()
+} BatchMode;
+
+//------------------------------------------------------------------------------------
+// Module functions declaration
+//------------------------------------------------------------------------------------
+static double GetQuadsDrawTime(BatchMode mode, Texture2D texture, RenderTexture2D target, int quadCount, int frames);   // Get quads draw time (seconds)
+static Rectangle GetQuadRec(int index);         // Get quad destination rectangle, quads spread over render target
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    int quadCount = (argc > 1)? atoi(argv[1]) : 100000;
+    int frames = (argc > 2)? atoi(argv[2]) : 50;
+
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    SetTraceLogLevel(LOG_WARNING);
+    InitWindow(320, 240, "raylib benchmark - render batch");
+
+    RenderTexture2D target = LoadRenderTexture(RENDER_SIZE, RENDER_SIZE);
+    Image image = GenImageChecked(16, 16, 4, 4, WHITE, GRAY);
+    Texture2D texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+
+    // NOTE: Interleaved layout detected from quad buffer strides, position and color share the same stride
+    rlQuadBuffer quads = rlBeginQuads(texture.id, 0);
+    rlEndQuads(0);
+    rlSetTexture(0);
+    bool interleaved = (quads.vertexStride == quads.colorStride);
+
+    const char *modeNames[3] = { "rlBegin()/rlVertex*()", "rlBeginQuads()", "DrawTexturePro()" };
+
+    printf("Render batch layout: %s, quads: %i, frames: %i\n", interleaved? "interleaved" : "separate arrays", quadCount, frames);
+
+    for (int mode = 0; mode < 3; mode++)
+    {
+        GetQuadsDrawTime(mode, texture, target, quadCount, 2);     // Warm up
+
+        double time = GetQuadsDrawTime(mode, texture, target, quadCount, frames);
+
+        printf("  %-24s %8.3f ms/frame  (%.2f Mquads/s)\n", modeNames[mode], time*1000.0/frames, (double)quadCount*frames/time/1000000.0);
+    }
+
+    UnloadTexture(texture);
+    UnloadRenderTexture(target);
+
+    CloseWindow();
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------
+// Module functions definition
+//------------------------------------------------------------------------------------
+// Get quads draw time (seconds), GPU work is waited reading back target pixels
+static double GetQuadsDrawTime(BatchMode mode, Texture2D texture, RenderTexture2D target, int quadCount, int frames)
+{
+    const float texcoords[8] = { 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f };
+    const Color tint = WHITE;
+
+    double startTime = GetTime();
+
+    for (int f = 0; f < frames; f++)
+    {
+        BeginTextureMode(target);
+            ClearBackground(BLACK);
+
+            if (mode == BATCH_RLVERTEX)
+            {
+                rlSetTexture(texture.id);
+                rlBegin(RL_QUADS);
+
+                for (int i = 0; i < quadCount; i++)
+                {
+                    Rectangle rec = GetQuadRec(i);
+                    const float corners[8] = { rec.x, rec.y, rec.x, rec.y + rec.height, rec.x + rec.width, rec.y + rec.height, rec.x + rec.width, rec.y };
+
+                    rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                    rlNormal3f(0.0f, 0.0f, 1.0f);
+
+                    for (int v = 0; v < 4; v++)
+                    {
+                        rlTexCoord2f(texcoords[v*2], texcoords[v*2 + 1]);
+                        rlVertex2f(corners[v*2], corners[v*2 + 1]);
+                    }
+                }
+
+                rlEnd();
+                rlSetTexture(0);
+            }
+            else if (mode == BATCH_QUADS_BUFFER)
+            {
+                for (int i = 0; i < quadCount;)
+                {
+                    rlQuadBuffer quads = rlBeginQuads(texture.id, quadCount - i);
+
+                    for (int q = 0; q < quads.count; q++, i++)
+                    {
+                        Rectangle rec = GetQuadRec(i);
+                        const float corners[8] = { rec.x, rec.y, rec.x, rec.y + rec.height, rec.x + rec.width, rec.y + rec.height, rec.x + rec.width, rec.y };
+
+                        for (int v = 0; v < 4; v++)
+                        {
+                            float *position = RL_QUAD_POSITION(quads, q*4 + v);
+                            position[0] = corners[v*2];
+                            position[1] = corners[v*2 + 1];
+                            position[2] = quads.depth;
+
+                            memcpy(RL_QUAD_TEXCOORD(quads, q*4 + v), texcoords + v*2, 2*sizeof(float));
+                            memcpy(RL_QUAD_COLOR(quads, q*4 + v), &tint, sizeof(Color));
+                        }
+                    }
+
+                    rlEndQuads(quads.count);
+                }
+
+                rlSetTexture(0);
+            }
+            else
+            {
+                for (int i = 0; i < quadCount; i++)
+                {
+                    DrawTexturePro(texture, (Rectangle){ 0.0f, 0.0f, (float)texture.width, (float)texture.height }, GetQuadRec(i), (Vector2){ 0.0f, 0.0f }, 0.0f, tint);
+                }
+            }
+
+        EndTextureMode();
+    }
+
+    Image image = LoadImageFromTexture(target.texture);
+    double drawTime = GetTime() - startTime;
+    UnloadImage(image);
+
+    return drawTime;
+}
+
+// Get quad destination rectangle, quads spread over render target
+static Rectangle GetQuadRec(int index)
+{
+    return (Rectangle){ (float)((index*37)%RENDER_SIZE), (float)((index*101)%RENDER_SIZE), QUAD_SIZE, QUAD_SIZE };
+}
@@ -66,6 +66,14 @@
 #define SUPPORT_COMPRESSION_API         1
 // Support automatic generated events, loading and recording of those events when required
 #define SUPPORT_AUTOMATION_EVENTS       1
+// Cache linked shader programs binaries in user cache directory, skipping shaders compilation on next launches
+// Cache is keyed by shaders code and graphics driver, default shader included [InitWindow(), LoadShader()]
+// NOTE: Requires OpenGL 4.1 or GL_ARB_get_program_binary, shaders are always compiled otherwise
+#define SUPPORT_SHADER_CACHE            1
+// Support screen damage tracking, only screen regions changed are redrawn and presented [EnableDamageTracking()]
+// NOTE: Previous frames regions are also redrawn depending on back buffer age (EGL_EXT_buffer_age),
+// full screen is redrawn if back buffer age is not available and frames with no regions changed are not presented
+#define SUPPORT_DAMAGE_TRACKING         1
 // Support custom frame control, only for advance users
 // By default EndDrawing() does this job: draws everything + SwapScreenBuffer() + manage frame timing + PollInputEvents()
 // Enabling this flag allows manual control of the frame processes, use at your own risk
@@ -89,6 +97,17 @@
 
 #define MAX_AUTOMATION_EVENTS       16384       // Maximum number of automation events to record
 
+#define MAX_DAMAGE_RECTS                8       // Maximum number of screen regions changed by frame (merged if exceeded)
+#define MAX_DAMAGE_HISTORY              4       // Maximum number of previous frames regions kept (redrawn depending on back buffer age)
+
+//------------------------------------------------------------------------------------
+// Module: raymath - Configuration Flags
+//------------------------------------------------------------------------------------
+// Use SIMD intrinsics (SSE, if supported by target) for batch functions: Vector3TransformArray(), MatrixMultiplyArray()
+// NOTE: NEON intrinsics (ARM64) also require RAYMATH_SIMD_ENABLE_NEON, not validated yet
+#define RAYMATH_SIMD                    1
+//#define RAYMATH_SIMD_ENABLE_NEON        1
+
 //------------------------------------------------------------------------------------
 // Module: rlgl - Configuration values
 //------------------------------------------------------------------------------------
@@ -99,6 +118,9 @@
 // Show OpenGL extensions and capabilities detailed logs on init
 //#define RLGL_SHOW_GL_DETAILS_INFO              1
 
+// Store render batch vertex data interleaved (24 bytes per vertex), one buffer upload per batch draw
+//#define RLGL_RENDER_BATCH_INTERLEAVED          1
+
 //#define RL_DEFAULT_BATCH_BUFFER_ELEMENTS    4096    // Default internal render batch elements limits
 #define RL_DEFAULT_BATCH_BUFFERS               1      // Default number of batch buffers (multi-buffering)
 #define RL_DEFAULT_BATCH_DRAWCALLS           256      // Default number of batch draw calls (by state changes: mode, texture)
@@ -119,6 +141,9 @@
 #define RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR        "vertexColor"       // Bound by default to shader location: 3
 #define RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT      "vertexTangent"     // Bound by default to shader location: 4
 #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: 5
+#define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS      "vertexBoneIds"     // Bound by default to shader location: 6
+#define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS  "vertexBoneWeights" // Bound by default to shader location: 7
+#define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TX  "instanceTransform" // Bound by default to shader location: 8 (mat4, locations 8 to 11)
 
 #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
@@ -126,6 +151,7 @@
 #define RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL       "matModel"          // model matrix
 #define RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL      "matNormal"         // normal matrix (transpose(inverse(matModelView))
 #define RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR       "colDiffuse"        // color diffuse (base tint color, multiplied by texture color)
+#define RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES "boneMatrices"    // bone matrices array (skinning)
 #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0  "texture0"          // texture0 (texture slot active 0)
 #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1  "texture1"          // texture1 (texture slot active 1)
 #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
@@ -141,6 +167,8 @@
 // rshapes: Configuration values
 //------------------------------------------------------------------------------------
 #define SPLINE_SEGMENT_DIVISIONS       24       // Spline segments subdivisions
+#define SHAPES_CIRCLE_TABLE_SLOTS      16       // Unit circle sin/cos tables cached (one per number of divisions)
+#define SHAPES_CIRCLE_TABLE_MAX_DIVISIONS 360   // Maximum divisions stored per unit circle table
 
 
 //------------------------------------------------------------------------------------
@@ -191,6 +219,14 @@
 // drawing text and shapes with a single draw call [SetShapesTexture()].
 #define SUPPORT_FONT_ATLAS_WHITE_REC    1
 
+// Cache generated TTF/OTF fonts (glyphs metrics and atlas) on disk, in user cache directory [LoadFontEx(), LoadFontSdf()].
+// Cache is keyed by font file content, font size, codepoints and font type, and skips glyphs rasterization on next loads.
+// NOTE: Cache directory: %LOCALAPPDATA% (Windows), ~/Library/Caches (macOS), $XDG_CACHE_HOME or ~/.cache (Linux/BSD) + "/raylib/fonts"
+#define SUPPORT_FONT_CACHE              1
+// Compress font cache data (DEFLATE), smaller files but cache can not be used directly from mapped memory
+// NOTE: Requires SUPPORT_COMPRESSION_API
+//#define SUPPORT_FONT_CACHE_COMPRESSION  1
+
 // rtext: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TEXT_BUFFER_LENGTH       1024       // Size of internal static buffers used on some functions:
@@ -208,14 +244,19 @@
 #define SUPPORT_FILEFORMAT_GLTF         1
 #define SUPPORT_FILEFORMAT_VOX          1
 #define SUPPORT_FILEFORMAT_M3D          1
+#define SUPPORT_FILEFORMAT_RMSH         1
 // Support procedural mesh generation functions, uses external par_shapes.h library
 // NOTE: Some generated meshes DO NOT include generated texture coordinates
 #define SUPPORT_MESH_GENERATION         1
+// Support GPU skinning for animated models, bone matrices are uploaded as shader uniforms
+// NOTE: Meshes with more bones than skinning shader supports (vertex uniforms limited) or custom shaders without skinning
+// fallback to CPU skinning, mesh.animVertices is not updated for GPU skinned meshes [UpdateModelAnimationVertices()]
+#define SUPPORT_GPU_SKINNING            1
 
 // rmodels: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_MATERIAL_MAPS              12       // Maximum number of shader maps supported
-#define MAX_MESH_VERTEX_BUFFERS         7       // Maximum vertex buffers (VBO) per mesh
+#define MAX_MESH_VERTEX_BUFFERS         9       // Maximum vertex buffers (VBO) per mesh
 
 //------------------------------------------------------------------------------------
 // Module: raudio - Configuration Flags
@@ -247,8 +288,17 @@
 #define SUPPORT_TRACELOG                1
 //#define SUPPORT_TRACELOG_DEBUG          1
 
+// Support worker threads to parallelize heavy loading/processing work (i.e. font glyphs rasterization)
+// NOTE: Requires pthreads, on Windows and Web platforms work is always done on the calling thread
+#define SUPPORT_WORKER_THREADS          1
+
+// Support read-only files mapping into memory (mmap) to load binary caches without copies
+// NOTE: Requires POSIX mmap(), on other platforms file data is loaded with LoadFileData()
+#define SUPPORT_FILE_MAPPING            1
+
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH       256       // Max length of one trace-log message
+#define MAX_WORKER_THREADS              8       // Maximum number of worker threads in worker pool
 
 #endif // CONFIG_H
@@ -96,6 +96,13 @@ extern int tinyobj_parse_obj(tinyobj_attrib_t *attrib, tinyobj_shape_t **shapes,
                              unsigned int *num_shapes, tinyobj_material_t **materials,
                              unsigned int *num_materials, const char *buf, unsigned int len,
                              unsigned int flags);
+/* Same as tinyobj_parse_obj(), `mtllib' file name is relative to `base_dir'
+ * directory (if not NULL), no need to change working directory.
+ */
+extern int tinyobj_parse_obj_with_base_dir(tinyobj_attrib_t *attrib, tinyobj_shape_t **shapes,
+                             unsigned int *num_shapes, tinyobj_material_t **materials,
+                             unsigned int *num_materials, const char *buf, unsigned int len,
+                             const char *base_dir, unsigned int flags);
 extern int tinyobj_parse_mtl_file(tinyobj_material_t **materials_out,
                                   unsigned int *num_materials_out,
                                   const char *filename);
@@ -1211,6 +1218,14 @@ int tinyobj_parse_obj(tinyobj_attrib_t *attrib, tinyobj_shape_t **shapes,
                       unsigned int *num_shapes, tinyobj_material_t **materials_out,
                       unsigned int *num_materials_out, const char *buf, unsigned int len,
                       unsigned int flags) {
+  return tinyobj_parse_obj_with_base_dir(attrib, shapes, num_shapes, materials_out,
+                                         num_materials_out, buf, len, NULL, flags);
+}
+
+int tinyobj_parse_obj_with_base_dir(tinyobj_attrib_t *attrib, tinyobj_shape_t **shapes,
+                      unsigned int *num_shapes, tinyobj_material_t **materials_out,
+                      unsigned int *num_materials_out, const char *buf, unsigned int len,
+                      const char *base_dir, unsigned int flags) {
   LineInfo *line_infos = NULL;
   Command *commands = NULL;
   unsigned int num_lines = 0;
@@ -1324,6 +1339,19 @@ int tinyobj_parse_obj(tinyobj_attrib_t *attrib, tinyobj_shape_t **shapes,
     char *filename = my_strndup(commands[mtllib_line_index].mtllib_name,
                                 commands[mtllib_line_index].mtllib_name_len);
 
+    /* Relative path, prepend base directory */
+    if (base_dir != NULL && base_dir[0] != '\0' && filename[0] != '/' &&
+        filename[0] != '\\' && !(filename[0] != '\0' && filename[1] == ':')) {
+      size_t base_len = strlen(base_dir);
+      size_t name_len = strlen(filename);
+      char *path = (char *)TINYOBJ_MALLOC(base_len + name_len + 2);
+      memcpy(path, base_dir, base_len);
+      path[base_len] = '/';
+      memcpy(path + base_len + 1, filename, name_len + 1);
+      TINYOBJ_FREE(filename);
+      filename = path;
+    }
+
     int ret = tinyobj_parse_and_index_mtl_file(&materials, &num_materials, filename, &material_table);
 
     if (ret != TINYOBJ_SUCCESS) {
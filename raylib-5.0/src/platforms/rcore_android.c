@@ -52,6 +52,7 @@
 #include <jni.h>                        // Required for: JNIEnv and JavaVM [Used in OpenURL()]
 
 #include <EGL/egl.h>                    // Native platform windowing system interface
+#include <EGL/eglext.h>                 // EGL extensions [Used in damage tracking]
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -68,6 +69,10 @@ typedef struct {
     EGLSurface surface;                 // Surface to draw on, framebuffers (connected to context)
     EGLContext context;                 // Graphic context, mode in which drawing can be done
     EGLConfig config;                   // Graphic config
+
+    // Damage tracking data
+    bool bufferAgeSupported;            // Back buffer age query supported (EGL_EXT_buffer_age)
+    PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC swapBuffersWithDamage;   // Swap presenting only regions changed (EGL_KHR_swap_buffers_with_damage)
 } PlatformData;
 
 //----------------------------------------------------------------------------------
@@ -82,6 +87,9 @@ static PlatformData platform = { 0 };   // Platform specific data
 //----------------------------------------------------------------------------------
 int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 void ClosePlatform(void);        // Close platform
+#if defined(SUPPORT_DAMAGE_TRACKING)
+int GetScreenBufferAge(void);    // Get back buffer age (frames since its content was presented), 0 if unknown
+#endif
 
 static void AndroidCommandCallback(struct android_app *app, int32_t cmd);           // Process Android activity lifecycle commands
 static int32_t AndroidInputCallback(struct android_app *app, AInputEvent *event);   // Process Android inputs
@@ -378,8 +386,29 @@ void DisableCursor(void)
 // Swap back buffer with front buffer (screen drawing)
 void SwapScreenBuffer(void)
 {
+#if defined(SUPPORT_DAMAGE_TRACKING)
+    // Only screen regions changed are presented, if supported
+    EGLint rects[4*MAX_DAMAGE_RECTS] = { 0 };
+    int rectCount = GetScreenDamageRects(rects);
+
+    if ((rectCount > 0) && (platform.swapBuffersWithDamage != NULL)) platform.swapBuffersWithDamage(platform.device, platform.surface, rects, rectCount);
+    else eglSwapBuffers(platform.device, platform.surface);
+#else
     eglSwapBuffers(platform.device, platform.surface);
+#endif
+}
+
+#if defined(SUPPORT_DAMAGE_TRACKING)
+// Get back buffer age (frames since its content was presented), 0 if unknown
+int GetScreenBufferAge(void)
+{
+    EGLint age = 0;
+
+    if (platform.bufferAgeSupported) eglQuerySurface(platform.device, platform.surface, EGL_BUFFER_AGE_EXT, &age);
+
+    return (int)age;
 }
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition: Misc
@@ -737,6 +766,22 @@ static int InitGraphicsDevice(void)
     // NOTE: GL procedures address loader is required to load extensions
     rlLoadExtensions(eglGetProcAddress);
 
+#if defined(SUPPORT_DAMAGE_TRACKING)
+    // Check back buffer age and damage presentation support
+    const char *eglExtensions = eglQueryString(platform.device, EGL_EXTENSIONS);
+
+    if (eglExtensions != NULL)
+    {
+        platform.bufferAgeSupported = (strstr(eglExtensions, "EGL_EXT_buffer_age") != NULL);
+
+        if (strstr(eglExtensions, "EGL_KHR_swap_buffers_with_damage") != NULL) platform.swapBuffersWithDamage = (PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC)eglGetProcAddress("eglSwapBuffersWithDamageKHR");
+        else if (strstr(eglExtensions, "EGL_EXT_swap_buffers_with_damage") != NULL) platform.swapBuffersWithDamage = (PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC)eglGetProcAddress("eglSwapBuffersWithDamageEXT");
+
+        if (platform.bufferAgeSupported) TRACELOG(LOG_INFO, "DISPLAY: Back buffer age supported, only screen regions changed are redrawn (damage tracking)");
+        if (platform.swapBuffersWithDamage != NULL) TRACELOG(LOG_INFO, "DISPLAY: Swap buffers with damage supported, only screen regions changed are presented (damage tracking)");
+    }
+#endif
+
     CORE.Window.ready = true;
 
     if ((CORE.Window.flags & FLAG_WINDOW_MINIMIZED) > 0) MinimizeWindow();
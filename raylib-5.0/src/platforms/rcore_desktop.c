@@ -76,6 +76,23 @@
     //#define GLFW_EXPOSE_NATIVE_WAYLAND
     //#define GLFW_EXPOSE_NATIVE_MIR
     #include "GLFW/glfw3native.h"       // Required for: glfwGetX11Window()
+
+    #if defined(SUPPORT_DAMAGE_TRACKING)
+        // NOTE: GLX and EGL headers are not included (Xlib.h > X.h Font type conflicts with raylib Font),
+        // native handles required to query back buffer age are declared as opaque pointers
+        #define GLX_BACK_BUFFER_AGE_EXT     0x20F4
+        #define EGL_BUFFER_AGE_EXT          0x313D
+
+        #if !defined(_GLFW_WAYLAND)
+        void *glfwGetX11Display(void);                          // Returns: Display *
+        unsigned long glfwGetGLXWindow(GLFWwindow *window);     // Returns: GLXWindow
+        #endif
+        void *glfwGetEGLDisplay(void);                          // Returns: EGLDisplay
+        void *glfwGetEGLSurface(GLFWwindow *window);            // Returns: EGLSurface
+
+        typedef void (*PFNGLXQUERYDRAWABLEPROC)(void *dpy, unsigned long draw, int attribute, unsigned int *value);
+        typedef unsigned int (*PFNEGLQUERYSURFACEPROC)(void *dpy, void *surface, int attribute, int *value);
+    #endif
 #endif
 #if defined(__APPLE__)
     #include <unistd.h>                 // Required for: usleep()
@@ -99,6 +116,12 @@
 //----------------------------------------------------------------------------------
 typedef struct {
     GLFWwindow *handle;                 // GLFW window handle (graphic device)
+
+#if defined(SUPPORT_DAMAGE_TRACKING) && (defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__))
+    // Damage tracking data
+    PFNGLXQUERYDRAWABLEPROC glXQueryDrawable;   // Back buffer age query, GLX context (GLX_EXT_buffer_age)
+    PFNEGLQUERYSURFACEPROC eglQuerySurface;     // Back buffer age query, EGL context (EGL_EXT_buffer_age), used on Wayland
+#endif
 } PlatformData;
 
 //----------------------------------------------------------------------------------
@@ -113,6 +136,9 @@ static PlatformData platform = { 0 };   // Platform specific data
 //----------------------------------------------------------------------------------
 int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 void ClosePlatform(void);        // Close platform
+#if defined(SUPPORT_DAMAGE_TRACKING)
+int GetScreenBufferAge(void);       // Get back buffer age (frames since its content was presented), 0 if unknown
+#endif
 
 // Error callback event
 static void ErrorCallback(int error, const char *description);                             // GLFW3 Error Callback, runs on GLFW3 error
@@ -1024,6 +1050,30 @@ void SwapScreenBuffer(void)
     glfwSwapBuffers(platform.handle);
 }
 
+#if defined(SUPPORT_DAMAGE_TRACKING)
+// Get back buffer age (frames since its content was presented), 0 if unknown
+// NOTE: Queried with GLX_EXT_buffer_age (X11) or EGL_EXT_buffer_age (Wayland or EGL context),
+// not available on other platforms, back buffer content is considered unknown (full redraw)
+int GetScreenBufferAge(void)
+{
+    int age = 0;
+
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+    if (platform.eglQuerySurface != NULL) platform.eglQuerySurface(glfwGetEGLDisplay(), glfwGetEGLSurface(platform.handle), EGL_BUFFER_AGE_EXT, &age);
+#if !defined(_GLFW_WAYLAND)
+    else if (platform.glXQueryDrawable != NULL)
+    {
+        unsigned int value = 0;
+        platform.glXQueryDrawable(glfwGetX11Display(), glfwGetGLXWindow(platform.handle), GLX_BACK_BUFFER_AGE_EXT, &value);
+        age = (int)value;
+    }
+#endif
+#endif
+
+    return age;
+}
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: Misc
 //----------------------------------------------------------------------------------
@@ -1542,6 +1592,25 @@ int InitPlatform(void)
     // Load OpenGL extensions
     // NOTE: GL procedures address loader is required to load extensions
     rlLoadExtensions(glfwGetProcAddress);
+
+#if defined(SUPPORT_DAMAGE_TRACKING) && (defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__))
+    // Load back buffer age query (damage tracking), context is EGL on Wayland or if requested, GLX otherwise
+    // NOTE: Query functions are retrieved with context procedures loader, no GLX/EGL library linkage required
+#if defined(_GLFW_WAYLAND)
+    bool eglContext = true;
+#else
+    bool eglContext = (glfwGetWindowAttrib(platform.handle, GLFW_CONTEXT_CREATION_API) == GLFW_EGL_CONTEXT_API);
+#endif
+    if (eglContext)
+    {
+        if (glfwExtensionSupported("EGL_EXT_buffer_age")) platform.eglQuerySurface = (PFNEGLQUERYSURFACEPROC)glfwGetProcAddress("eglQuerySurface");
+    }
+#if !defined(_GLFW_WAYLAND)
+    else if (glfwExtensionSupported("GLX_EXT_buffer_age")) platform.glXQueryDrawable = (PFNGLXQUERYDRAWABLEPROC)glfwGetProcAddress("glXQueryDrawable");
+#endif
+
+    if ((platform.eglQuerySurface != NULL) || (platform.glXQueryDrawable != NULL)) TRACELOG(LOG_INFO, "DISPLAY: Back buffer age supported, only screen regions changed are redrawn (damage tracking)");
+#endif
     //----------------------------------------------------------------------------
 
     // Initialize input events callbacks
@@ -219,6 +219,9 @@ static const int CursorsLUT[] = {
 //----------------------------------------------------------------------------------
 int InitPlatform(void);                                      // Initialize platform (graphics, inputs and more)
 void ClosePlatform(void);                                    // Close platform
+#if defined(SUPPORT_DAMAGE_TRACKING)
+int GetScreenBufferAge(void);                                   // Get back buffer age (frames since its content was presented), 0 if unknown
+#endif
 
 static KeyboardKey ConvertScancodeToKey(SDL_Scancode sdlScancode);  // Help convert SDL scancodes to raylib key
 
@@ -898,6 +901,15 @@ void SwapScreenBuffer(void)
     SDL_GL_SwapWindow(platform.window);
 }
 
+#if defined(SUPPORT_DAMAGE_TRACKING)
+// Get back buffer age (frames since its content was presented), 0 if unknown
+// NOTE: SDL does not expose back buffer age, its content is considered unknown (full redraw)
+int GetScreenBufferAge(void)
+{
+    return 0;
+}
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: Misc
 //----------------------------------------------------------------------------------
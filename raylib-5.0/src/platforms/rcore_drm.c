@@ -108,6 +108,10 @@ typedef struct {
     EGLContext context;                 // Graphic context, mode in which drawing can be done
     EGLConfig config;                   // Graphic config
 
+    // Damage tracking data
+    bool bufferAgeSupported;            // Back buffer age query supported (EGL_EXT_buffer_age)
+    PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC swapBuffersWithDamage;   // Swap presenting only regions changed (EGL_KHR_swap_buffers_with_damage)
+
     // Input data
     InputEventWorker eventWorker[10];   // List of worker threads for every monitored "/dev/input/event<N>"
 
@@ -178,6 +182,9 @@ static const int EvkeyToUnicodeLUT[] = {
 //----------------------------------------------------------------------------------
 int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 void ClosePlatform(void);        // Close platform
+#if defined(SUPPORT_DAMAGE_TRACKING)
+int GetScreenBufferAge(void);    // Get back buffer age (frames since its content was presented), 0 if unknown
+#endif
 
 static void InitKeyboard(void);                 // Initialize raw keyboard system
 static void RestoreKeyboard(void);              // Restore keyboard system
@@ -455,7 +462,16 @@ void DisableCursor(void)
 // Swap back buffer with front buffer (screen drawing)
 void SwapScreenBuffer(void)
 {
+#if defined(SUPPORT_DAMAGE_TRACKING)
+    // Only screen regions changed are presented, if supported
+    EGLint rects[4*MAX_DAMAGE_RECTS] = { 0 };
+    int rectCount = GetScreenDamageRects(rects);
+
+    if ((rectCount > 0) && (platform.swapBuffersWithDamage != NULL)) platform.swapBuffersWithDamage(platform.device, platform.surface, rects, rectCount);
+    else eglSwapBuffers(platform.device, platform.surface);
+#else
     eglSwapBuffers(platform.device, platform.surface);
+#endif
 
     if (!platform.gbmSurface || (-1 == platform.fd) || !platform.connector || !platform.crtc) TRACELOG(LOG_ERROR, "DISPLAY: DRM initialization failed to swap");
 
@@ -482,6 +498,18 @@ void SwapScreenBuffer(void)
     platform.prevBO = bo;
 }
 
+#if defined(SUPPORT_DAMAGE_TRACKING)
+// Get back buffer age (frames since its content was presented), 0 if unknown
+int GetScreenBufferAge(void)
+{
+    EGLint age = 0;
+
+    if (platform.bufferAgeSupported) eglQuerySurface(platform.device, platform.surface, EGL_BUFFER_AGE_EXT, &age);
+
+    return (int)age;
+}
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: Misc
 //----------------------------------------------------------------------------------
@@ -1127,6 +1155,22 @@ int InitPlatform(void)
     // Load OpenGL extensions
     // NOTE: GL procedures address loader is required to load extensions
     rlLoadExtensions(eglGetProcAddress);
+
+#if defined(SUPPORT_DAMAGE_TRACKING)
+    // Check back buffer age and damage presentation support
+    const char *eglExtensions = eglQueryString(platform.device, EGL_EXTENSIONS);
+
+    if (eglExtensions != NULL)
+    {
+        platform.bufferAgeSupported = (strstr(eglExtensions, "EGL_EXT_buffer_age") != NULL);
+
+        if (strstr(eglExtensions, "EGL_KHR_swap_buffers_with_damage") != NULL) platform.swapBuffersWithDamage = (PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC)eglGetProcAddress("eglSwapBuffersWithDamageKHR");
+        else if (strstr(eglExtensions, "EGL_EXT_swap_buffers_with_damage") != NULL) platform.swapBuffersWithDamage = (PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC)eglGetProcAddress("eglSwapBuffersWithDamageEXT");
+
+        if (platform.bufferAgeSupported) TRACELOG(LOG_INFO, "DISPLAY: Back buffer age supported, only screen regions changed are redrawn (damage tracking)");
+        if (platform.swapBuffersWithDamage != NULL) TRACELOG(LOG_INFO, "DISPLAY: Swap buffers with damage supported, only screen regions changed are presented (damage tracking)");
+    }
+#endif
     //----------------------------------------------------------------------------
 
     // Initialize timming system
@@ -73,6 +73,9 @@ static PlatformData platform = { 0 };   // Platform specific data
 //----------------------------------------------------------------------------------
 int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 bool InitGraphicsDevice(void);   // Initialize graphics device
+#if defined(SUPPORT_DAMAGE_TRACKING)
+int GetScreenBufferAge(void);    // Get back buffer age (frames since its content was presented), 0 if unknown
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
@@ -328,6 +331,15 @@ void SwapScreenBuffer(void)
     eglSwapBuffers(platform.device, platform.surface);
 }
 
+#if defined(SUPPORT_DAMAGE_TRACKING)
+// Get back buffer age (frames since its content was presented), 0 if unknown
+// TODO: Query back buffer age if supported (i.e. EGL_EXT_buffer_age), full screen is redrawn otherwise
+int GetScreenBufferAge(void)
+{
+    return 0;
+}
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: Misc
 //----------------------------------------------------------------------------------
@@ -87,6 +87,9 @@ static PlatformData platform = { 0 };   // Platform specific data
 //----------------------------------------------------------------------------------
 int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 void ClosePlatform(void);        // Close platform
+#if defined(SUPPORT_DAMAGE_TRACKING)
+int GetScreenBufferAge(void);       // Get back buffer age (frames since its content was presented), 0 if unknown
+#endif
 
 // Error callback event
 static void ErrorCallback(int error, const char *description);                      // GLFW3 Error Callback, runs on GLFW3 error
@@ -468,6 +471,15 @@ void SwapScreenBuffer(void)
     glfwSwapBuffers(platform.handle);
 }
 
+#if defined(SUPPORT_DAMAGE_TRACKING)
+// Get back buffer age (frames since its content was presented), 0 if unknown
+// NOTE: WebGL drawing buffer is not preserved after presenting, its content is considered unknown (full redraw)
+int GetScreenBufferAge(void)
+{
+    return 0;
+}
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: Misc
 //----------------------------------------------------------------------------------
@@ -292,6 +292,23 @@ typedef struct NPatchInfo {
     int layout;             // Layout of the n-patch: 3x3, 1x3 or 3x1
 } NPatchInfo;
 
+// TextureAtlas, runtime packed texture atlas (skyline packing)
+typedef struct TextureAtlas {
+    Image image;            // Atlas image data (CPU copy, R8G8B8A8)
+    Texture2D texture;      // Atlas texture (GPU)
+    int padding;            // Padding added around every packed image
+    int spriteCount;        // Number of sprites packed
+    Rectangle *recs;        // Sprites rectangles in atlas
+    int nodeCount;          // Number of skyline nodes
+    int *nodes;             // Skyline nodes data (x, y, width)
+} TextureAtlas;
+
+// Sprite, texture atlas region handle
+typedef struct Sprite {
+    Texture2D texture;      // Atlas texture containing the sprite
+    Rectangle source;       // Sprite rectangle in atlas texture
+} Sprite;
+
 // GlyphInfo, font characters glyphs info
 typedef struct GlyphInfo {
     int value;              // Character value (Unicode)
@@ -330,6 +347,10 @@ typedef struct Camera2D {
     float zoom;             // Camera zoom (scaling), should be 1.0f by default
 } Camera2D;
 
+// Opaque structs declaration
+// NOTE: Actual structs are defined internally in rmodels module
+typedef struct rMeshBvh rMeshBvh;
+
 // Mesh, vertex data and vao/vbo
 typedef struct Mesh {
     int vertexCount;        // Number of vertices stored in arrays
@@ -345,10 +366,15 @@ typedef struct Mesh {
     unsigned short *indices;    // Vertex indices (in case vertex data comes indexed)
 
     // Animation vertex data
-    float *animVertices;    // Animated vertex positions (after bones transformations)
+    float *animVertices;    // Animated vertex positions (after bones transformations, not updated by GPU skinning)
     float *animNormals;     // Animated normals (after bones transformations)
     unsigned char *boneIds; // Vertex bone ids, max 255 bone ids, up to 4 bones influence by vertex (skinning)
     float *boneWeights;     // Vertex bone weight, up to 4 bones influence by vertex (skinning)
+    int boneCount;          // Number of bone matrices (GPU skinning, 0 if mesh is CPU skinned)
+    Matrix *boneMatrices;   // Bone matrices for current animation frame (GPU skinning)
+
+    // Collision data
+    rMeshBvh *bvh;          // Bounding volume hierarchy for ray collision, generated with GenMeshBvh() (optional)
 
     // OpenGL identifiers
     unsigned int vaoId;     // OpenGL Vertex Array Object id
@@ -402,6 +428,10 @@ typedef struct Model {
     int boneCount;          // Number of bones
     BoneInfo *bones;        // Bones information (skeleton)
     Transform *bindPose;    // Bones base transformation (pose)
+
+    // Levels of detail data
+    int lodCount;           // Number of levels of detail, generated with GenModelLods() (optional)
+    Mesh *lodMeshes;        // Levels of detail meshes (lodCount*meshCount), level l of mesh i at [(l - 1)*meshCount + i]
 } Model;
 
 // ModelAnimation
@@ -433,6 +463,17 @@ typedef struct BoundingBox {
     Vector3 max;            // Maximum vertex box-corner
 } BoundingBox;
 
+// Terrain, heightmap split in chunks meshes with levels of detail
+typedef struct Terrain {
+    int chunkCountX;        // Number of chunks along X
+    int chunkCountZ;        // Number of chunks along Z
+    int lodCount;           // Number of levels of detail by chunk
+    Mesh *chunks;           // Chunks meshes (chunkCount*lodCount), level l of chunk i at [i*lodCount + l]
+    BoundingBox *bounds;    // Chunks bounding boxes (terrain local space)
+    float lodDistance;      // Distance drawn at full detail, every doubling selects next level of detail
+    Material material;      // Terrain material (default material, textures could be set)
+} Terrain;
+
 // Wave, audio wave data
 typedef struct Wave {
     unsigned int frameCount;    // Total number of frames (considering channels)
@@ -786,7 +827,10 @@ typedef enum {
     SHADER_LOC_MAP_CUBEMAP,         // Shader location: samplerCube texture: cubemap
     SHADER_LOC_MAP_IRRADIANCE,      // Shader location: samplerCube texture: irradiance
     SHADER_LOC_MAP_PREFILTER,       // Shader location: samplerCube texture: prefilter
-    SHADER_LOC_MAP_BRDF             // Shader location: sampler2d texture: brdf
+    SHADER_LOC_MAP_BRDF,            // Shader location: sampler2d texture: brdf
+    SHADER_LOC_VERTEX_BONEIDS,      // Shader location: vertex attribute: bone ids (skinning)
+    SHADER_LOC_VERTEX_BONEWEIGHTS,  // Shader location: vertex attribute: bone weights (skinning)
+    SHADER_LOC_BONE_MATRICES        // Shader location: matrix array uniform: bone matrices (skinning)
 } ShaderLocationIndex;
 
 #define SHADER_LOC_MAP_DIFFUSE      SHADER_LOC_MAP_ALBEDO
@@ -876,7 +920,7 @@ typedef enum {
 typedef enum {
     FONT_DEFAULT = 0,               // Default font generation, anti-aliased
     FONT_BITMAP,                    // Bitmap font generation, no anti-aliasing
-    FONT_SDF                        // SDF font generation, requires external shader
+    FONT_SDF                        // SDF font generation, requires SDF shader (built-in for LoadFontSdf())
 } FontType;
 
 // Color blending modes (pre-defined)
@@ -1024,6 +1068,11 @@ RLAPI void BeginBlendMode(int mode);                              // Begin blend
 RLAPI void EndBlendMode(void);                                    // End blending mode (reset to default: alpha blending)
 RLAPI void BeginScissorMode(int x, int y, int width, int height); // Begin scissor mode (define screen area for following drawing)
 RLAPI void EndScissorMode(void);                                  // End scissor mode
+RLAPI void BeginDrawSortMode(void);                               // Begin 2D draw sorting mode (non-overlapping draws merged by texture)
+RLAPI void EndDrawSortMode(void);                                 // End 2D draw sorting mode
+RLAPI void EnableDamageTracking(void);                            // Enable damage tracking, only screen regions changed are redrawn and presented
+RLAPI void DisableDamageTracking(void);                           // Disable damage tracking, full screen redrawn and presented every frame
+RLAPI void AddScreenDamage(Rectangle rec);                        // Add screen region changed, to be redrawn and presented on next frame (damage tracking)
 RLAPI void BeginVrStereoMode(VrStereoConfig config);              // Begin stereo rendering (requires VR simulator)
 RLAPI void EndVrStereoMode(void);                                 // End stereo rendering (requires VR simulator)
 
@@ -1216,6 +1265,7 @@ RLAPI void UpdateCameraPro(Camera *camera, Vector3 movement, Vector3 rotation, f
 // NOTE: It can be useful when using basic shapes and one single font,
 // defining a font char white rectangle would allow drawing everything in a single draw call
 RLAPI void SetShapesTexture(Texture2D texture, Rectangle source);       // Set texture and rectangle to be used on shapes drawing
+RLAPI void SetShapesSdfMode(bool enabled);                              // Set shapes SDF mode, circles, rings, rounded rectangles and thick lines drawn as anti-aliased quads
 
 // Basic shapes drawing functions
 RLAPI void DrawPixel(int posX, int posY, Color color);                                                   // Draw a pixel
@@ -1397,6 +1447,16 @@ RLAPI void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position,
 RLAPI void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draw a part of a texture defined by a rectangle with 'pro' parameters
 RLAPI void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draws a texture (or part of it) that stretches or shrinks nicely
 
+// Texture atlas functions
+// NOTE: Sprites from the same atlas share one texture, consecutive sprite draws are merged in one draw call
+RLAPI TextureAtlas LoadTextureAtlas(int width, int height, int padding);                                 // Load empty texture atlas, it grows automatically when full
+RLAPI bool IsTextureAtlasReady(TextureAtlas atlas);                                                      // Check if a texture atlas is ready
+RLAPI void UnloadTextureAtlas(TextureAtlas atlas);                                                       // Unload texture atlas from CPU and GPU memory
+RLAPI int AddTextureAtlasImage(TextureAtlas *atlas, Image image);                                        // Pack image into texture atlas, returns sprite index (-1 on failure)
+RLAPI Sprite GetTextureAtlasSprite(TextureAtlas atlas, int index);                                       // Get sprite handle from texture atlas (valid until atlas grows)
+RLAPI void DrawSprite(Sprite sprite, Vector2 position, Color tint);                                      // Draw a sprite
+RLAPI void DrawSpritePro(Sprite sprite, Rectangle dest, Vector2 origin, float rotation, Color tint);     // Draw a sprite with 'pro' parameters
+
 // Color/pixel related functions
 RLAPI Color Fade(Color color, float alpha);                                 // Get color with alpha applied, alpha goes from 0.0f to 1.0f
 RLAPI int ColorToInt(Color color);                                          // Get hexadecimal value for a Color
@@ -1424,6 +1484,8 @@ RLAPI Font LoadFont(const char *fileName);
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount);  // Load font from file with extended parameters, use NULL for codepoints and 0 for codepointCount to load the default character set
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
+RLAPI Font LoadFontDynamic(const char *fileName, int fontSize, int glyphCapacity);         // Load font from TTF/OTF file with glyphs rasterized on first use (LRU glyphs cache)
+RLAPI Font LoadFontSdf(const char *fileName, int fontSize, int *codepoints, int codepointCount); // Load SDF font from TTF/OTF file (atlas cached on disk), drawn with built-in SDF shader at any size
 RLAPI bool IsFontReady(Font font);                                                          // Check if a font is ready
 RLAPI GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type); // Load font data for further use
 RLAPI Image GenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
@@ -1433,6 +1495,7 @@ RLAPI bool ExportFontAsCode(Font font, const char *fileName);
 
 // Text drawing functions
 RLAPI void DrawFPS(int posX, int posY);                                                     // Draw current FPS
+RLAPI void DrawFrameStats(int posX, int posY);                                              // Draw last frame rendering statistics (draw calls, vertex, uploads, GPU time)
 RLAPI void DrawText(const char *text, int posX, int posY, int fontSize, Color color);       // Draw text (using default font)
 RLAPI void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text using font and additional parameters
 RLAPI void DrawTextPro(Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, Color tint); // Draw text using Font and pro parameters (rotation)
@@ -1510,15 +1573,24 @@ RLAPI void DrawGrid(int slices, float spacing);
 // Model management functions
 RLAPI Model LoadModel(const char *fileName);                                                // Load model from files (meshes and materials)
 RLAPI Model LoadModelFromMesh(Mesh mesh);                                                   // Load model from generated mesh (default material)
+RLAPI int LoadModelAsync(const char *fileName);                                             // Load model asynchronously (file parsing on worker threads), returns load id
+RLAPI int UpdateModelLoads(float timeBudget);                                               // Upload asynchronous loads data to GPU for a time budget (seconds), returns loads pending
+RLAPI bool IsModelLoadReady(int loadId);                                                    // Check if an asynchronous model load is ready
+RLAPI Model GetLoadedModel(int loadId);                                                     // Get asynchronously loaded model (must be ready), load id is released
+RLAPI void UnloadModelLoad(int loadId);                                                     // Unload asynchronous model load (cancelled if not ready), load id is released
 RLAPI bool IsModelReady(Model model);                                                       // Check if a model is ready
 RLAPI void UnloadModel(Model model);                                                        // Unload model (including meshes) from memory (RAM and/or VRAM)
 RLAPI BoundingBox GetModelBoundingBox(Model model);                                         // Compute model bounding box limits (considers all meshes)
+RLAPI void GenModelLods(Model *model, int lodCount);                                        // Generate model levels of detail (halving triangles by level), selected on drawing by model screen size
+RLAPI bool ExportModel(Model model, const char *fileName);                                  // Export model data to file (.rmsh), returns true on success
 
 // Model drawing functions
 RLAPI void DrawModel(Model model, Vector3 position, float scale, Color tint);               // Draw a model (with texture if set)
 RLAPI void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint); // Draw a model with extended parameters
 RLAPI void DrawModelWires(Model model, Vector3 position, float scale, Color tint);          // Draw a model wires (with texture if set)
 RLAPI void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint); // Draw a model wires (with texture if set) with extended parameters
+RLAPI void BeginMeshQueue(void);                                                            // Begin queuing meshes drawing (DrawMesh(), DrawModel*()), queued meshes are frustum culled and sorted by shader and texture
+RLAPI void EndMeshQueue(void);                                                              // End queuing meshes drawing and draw queued meshes (call before EndMode3D())
 RLAPI void DrawBoundingBox(BoundingBox box, Color color);                                   // Draw bounding box (wires)
 RLAPI void DrawBillboard(Camera camera, Texture2D texture, Vector3 position, float size, Color tint);   // Draw a billboard texture
 RLAPI void DrawBillboardRec(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector2 size, Color tint); // Draw a billboard texture defined by source
@@ -1533,6 +1605,9 @@ RLAPI void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transfo
 RLAPI bool ExportMesh(Mesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
 RLAPI BoundingBox GetMeshBoundingBox(Mesh mesh);                                            // Compute mesh bounding box limits
 RLAPI void GenMeshTangents(Mesh *mesh);                                                     // Compute mesh tangents
+RLAPI void GenMeshBvh(Mesh *mesh);                                                          // Compute mesh bounding volume hierarchy, used by GetRayCollisionMesh()
+RLAPI Mesh GenMeshSimplified(Mesh mesh, float ratio);                                       // Generate simplified mesh (quadric error metric), ratio of triangles kept
+RLAPI void OptimizeMesh(Mesh *mesh);                                                        // Optimize mesh for GPU drawing (vertex dedup, vertex cache, overdraw and vertex fetch), call before UploadMesh()
 
 // Mesh generation functions
 RLAPI Mesh GenMeshPoly(int sides, float radius);                                            // Generate polygonal mesh
@@ -1547,6 +1622,11 @@ RLAPI Mesh GenMeshKnot(float radius, float size, int radSeg, int sides);
 RLAPI Mesh GenMeshHeightmap(Image heightmap, Vector3 size);                                 // Generate heightmap mesh from image data
 RLAPI Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize);                               // Generate cubes-based map mesh from image data
 
+// Terrain management functions
+RLAPI Terrain LoadTerrain(Image heightmap, Vector3 size, int chunkSize, int lodCount);      // Load terrain from heightmap image (indexed chunks meshes with skirts and levels of detail)
+RLAPI void UnloadTerrain(Terrain terrain);                                                  // Unload terrain chunks meshes and material maps
+RLAPI void DrawTerrain(Terrain terrain, Vector3 position, Color tint);                      // Draw terrain chunks (frustum culled), level of detail by chunk distance to camera
+
 // Material loading/unloading functions
 RLAPI Material *LoadMaterials(const char *fileName, int *materialCount);                    // Load materials from model file
 RLAPI Material LoadMaterialDefault(void);                                                   // Load default material (Supports: DIFFUSE, SPECULAR, NORMAL maps)
@@ -1558,6 +1638,7 @@ RLAPI void SetModelMeshMaterial(Model *model, int meshId, int materialId);
 // Model animations loading/unloading functions
 RLAPI ModelAnimation *LoadModelAnimations(const char *fileName, int *animCount);            // Load model animations from file
 RLAPI void UpdateModelAnimation(Model model, ModelAnimation anim, int frame);               // Update model animation pose
+RLAPI void UpdateModelAnimationVertices(Model model, ModelAnimation anim, int frame);       // Update model animation pose vertex data on CPU (animVertices), also for GPU skinned meshes
 RLAPI void UnloadModelAnimation(ModelAnimation anim);                                       // Unload animation data
 RLAPI void UnloadModelAnimations(ModelAnimation *animations, int animCount);                // Unload animation array data
 RLAPI bool IsModelAnimationValid(Model model, ModelAnimation anim);                         // Check model animation skeleton match
@@ -27,6 +27,15 @@
 *           Define static inline functions code, so #include header suffices for use.
 *           This may use up lots of memory.
 *
+*       #define RAYMATH_SIMD
+*           Use SIMD intrinsics (SSE on x86/x64) for batch functions (Vector3TransformArray(), MatrixMultiplyArray()).
+*           Operations order is kept, so results match scalar code (unless compiler contracts scalar code into FMA).
+*           Scalar code is used if target does not support them.
+*
+*       #define RAYMATH_SIMD_ENABLE_NEON
+*           Also use NEON intrinsics on ARM64 when RAYMATH_SIMD is defined.
+*           NOTE: Not enabled by default, NEON code has not been validated yet (examples/benchmarks/raymath_simd)
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -165,6 +174,17 @@ typedef struct float16 {
 
 #include <math.h>       // Required for: sinf(), cosf(), tan(), atan2f(), sqrtf(), floor(), fminf(), fmaxf(), fabs()
 
+// SIMD intrinsics (if requested and supported by target)
+#if defined(RAYMATH_SIMD)
+    #if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #define RAYMATH_SIMD_SSE
+        #include <xmmintrin.h>  // Required for: SSE intrinsics
+    #elif defined(RAYMATH_SIMD_ENABLE_NEON) && ((defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64))
+        #define RAYMATH_SIMD_NEON
+        #include <arm_neon.h>   // Required for: NEON intrinsics
+    #endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utils math
 //----------------------------------------------------------------------------------
@@ -809,6 +829,76 @@ RMAPI Vector3 Vector3Transform(Vector3 v, Matrix mat)
     return result;
 }
 
+// Transforms an array of Vector3 by a given Matrix
+// NOTE: Source and result arrays can be the same array
+RMAPI void Vector3TransformArray(Vector3 *result, const Vector3 *v, int count, Matrix mat)
+{
+    int i = 0;
+
+#if defined(RAYMATH_SIMD_SSE)
+    // Vectors are processed in groups of 4, converted to (x, y, z) lanes and back
+    __m128 m0 = _mm_set1_ps(mat.m0), m4 = _mm_set1_ps(mat.m4), m8 = _mm_set1_ps(mat.m8), m12 = _mm_set1_ps(mat.m12);
+    __m128 m1 = _mm_set1_ps(mat.m1), m5 = _mm_set1_ps(mat.m5), m9 = _mm_set1_ps(mat.m9), m13 = _mm_set1_ps(mat.m13);
+    __m128 m2 = _mm_set1_ps(mat.m2), m6 = _mm_set1_ps(mat.m6), m10 = _mm_set1_ps(mat.m10), m14 = _mm_set1_ps(mat.m14);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const float *src = &v[i].x;
+        float *dst = &result[i].x;
+
+        __m128 v0 = _mm_loadu_ps(src);          // x0 y0 z0 x1
+        __m128 v1 = _mm_loadu_ps(src + 4);      // y1 z1 x2 y2
+        __m128 v2 = _mm_loadu_ps(src + 8);      // z2 x3 y3 z3
+
+        __m128 t0 = _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(2, 1, 3, 2));    // x2 y2 x3 y3
+        __m128 t1 = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(1, 0, 2, 1));    // y0 z0 y1 z1
+        __m128 x = _mm_shuffle_ps(v0, t0, _MM_SHUFFLE(2, 0, 3, 0));
+        __m128 y = _mm_shuffle_ps(t1, t0, _MM_SHUFFLE(3, 1, 2, 0));
+        __m128 z = _mm_shuffle_ps(t1, v2, _MM_SHUFFLE(3, 0, 3, 1));
+
+        __m128 rx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, x), _mm_mul_ps(m4, y)), _mm_mul_ps(m8, z)), m12);
+        __m128 ry = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, x), _mm_mul_ps(m5, y)), _mm_mul_ps(m9, z)), m13);
+        __m128 rz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, x), _mm_mul_ps(m6, y)), _mm_mul_ps(m10, z)), m14);
+
+        __m128 xy = _mm_shuffle_ps(rx, ry, _MM_SHUFFLE(1, 0, 1, 0));    // x0 x1 y0 y1
+        __m128 zx = _mm_shuffle_ps(rz, rx, _MM_SHUFFLE(1, 1, 0, 0));    // z0 z0 x1 x1
+        __m128 yz = _mm_shuffle_ps(ry, rz, _MM_SHUFFLE(2, 1, 2, 1));    // y1 y2 z1 z2
+        __m128 xy2 = _mm_shuffle_ps(rx, ry, _MM_SHUFFLE(2, 2, 2, 2));   // x2 x2 y2 y2
+        __m128 zx3 = _mm_shuffle_ps(rz, rx, _MM_SHUFFLE(3, 3, 2, 2));   // z2 z2 x3 x3
+        __m128 yz3 = _mm_shuffle_ps(ry, rz, _MM_SHUFFLE(3, 3, 3, 3));   // y3 y3 z3 z3
+
+        _mm_storeu_ps(dst, _mm_shuffle_ps(xy, zx, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(dst + 4, _mm_shuffle_ps(yz, xy2, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(dst + 8, _mm_shuffle_ps(zx3, yz3, _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+#elif defined(RAYMATH_SIMD_NEON)
+    // Vectors are processed in groups of 4, loaded as (x, y, z) lanes
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t p = vld3q_f32(&v[i].x);
+        float32x4x3_t r = { 0 };
+
+        r.val[0] = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(p.val[0], mat.m0), vmulq_n_f32(p.val[1], mat.m4)), vmulq_n_f32(p.val[2], mat.m8)), vdupq_n_f32(mat.m12));
+        r.val[1] = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(p.val[0], mat.m1), vmulq_n_f32(p.val[1], mat.m5)), vmulq_n_f32(p.val[2], mat.m9)), vdupq_n_f32(mat.m13));
+        r.val[2] = vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(p.val[0], mat.m2), vmulq_n_f32(p.val[1], mat.m6)), vmulq_n_f32(p.val[2], mat.m10)), vdupq_n_f32(mat.m14));
+
+        vst3q_f32(&result[i].x, r);
+    }
+#endif
+
+    // Remaining vectors (or all of them without SIMD)
+    for (; i < count; i++)
+    {
+        float x = v[i].x;
+        float y = v[i].y;
+        float z = v[i].z;
+
+        result[i].x = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
+        result[i].y = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
+        result[i].z = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+    }
+}
+
 // Transform a vector by quaternion rotation
 RMAPI Vector3 Vector3RotateByQuaternion(Vector3 v, Quaternion q)
 {
@@ -1328,6 +1418,66 @@ RMAPI Matrix MatrixMultiply(Matrix left, Matrix right)
     return result;
 }
 
+// Get multiplication of arrays of matrices: result[i] = left[i]*right[i]
+// NOTE: Result array can be the same as one of the source arrays
+RMAPI void MatrixMultiplyArray(Matrix *result, const Matrix *left, const Matrix *right, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        const float *l = &left[i].m0;
+        const float *r = &right[i].m0;
+        float *m = &result[i].m0;
+
+#if defined(RAYMATH_SIMD_SSE)
+        __m128 row0 = _mm_loadu_ps(l);
+        __m128 row1 = _mm_loadu_ps(l + 4);
+        __m128 row2 = _mm_loadu_ps(l + 8);
+        __m128 row3 = _mm_loadu_ps(l + 12);
+        __m128 rows[4];
+
+        for (int k = 0; k < 4; k++)
+        {
+            rows[k] = _mm_mul_ps(row0, _mm_set1_ps(r[k*4]));
+            rows[k] = _mm_add_ps(rows[k], _mm_mul_ps(row1, _mm_set1_ps(r[k*4 + 1])));
+            rows[k] = _mm_add_ps(rows[k], _mm_mul_ps(row2, _mm_set1_ps(r[k*4 + 2])));
+            rows[k] = _mm_add_ps(rows[k], _mm_mul_ps(row3, _mm_set1_ps(r[k*4 + 3])));
+        }
+
+        for (int k = 0; k < 4; k++) _mm_storeu_ps(m + k*4, rows[k]);
+#elif defined(RAYMATH_SIMD_NEON)
+        float32x4_t row0 = vld1q_f32(l);
+        float32x4_t row1 = vld1q_f32(l + 4);
+        float32x4_t row2 = vld1q_f32(l + 8);
+        float32x4_t row3 = vld1q_f32(l + 12);
+        float32x4_t rows[4];
+
+        for (int k = 0; k < 4; k++)
+        {
+            rows[k] = vmulq_n_f32(row0, r[k*4]);
+            rows[k] = vaddq_f32(rows[k], vmulq_n_f32(row1, r[k*4 + 1]));
+            rows[k] = vaddq_f32(rows[k], vmulq_n_f32(row2, r[k*4 + 2]));
+            rows[k] = vaddq_f32(rows[k], vmulq_n_f32(row3, r[k*4 + 3]));
+        }
+
+        for (int k = 0; k < 4; k++) vst1q_f32(m + k*4, rows[k]);
+#else
+        // NOTE: Matrix memory layout is [m0 m4 m8 m12 m1 m5 m9 m13 ...], result is computed
+        // before writing, so source and result can be the same array
+        float mat[16] = { 0 };
+
+        for (int row = 0; row < 4; row++)
+        {
+            for (int col = 0; col < 4; col++)
+            {
+                mat[row*4 + col] = l[col]*r[row*4] + l[4 + col]*r[row*4 + 1] + l[8 + col]*r[row*4 + 2] + l[12 + col]*r[row*4 + 3];
+            }
+        }
+
+        for (int k = 0; k < 16; k++) m[k] = mat[k];
+#endif
+    }
+}
+
 // Get translation matrix
 RMAPI Matrix MatrixTranslate(float x, float y, float z)
 {
@@ -175,11 +175,13 @@ __declspec(dllimport) int __stdcall WideCharToMultiByte(unsigned int cp, unsigne
     #include <direct.h>             // Required for: _getch(), _chdir()
     #define GETCWD _getcwd          // NOTE: MSDN recommends not to use getcwd(), chdir()
     #define CHDIR _chdir
+    #define MKDIR(dir) _mkdir(dir)
     #include <io.h>                 // Required for: _access() [Used in FileExists()]
 #else
     #include <unistd.h>             // Required for: getch(), chdir() (POSIX), access()
     #define GETCWD getcwd
     #define CHDIR chdir
+    #define MKDIR(dir) mkdir(dir, 0755)
 #endif
 
 //----------------------------------------------------------------------------------
@@ -196,6 +198,12 @@ __declspec(dllimport) int __stdcall WideCharToMultiByte(unsigned int cp, unsigne
     #endif
 #endif
 
+#ifndef MAX_DAMAGE_RECTS
+    #define MAX_DAMAGE_RECTS               8        // Maximum number of screen regions changed by frame (merged if exceeded)
+#endif
+#ifndef MAX_DAMAGE_HISTORY
+    #define MAX_DAMAGE_HISTORY             4        // Maximum number of previous frames regions kept (redrawn depending on back buffer age)
+#endif
 #ifndef MAX_KEYBOARD_KEYS
     #define MAX_KEYBOARD_KEYS            512        // Maximum number of keyboard keys supported
 #endif
@@ -229,6 +237,10 @@ __declspec(dllimport) int __stdcall WideCharToMultiByte(unsigned int cp, unsigne
     #define MAX_AUTOMATION_EVENTS      16384        // Maximum number of automation events to record
 #endif
 
+#ifndef SHADER_CACHE_FILE_EXT
+    #define SHADER_CACHE_FILE_EXT      ".shadercache"   // Shader program binary cache file extension, in "<userCacheDir>/raylib/shaders"
+#endif
+
 // Flags operation macros
 #define FLAG_SET(n, f) ((n) |= (f))
 #define FLAG_CLEAR(n, f) ((n) &= ~(f))
@@ -359,6 +371,19 @@ bool gifRecording = false;           // GIF recording state
 MsfGifState gifState = { 0 };        // MSGIF context state
 #endif
 
+#if defined(SUPPORT_DAMAGE_TRACKING)
+static bool damageTracking = false;                     // Damage tracking enabled
+static Rectangle damageRects[MAX_DAMAGE_RECTS] = { 0 }; // Screen regions changed, for next frame (screen coordinates)
+static int damageRectCount = 0;                         // Screen regions changed count, for next frame
+static Rectangle frameDamage[MAX_DAMAGE_RECTS] = { 0 }; // Screen regions changed on current frame, presented (screen coordinates)
+static int frameDamageCount = 0;                        // Screen regions changed count on current frame, not presented if 0
+static Rectangle damageHistory[MAX_DAMAGE_HISTORY] = { 0 };  // Screen regions changed bounds of previous frames presented (most recent first)
+static int damageHistoryCount = 0;                      // Previous frames presented with known screen regions changed
+static Rectangle damageScissor = { 0 };                 // Current frame redrawn region (framebuffer pixels, origin bottom-left)
+static bool damageScissorActive = false;                // Current frame drawing limited to redrawn region
+static double damageFramePeriod = 0.0;                  // Frame period for frames not presented, display refresh period (seconds)
+#endif
+
 #if defined(SUPPORT_AUTOMATION_EVENTS)
 // Automation events type
 typedef enum AutomationEventType {
@@ -457,12 +482,24 @@ extern void LoadFontDefault(void);      // [Module: text] Loads default font on
 extern void UnloadFontDefault(void);    // [Module: text] Unloads default font from GPU memory
 #endif
 
+#if defined(SUPPORT_MODULE_RMODELS)
+extern void UnloadModelLoads(void);     // [Module: models] Unloads asynchronous model loads, joins worker threads
+#endif
+
 extern int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 extern void ClosePlatform(void);        // Close platform
+#if defined(SUPPORT_DAMAGE_TRACKING)
+extern int GetScreenBufferAge(void);    // Get back buffer age (frames since its content was presented), 0 if unknown
+#endif
 
 static void InitTimer(void);                                // Initialize timer, hi-resolution if available (required by InitPlatform())
 static void SetupFramebuffer(int width, int height);        // Setup main framebuffer (required by InitPlatform())
 static void SetupViewport(int width, int height);           // Set viewport for a provided width and height
+#if defined(SUPPORT_DAMAGE_TRACKING)
+static void BeginFrameDamage(void);                         // Begin frame damage: set region redrawn, limiting drawing (scissor)
+static void EndFrameDamage(void);                           // End frame damage: keep regions changed for next frames
+int GetScreenDamageRects(int *rects);                       // Get current frame regions changed to be presented (framebuffer pixels, origin bottom-left)
+#endif
 
 static void ScanDirectoryFiles(const char *basePath, FilePathList *list, const char *filter);   // Scan all files and directories in a base path
 static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *list, const char *filter);  // Scan all files and directories recursively from a base path
@@ -471,6 +508,18 @@ static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *li
 static void RecordAutomationEvent(void); // Record frame events (to internal events array)
 #endif
 
+#if defined(SUPPORT_SHADER_CACHE) || defined(SUPPORT_FONT_CACHE)
+static bool LoadCacheDirectory(char *directory, const char *name);         // Load raylib cache directory path for name (created if required)
+#endif
+#if defined(SUPPORT_FONT_CACHE)
+const char *GetFontCacheDirectory(void);                                    // Get font cache directory (created if required), NULL if not available
+#endif
+#if defined(SUPPORT_SHADER_CACHE)
+static const char *GetShaderCacheDirectory(void);                           // Get shader cache directory (created if required), NULL if not available
+static unsigned char *LoadShaderCache(const char *name, int *dataSize);     // Load shader program binary from cache file (rlgl callback)
+static void SaveShaderCache(const char *name, const unsigned char *data, int dataSize);  // Save shader program binary to cache file (rlgl callback)
+#endif
+
 #if defined(_WIN32)
 // NOTE: We declare Sleep() function symbol to avoid including windows.h (kernel32.lib linkage required)
 void __stdcall Sleep(unsigned long msTimeout);              // Required for: WaitTime()
@@ -613,6 +662,11 @@ void InitWindow(int width, int height, const char *title)
     InitPlatform();
     //--------------------------------------------------------------
 
+#if defined(SUPPORT_SHADER_CACHE)
+    // Setup shader programs binary cache, set before rlglInit() to also cache default shader
+    rlSetShaderCacheCallbacks(LoadShaderCache, SaveShaderCache);
+#endif
+
     // Initialize rlgl default data (buffers and shaders)
     // NOTE: CORE.Window.currentFbo.width and CORE.Window.currentFbo.height not used, just stored as globals in rlgl
     rlglInit(CORE.Window.currentFbo.width, CORE.Window.currentFbo.height);
@@ -680,6 +734,12 @@ void CloseWindow(void)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
 
+#if defined(SUPPORT_MODULE_RMODELS)
+    UnloadModelLoads();         // WARNING: Module required: rmodels
+#endif
+
+    CloseWorkerPool();          // Join worker threads, queued work is finished
+
     rlglClose();                // De-init rlgl
 
     // De-initialize platform
@@ -827,6 +887,10 @@ void BeginDrawing(void)
 
     //rlTranslatef(0.375, 0.375, 0);    // HACK to have 2D pixel-perfect drawing on OpenGL 1.1
                                         // NOTE: Not required with OpenGL 3.3+
+
+#if defined(SUPPORT_DAMAGE_TRACKING)
+    if (damageTracking) BeginFrameDamage();     // Drawing limited to screen regions to be redrawn
+#endif
 }
 
 // End canvas drawing and swap buffers (double buffering)
@@ -834,6 +898,10 @@ void EndDrawing(void)
 {
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
+#if defined(SUPPORT_DAMAGE_TRACKING)
+    if (damageTracking) EndFrameDamage();
+#endif
+
 #if defined(SUPPORT_GIF_RECORDING)
     // Draw record indicator
     if (gifRecording)
@@ -869,8 +937,19 @@ void EndDrawing(void)
     if (automationEventRecording) RecordAutomationEvent();    // Event recording
 #endif
 
+    rlUpdateFrameStats();           // Finish frame rendering statistics: DrawFrameStats()
+
 #if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
+    double frameTarget = CORE.Time.target;
+
+#if defined(SUPPORT_DAMAGE_TRACKING)
+    // Frames with no screen regions changed are not presented,
+    // frame time is kept to display refresh period if no target FPS is set
+    if (!damageTracking || (frameDamageCount > 0)) SwapScreenBuffer();
+    else if (frameTarget <= 0.0) frameTarget = damageFramePeriod;
+#else
     SwapScreenBuffer();                  // Copy back buffer to front buffer (screen)
+#endif
 
     // Frame time control system
     CORE.Time.current = GetTime();
@@ -880,9 +959,9 @@ void EndDrawing(void)
     CORE.Time.frame = CORE.Time.update + CORE.Time.draw;
 
     // Wait for some milliseconds...
-    if (CORE.Time.frame < CORE.Time.target)
+    if (CORE.Time.frame < frameTarget)
     {
-        WaitTime(CORE.Time.target - CORE.Time.frame);
+        WaitTime(frameTarget - CORE.Time.frame);
 
         CORE.Time.current = GetTime();
         double waitTime = CORE.Time.current - CORE.Time.previous;
@@ -1042,6 +1121,10 @@ void BeginTextureMode(RenderTexture2D target)
     CORE.Window.currentFbo.width = target.texture.width;
     CORE.Window.currentFbo.height = target.texture.height;
     CORE.Window.usingFbo = true;
+
+#if defined(SUPPORT_DAMAGE_TRACKING)
+    if (damageScissorActive) rlDisableScissorTest();    // Render texture drawing is not limited to screen redrawn region
+#endif
 }
 
 // Ends drawing to render texture
@@ -1058,6 +1141,14 @@ void EndTextureMode(void)
     CORE.Window.currentFbo.width = CORE.Window.render.width;
     CORE.Window.currentFbo.height = CORE.Window.render.height;
     CORE.Window.usingFbo = false;
+
+#if defined(SUPPORT_DAMAGE_TRACKING)
+    if (damageScissorActive)
+    {
+        rlEnableScissorTest();      // Screen drawing limited to redrawn region again
+        rlScissor((int)damageScissor.x, (int)damageScissor.y, (int)damageScissor.width, (int)damageScissor.height);
+    }
+#endif
 }
 
 // Begin custom shader mode
@@ -1093,32 +1184,144 @@ void BeginScissorMode(int x, int y, int width, int height)
 
     rlEnableScissorTest();
 
+    int scissor[4] = { x, CORE.Window.currentFbo.height - (y + height), width, height };
+
 #if defined(__APPLE__)
     if (!CORE.Window.usingFbo)
     {
         Vector2 scale = GetWindowScaleDPI();
-        rlScissor((int)(x*scale.x), (int)(GetScreenHeight()*scale.y - (((y + height)*scale.y))), (int)(width*scale.x), (int)(height*scale.y));
+        scissor[0] = (int)(x*scale.x);
+        scissor[1] = (int)(GetScreenHeight()*scale.y - (((y + height)*scale.y)));
+        scissor[2] = (int)(width*scale.x);
+        scissor[3] = (int)(height*scale.y);
     }
 #else
     if (!CORE.Window.usingFbo && ((CORE.Window.flags & FLAG_WINDOW_HIGHDPI) > 0))
     {
         Vector2 scale = GetWindowScaleDPI();
-        rlScissor((int)(x*scale.x), (int)(CORE.Window.currentFbo.height - (y + height)*scale.y), (int)(width*scale.x), (int)(height*scale.y));
+        scissor[0] = (int)(x*scale.x);
+        scissor[1] = (int)(CORE.Window.currentFbo.height - (y + height)*scale.y);
+        scissor[2] = (int)(width*scale.x);
+        scissor[3] = (int)(height*scale.y);
     }
 #endif
-    else
+
+#if defined(SUPPORT_DAMAGE_TRACKING)
+    // Scissor area is also limited to screen redrawn region
+    if (damageScissorActive && !CORE.Window.usingFbo)
     {
-        rlScissor(x, CORE.Window.currentFbo.height - (y + height), width, height);
+        int x0 = (scissor[0] > (int)damageScissor.x)? scissor[0] : (int)damageScissor.x;
+        int y0 = (scissor[1] > (int)damageScissor.y)? scissor[1] : (int)damageScissor.y;
+        int x1 = ((scissor[0] + scissor[2]) < (int)(damageScissor.x + damageScissor.width))? (scissor[0] + scissor[2]) : (int)(damageScissor.x + damageScissor.width);
+        int y1 = ((scissor[1] + scissor[3]) < (int)(damageScissor.y + damageScissor.height))? (scissor[1] + scissor[3]) : (int)(damageScissor.y + damageScissor.height);
+
+        scissor[0] = x0;
+        scissor[1] = y0;
+        scissor[2] = (x1 > x0)? (x1 - x0) : 0;
+        scissor[3] = (y1 > y0)? (y1 - y0) : 0;
     }
+#endif
+
+    rlScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
 }
 
 // End scissor mode
 void EndScissorMode(void)
 {
     rlDrawRenderBatchActive();      // Update and draw internal render batch
+
+#if defined(SUPPORT_DAMAGE_TRACKING)
+    // Screen drawing remains limited to redrawn region
+    if (damageScissorActive && !CORE.Window.usingFbo)
+    {
+        rlScissor((int)damageScissor.x, (int)damageScissor.y, (int)damageScissor.width, (int)damageScissor.height);
+        return;
+    }
+#endif
+
     rlDisableScissorTest();
 }
 
+// Begin 2D draw sorting mode (non-overlapping draws merged by texture)
+// NOTE: Draws only change order if they do not overlap on screen, interleaved text and shapes
+// drawing (i.e. UI controls) is merged into less draw calls, not intended for 3D drawing
+void BeginDrawSortMode(void)
+{
+    rlEnableRenderBatchSorting();   // Internal render batch is drawn before
+}
+
+// End 2D draw sorting mode
+void EndDrawSortMode(void)
+{
+    rlDisableRenderBatchSorting();  // Internal render batch is drawn (sorted) before
+}
+
+// Enable damage tracking, only screen regions changed are redrawn and presented
+// NOTE: Screen regions changed must be added with AddScreenDamage() before BeginDrawing(), drawing
+// is limited to those regions (scissor) and frames with no regions changed are not presented
+void EnableDamageTracking(void)
+{
+#if defined(SUPPORT_DAMAGE_TRACKING)
+    damageTracking = true;
+    damageRectCount = 0;
+    damageHistoryCount = 0;
+
+    // Frames not presented are not paced by swap interval (vsync), they wait for display refresh period
+    int refreshRate = GetMonitorRefreshRate(GetCurrentMonitor());
+    damageFramePeriod = 1.0/(double)((refreshRate > 0)? refreshRate : 60);
+
+    AddScreenDamage((Rectangle){ 0, 0, (float)CORE.Window.screen.width, (float)CORE.Window.screen.height });
+#else
+    TRACELOG(LOG_WARNING, "SYSTEM: Damage tracking not supported, enable SUPPORT_DAMAGE_TRACKING");
+#endif
+}
+
+// Disable damage tracking, full screen redrawn and presented every frame
+void DisableDamageTracking(void)
+{
+#if defined(SUPPORT_DAMAGE_TRACKING)
+    damageTracking = false;
+    damageRectCount = 0;
+    damageHistoryCount = 0;
+#endif
+}
+
+// Add screen region changed, to be redrawn and presented on next frame (damage tracking)
+void AddScreenDamage(Rectangle rec)
+{
+#if defined(SUPPORT_DAMAGE_TRACKING)
+    if (!damageTracking) return;
+
+    // Region is clipped to screen
+    float x0 = (rec.x > 0.0f)? rec.x : 0.0f;
+    float y0 = (rec.y > 0.0f)? rec.y : 0.0f;
+    float x1 = ((rec.x + rec.width) < (float)CORE.Window.screen.width)? (rec.x + rec.width) : (float)CORE.Window.screen.width;
+    float y1 = ((rec.y + rec.height) < (float)CORE.Window.screen.height)? (rec.y + rec.height) : (float)CORE.Window.screen.height;
+
+    if ((x1 <= x0) || (y1 <= y0)) return;
+
+    rec = (Rectangle){ x0, y0, x1 - x0, y1 - y0 };
+
+    if (damageRectCount < MAX_DAMAGE_RECTS)
+    {
+        damageRects[damageRectCount] = rec;
+        damageRectCount++;
+    }
+    else
+    {
+        // Regions limit reached, region is merged with last one
+        Rectangle *last = &damageRects[MAX_DAMAGE_RECTS - 1];
+        float lx1 = ((last->x + last->width) > x1)? (last->x + last->width) : x1;
+        float ly1 = ((last->y + last->height) > y1)? (last->y + last->height) : y1;
+
+        if (x0 < last->x) last->x = x0;
+        if (y0 < last->y) last->y = y0;
+        last->width = lx1 - last->x;
+        last->height = ly1 - last->y;
+    }
+#endif
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: VR Stereo Rendering
 //----------------------------------------------------------------------------------
@@ -1275,6 +1478,8 @@ Shader LoadShaderFromMemory(const char *vsCode, const char *fsCode)
         shader.locs[SHADER_LOC_VERTEX_NORMAL] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
         shader.locs[SHADER_LOC_VERTEX_TANGENT] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
         shader.locs[SHADER_LOC_VERTEX_COLOR] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+        shader.locs[SHADER_LOC_VERTEX_BONEIDS] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS);
+        shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS);
 
         // Get handles to GLSL uniform locations (vertex shader)
         shader.locs[SHADER_LOC_MATRIX_MVP] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
@@ -1282,6 +1487,7 @@ Shader LoadShaderFromMemory(const char *vsCode, const char *fsCode)
         shader.locs[SHADER_LOC_MATRIX_PROJECTION] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION);
         shader.locs[SHADER_LOC_MATRIX_MODEL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL);
         shader.locs[SHADER_LOC_MATRIX_NORMAL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL);
+        shader.locs[SHADER_LOC_BONE_MATRICES] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES);
 
         // Get handles to GLSL uniform locations (fragment shader)
         shader.locs[SHADER_LOC_COLOR_DIFFUSE] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
@@ -3165,6 +3371,127 @@ void SetupFramebuffer(int width, int height)
     }
 }
 
+#if defined(SUPPORT_DAMAGE_TRACKING)
+// Get screen region in framebuffer pixels, origin bottom-left (as required by scissor and damage presentation)
+// NOTE: Region is expanded to pixel boundaries
+static Rectangle GetDamagePixels(Rectangle rec)
+{
+    Vector2 scale = { 1.0f, 1.0f };
+    float height = (float)CORE.Window.render.height;
+
+#if defined(__APPLE__)
+    scale = GetWindowScaleDPI();
+    height = (float)GetScreenHeight()*scale.y;
+#else
+    if ((CORE.Window.flags & FLAG_WINDOW_HIGHDPI) > 0) scale = GetWindowScaleDPI();
+#endif
+
+    float x0 = floorf(rec.x*scale.x);
+    float x1 = ceilf((rec.x + rec.width)*scale.x);
+    float y0 = floorf(height - (rec.y + rec.height)*scale.y);
+    float y1 = ceilf(height - rec.y*scale.y);
+
+    return (Rectangle){ x0, y0, x1 - x0, y1 - y0 };
+}
+
+// Begin frame damage: set region redrawn, limiting drawing (scissor)
+// NOTE: Region redrawn includes current frame regions changed and previous frames regions
+// changed since back buffer content was presented (back buffer age), full screen if unknown
+static void BeginFrameDamage(void)
+{
+    // Window resized, back buffer content is not valid
+    if (CORE.Window.resizedLastFrame)
+    {
+        damageHistoryCount = 0;
+        AddScreenDamage((Rectangle){ 0, 0, (float)CORE.Window.screen.width, (float)CORE.Window.screen.height });
+    }
+
+    // Screen regions changed for this frame
+    for (int i = 0; i < damageRectCount; i++) frameDamage[i] = damageRects[i];
+    frameDamageCount = damageRectCount;
+    damageRectCount = 0;
+
+    Rectangle region = { 0 };
+
+    if (frameDamageCount > 0)
+    {
+        int age = GetScreenBufferAge();
+
+        if ((age == 0) || ((age - 1) > damageHistoryCount)) region = (Rectangle){ 0, 0, (float)CORE.Window.screen.width, (float)CORE.Window.screen.height };
+        else
+        {
+            region = frameDamage[0];
+
+            for (int i = 1; i < (frameDamageCount + age - 1); i++)
+            {
+                Rectangle rec = (i < frameDamageCount)? frameDamage[i] : damageHistory[i - frameDamageCount];
+                float x1 = ((region.x + region.width) > (rec.x + rec.width))? (region.x + region.width) : (rec.x + rec.width);
+                float y1 = ((region.y + region.height) > (rec.y + rec.height))? (region.y + region.height) : (rec.y + rec.height);
+
+                if (rec.x < region.x) region.x = rec.x;
+                if (rec.y < region.y) region.y = rec.y;
+                region.width = x1 - region.x;
+                region.height = y1 - region.y;
+            }
+        }
+
+        damageScissor = GetDamagePixels(region);
+    }
+    else damageScissor = (Rectangle){ 0 };      // Nothing drawn, frame is not presented
+
+    rlEnableScissorTest();
+    rlScissor((int)damageScissor.x, (int)damageScissor.y, (int)damageScissor.width, (int)damageScissor.height);
+    damageScissorActive = true;
+}
+
+// End frame damage: keep regions changed for next frames
+static void EndFrameDamage(void)
+{
+    rlDisableScissorTest();
+    damageScissorActive = false;
+
+    if (frameDamageCount > 0)
+    {
+        // Keep current frame regions changed bounds, required if next back buffers are older
+        Rectangle bounds = frameDamage[0];
+
+        for (int i = 1; i < frameDamageCount; i++)
+        {
+            float x1 = ((bounds.x + bounds.width) > (frameDamage[i].x + frameDamage[i].width))? (bounds.x + bounds.width) : (frameDamage[i].x + frameDamage[i].width);
+            float y1 = ((bounds.y + bounds.height) > (frameDamage[i].y + frameDamage[i].height))? (bounds.y + bounds.height) : (frameDamage[i].y + frameDamage[i].height);
+
+            if (frameDamage[i].x < bounds.x) bounds.x = frameDamage[i].x;
+            if (frameDamage[i].y < bounds.y) bounds.y = frameDamage[i].y;
+            bounds.width = x1 - bounds.x;
+            bounds.height = y1 - bounds.y;
+        }
+
+        for (int i = MAX_DAMAGE_HISTORY - 1; i > 0; i--) damageHistory[i] = damageHistory[i - 1];
+        damageHistory[0] = bounds;
+        if (damageHistoryCount < MAX_DAMAGE_HISTORY) damageHistoryCount++;
+    }
+}
+
+// Get current frame regions changed to be presented (framebuffer pixels, origin bottom-left)
+// NOTE: Rectangles are stored as x, y, width, height (4 int per rectangle), returns 0 if not available
+int GetScreenDamageRects(int *rects)
+{
+    if (!damageTracking) return 0;
+
+    for (int i = 0; i < frameDamageCount; i++)
+    {
+        Rectangle pixels = GetDamagePixels(frameDamage[i]);
+
+        rects[i*4] = (int)pixels.x;
+        rects[i*4 + 1] = (int)pixels.y;
+        rects[i*4 + 2] = (int)pixels.width;
+        rects[i*4 + 3] = (int)pixels.height;
+    }
+
+    return frameDamageCount;
+}
+#endif
+
 // Scan all files and directories in a base path
 // WARNING: files.paths[] must be previously allocated and
 // contain enough space to store all required paths
@@ -3537,6 +3864,113 @@ static void RecordAutomationEvent(void)
 }
 #endif
 
+#if defined(SUPPORT_SHADER_CACHE) || defined(SUPPORT_FONT_CACHE)
+// Load raylib cache directory path for name: "<userCacheDir>/raylib/<name>" (created if required)
+// NOTE: User cache directory: %LOCALAPPDATA% (Windows), ~/Library/Caches (macOS), $XDG_CACHE_HOME or ~/.cache (Linux/BSD)
+static bool LoadCacheDirectory(char *directory, const char *name)
+{
+    const char *basePath = NULL;
+    const char *cachePath = "";
+
+    directory[0] = '\0';
+
+#if defined(_WIN32)
+    basePath = getenv("LOCALAPPDATA");
+#elif defined(__APPLE__)
+    basePath = getenv("HOME");
+    cachePath = "/Library/Caches";
+#elif defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__NetBSD__) || defined(__DragonFly__)
+    basePath = getenv("XDG_CACHE_HOME");
+    if ((basePath == NULL) || (basePath[0] == '\0'))
+    {
+        basePath = getenv("HOME");
+        cachePath = "/.cache";
+    }
+#endif
+
+    if ((basePath != NULL) && (basePath[0] != '\0'))
+    {
+        // NOTE: Every directory level is created (if required), failures are checked at the end
+        const char *subPaths[3] = { cachePath, "/raylib/", name };
+        int length = snprintf(directory, MAX_FILEPATH_LENGTH, "%s", basePath);
+
+        for (int i = 0; (i < 3) && (length < MAX_FILEPATH_LENGTH); i++)
+        {
+            length += snprintf(directory + length, MAX_FILEPATH_LENGTH - length, "%s", subPaths[i]);
+            if (length < MAX_FILEPATH_LENGTH) MKDIR(directory);
+        }
+
+        if ((length >= MAX_FILEPATH_LENGTH) || !DirectoryExists(directory)) directory[0] = '\0';
+    }
+
+    return (directory[0] != '\0');
+}
+#endif
+
+#if defined(SUPPORT_FONT_CACHE)
+// Get font cache directory (created if required), NULL if not available
+// NOTE: Used by rtext module, font assets directory could be read-only
+const char *GetFontCacheDirectory(void)
+{
+    static char directory[MAX_FILEPATH_LENGTH] = { 0 };
+    static bool checked = false;
+
+    if (!checked)
+    {
+        if (LoadCacheDirectory(directory, "fonts")) TRACELOG(LOG_INFO, "FONT: Font cache directory: %s", directory);
+        else TRACELOG(LOG_WARNING, "FONT: Font cache directory not available, fonts cache disabled");
+
+        checked = true;
+    }
+
+    return (directory[0] != '\0')? directory : NULL;
+}
+#endif
+
+#if defined(SUPPORT_SHADER_CACHE)
+// Get shader cache directory (created if required), NULL if not available
+static const char *GetShaderCacheDirectory(void)
+{
+    static char directory[MAX_FILEPATH_LENGTH] = { 0 };
+    static bool checked = false;
+
+    if (!checked)
+    {
+        if (LoadCacheDirectory(directory, "shaders")) TRACELOG(LOG_INFO, "SHADER: Shader cache directory: %s", directory);
+        else TRACELOG(LOG_WARNING, "SHADER: Shader cache directory not available, shaders cache disabled");
+
+        checked = true;
+    }
+
+    return (directory[0] != '\0')? directory : NULL;
+}
+
+// Load shader program binary from cache file (rlgl callback)
+static unsigned char *LoadShaderCache(const char *name, int *dataSize)
+{
+    unsigned char *data = NULL;
+    const char *directory = GetShaderCacheDirectory();
+
+    if (directory != NULL)
+    {
+        const char *fileName = TextFormat("%s/%s" SHADER_CACHE_FILE_EXT, directory, name);
+
+        // NOTE: Missing cache file is expected on first launch, no warning required
+        if (FileExists(fileName)) data = LoadFileData(fileName, dataSize);
+    }
+
+    return data;
+}
+
+// Save shader program binary to cache file (rlgl callback)
+static void SaveShaderCache(const char *name, const unsigned char *data, int dataSize)
+{
+    const char *directory = GetShaderCacheDirectory();
+
+    if (directory != NULL) SaveFileData(TextFormat("%s/%s" SHADER_CACHE_FILE_EXT, directory, name), (void *)data, dataSize);
+}
+#endif
+
 #if !defined(SUPPORT_MODULE_RTEXT)
 // Formatting of text with variables to 'embed'
 // WARNING: String returned will expire after this function is called MAX_TEXTFORMAT_BUFFERS times
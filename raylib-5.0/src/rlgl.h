@@ -17,6 +17,11 @@
 *          - Default batch (RLGL.defaultBatch): RenderBatch system to accumulate vertex data
 *          - Default texture (RLGL.defaultTextureId): 1x1 white pixel R8G8B8A8
 *          - Default shader (RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs)
+*          - SDF text shader (RLGL.State.sdfShaderId, RLGL.State.sdfShaderLocs), loaded on first use
+*          - SDF shapes shader (RLGL.State.sdfShapesShaderId, RLGL.State.sdfShapesShaderLocs) and texture (RLGL.State.sdfShapesTextureId), loaded on first use
+*          - Skinning shader (RLGL.State.skinningShaderId, RLGL.State.skinningShaderLocs), loaded on first use
+*          - Instancing shader (RLGL.State.instancingShaderId, RLGL.State.instancingShaderLocs), loaded on first use
+*          - Streamed vertex buffer (RLGL.State.streamBufferId), reused by every rlUpdateVertexBufferStream() call
 *
 *       Internal buffer (and resources) must be manually unloaded calling rlglClose().
 *
@@ -46,6 +51,14 @@
 *       #define RLGL_ENABLE_OPENGL_DEBUG_CONTEXT
 *           Enable debug context (only available on OpenGL 4.3)
 *
+*       #define RLGL_RENDER_BATCH_INTERLEAVED
+*           Store render batch vertex data interleaved (position + texcoords + color, 24 bytes per vertex),
+*           one vertex buffer is updated per batch draw instead of three
+*
+*       Display lists: render batch draws issued between rlBeginDisplayList() and rlEndDisplayList() are not
+*       drawn but recorded into static vertex/index buffers, rlDrawDisplayList() replays them with one draw call
+*       by mode/texture/shader change, useful for static 2D content (i.e. UI) drawn every frame
+*
 *       rlgl capabilities could be customized just defining some internal
 *       values before library inclusion (default values listed):
 *
@@ -53,9 +66,13 @@
 *       #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
 *       #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
 *       #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
+*       #define RL_DEFAULT_STREAM_BUFFER_SIZE    262144    // Default streamed vertex buffer size in bytes (grown if required)
+*       #define RL_GPU_TIMER_FRAMES                   3    // Frames of GPU timer queries in flight, results are read with latency to avoid stalls
+*       #define RL_GPU_TIMER_QUERIES                 32    // Maximum GPU timer queries by frame (one by render batch draw)
 *
 *       #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal Matrix stack
 *       #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
+*       #define RL_MAX_SHADER_BONES                  64    // Maximum number of bone matrices supported by skinning shader (also limited by vertex uniforms)
 *       #define RL_CULL_DISTANCE_NEAR              0.01    // Default projection matrix near cull distance
 *       #define RL_CULL_DISTANCE_FAR             1000.0    // Default projection matrix far cull distance
 *
@@ -68,12 +85,16 @@
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR        "vertexColor"       // Bound by default to shader location: 3
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT      "vertexTangent"     // Bound by default to shader location: 4
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: 5
+*       #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS      "vertexBoneIds"     // Bound by default to shader location: 6
+*       #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS  "vertexBoneWeights" // Bound by default to shader location: 7
+*       #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TX  "instanceTransform" // Bound by default to shader location: 8 (mat4, locations 8 to 11)
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION  "matProjection"     // projection matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL       "matModel"          // model matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL      "matNormal"         // normal matrix (transpose(inverse(matModelView))
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR       "colDiffuse"        // color diffuse (base tint color, multiplied by texture color)
+*       #define RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES "boneMatrices"    // bone matrices array (skinning)
 *       #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0  "texture0"          // texture0 (texture slot active 0)
 *       #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1  "texture1"          // texture1 (texture slot active 1)
 *       #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
@@ -217,6 +238,17 @@
 #ifndef RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
     #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 #endif
+#ifndef RL_DEFAULT_STREAM_BUFFER_SIZE
+    #define RL_DEFAULT_STREAM_BUFFER_SIZE       262144      // Default streamed vertex buffer size in bytes (grown if required)
+#endif
+
+// GPU timer queries
+#ifndef RL_GPU_TIMER_FRAMES
+    #define RL_GPU_TIMER_FRAMES                      3      // Frames of GPU timer queries in flight, results are read with latency to avoid stalls
+#endif
+#ifndef RL_GPU_TIMER_QUERIES
+    #define RL_GPU_TIMER_QUERIES                    32      // Maximum GPU timer queries by frame (one by render batch draw)
+#endif
 
 // Internal Matrix stack
 #ifndef RL_MAX_MATRIX_STACK_SIZE
@@ -227,6 +259,16 @@
 #ifndef RL_MAX_SHADER_LOCATIONS
     #define RL_MAX_SHADER_LOCATIONS                 32      // Maximum number of shader locations supported
 #endif
+#ifndef RL_MAX_SHADER_BONES
+    #if defined(GRAPHICS_API_OPENGL_ES2)
+        #define RL_MAX_SHADER_BONES                 24      // Maximum number of bone matrices supported by skinning shader (128 vertex uniform vectors min)
+    #else
+        #define RL_MAX_SHADER_BONES                 64      // Maximum number of bone matrices supported by skinning shader
+    #endif
+#endif
+#ifndef RL_SHADER_RESERVED_UNIFORMS
+    #define RL_SHADER_RESERVED_UNIFORMS              8      // Vertex uniform vectors not available for skinning shader bones (mvp and driver internal uniforms)
+#endif
 
 // Projection matrix culling
 #ifndef RL_CULL_DISTANCE_NEAR
@@ -340,13 +382,25 @@ typedef struct Matrix {
 #define RL_MATRIX_TYPE
 #endif
 
+// Render batch interleaved vertex (24 bytes)
+// NOTE: Used by render batch if RLGL_RENDER_BATCH_INTERLEAVED and always by display lists
+typedef struct rlBatchVertex {
+    float position[3];          // Vertex position (XYZ) (shader-location = 0)
+    float texcoord[2];          // Vertex texture coordinates (UV) (shader-location = 1)
+    unsigned char color[4];     // Vertex color (RGBA) (shader-location = 3)
+} rlBatchVertex;
+
 // Dynamic vertex buffers (position + texcoords + colors + indices arrays)
 typedef struct rlVertexBuffer {
     int elementCount;           // Number of elements in the buffer (QUADS)
 
+#if defined(RLGL_RENDER_BATCH_INTERLEAVED)
+    rlBatchVertex *vertexData;  // Vertex data interleaved (position + texcoords + color), uploaded to vboId[0]
+#else
     float *vertices;            // Vertex position (XYZ - 3 components per vertex) (shader-location = 0)
     float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
     unsigned char *colors;      // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
+#endif
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
     unsigned int *indices;      // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
@@ -384,6 +438,56 @@ typedef struct rlRenderBatch {
     float currentDepth;         // Current depth value for next draw
 } rlRenderBatch;
 
+// rlQuadBuffer type, quads reserved on render batch to be written directly
+// NOTE: Quad vertex are ordered: top-left, bottom-left, bottom-right, top-right,
+// vertex data could be interleaved (RLGL_RENDER_BATCH_INTERLEAVED), use strides to access vertex attributes
+typedef struct rlQuadBuffer {
+    float *vertices;            // Quads first vertex position (XYZ - 3 components per vertex, 4 vertex per quad)
+    float *texcoords;           // Quads first vertex texture coordinates (UV - 2 components per vertex, 4 vertex per quad)
+    unsigned char *colors;      // Quads first vertex color (RGBA - 4 components per vertex, 4 vertex per quad)
+    int vertexStride;           // Bytes between consecutive vertex positions
+    int texcoordStride;         // Bytes between consecutive vertex texture coordinates
+    int colorStride;            // Bytes between consecutive vertex colors
+    int count;                  // Number of quads reserved (could be less than requested)
+    float depth;                // Current depth value, to be used as Z for 2D quads
+} rlQuadBuffer;
+
+// Get quad buffer vertex attributes, index is vertex index (quad*4 + corner)
+#define RL_QUAD_POSITION(quads, index)  ((float *)((unsigned char *)(quads).vertices + (index)*(quads).vertexStride))
+#define RL_QUAD_TEXCOORD(quads, index)  ((float *)((unsigned char *)(quads).texcoords + (index)*(quads).texcoordStride))
+#define RL_QUAD_COLOR(quads, index)     ((quads).colors + (index)*(quads).colorStride)
+
+// rlDisplayListDraw type, draw recorded on a display list
+typedef struct rlDisplayListDraw {
+    int mode;                   // Drawing mode: LINES, TRIANGLES (QUADS are recorded as TRIANGLES)
+    int vertexCount;            // Number of vertex (indices) of the draw
+    unsigned int textureId;     // Texture id to be used on the draw
+    unsigned int shaderId;      // Shader id to be used on the draw (shader active when recorded)
+    int *shaderLocs;            // Shader locations to be used on the draw
+} rlDisplayListDraw;
+
+// rlDisplayList type, render batch draws recorded once into static vertex buffers to be replayed
+typedef struct rlDisplayList {
+    unsigned int vaoId;         // OpenGL Vertex Array Object id
+    unsigned int vboId[2];      // OpenGL Vertex Buffer Objects id (interleaved vertex data, rlBatchVertex, and indices, 0 if not indexed)
+    int vertexCount;            // Number of vertex recorded
+    int drawCount;              // Number of draws recorded
+    rlDisplayListDraw *draws;   // Draws recorded (consecutive draws with same mode, texture and shader are merged)
+} rlDisplayList;
+
+// rlFrameStats type, rendering counters for one frame
+// NOTE: Frames are delimited by rlUpdateFrameStats() calls
+typedef struct rlFrameStats {
+    int drawCalls;              // Draw calls (render batch draws and vertex arrays draws)
+    int vertexCount;            // Vertex (or indices) submitted by draw calls
+    int batchDraws;             // Render batch draws with vertex data (batch flushes)
+    int textureBinds;           // Textures bound for drawing
+    int bufferUploads;          // Vertex buffers data updates
+    int bufferUploadSize;       // Vertex buffers data updated (bytes)
+    int stateChanges;           // Shader, blend mode and framebuffer changes
+    float gpuTime;              // GPU time of render batch draws (milliseconds), -1.0f if GPU timer not available
+} rlFrameStats;
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -487,7 +591,10 @@ typedef enum {
     RL_SHADER_LOC_MAP_CUBEMAP,          // Shader location: samplerCube texture: cubemap
     RL_SHADER_LOC_MAP_IRRADIANCE,       // Shader location: samplerCube texture: irradiance
     RL_SHADER_LOC_MAP_PREFILTER,        // Shader location: samplerCube texture: prefilter
-    RL_SHADER_LOC_MAP_BRDF              // Shader location: sampler2d texture: brdf
+    RL_SHADER_LOC_MAP_BRDF,             // Shader location: sampler2d texture: brdf
+    RL_SHADER_LOC_VERTEX_BONEIDS,       // Shader location: vertex attribute: bone ids (skinning)
+    RL_SHADER_LOC_VERTEX_BONEWEIGHTS,   // Shader location: vertex attribute: bone weights (skinning)
+    RL_SHADER_LOC_BONE_MATRICES         // Shader location: matrix array uniform: bone matrices (skinning)
 } rlShaderLocationIndex;
 
 #define RL_SHADER_LOC_MAP_DIFFUSE       RL_SHADER_LOC_MAP_ALBEDO
@@ -547,6 +654,11 @@ typedef enum {
     RL_CULL_FACE_BACK
 } rlCullMode;
 
+// Shader program binary cache callbacks, cache entries are identified by a name generated by rlgl
+// NOTE: Loaded data must be allocated with RL_MALLOC(), rlgl frees it with RL_FREE()
+typedef unsigned char *(*rlLoadShaderCacheCallback)(const char *name, int *dataSize);
+typedef void (*rlSaveShaderCacheCallback)(const char *name, const unsigned char *data, int dataSize);
+
 //------------------------------------------------------------------------------------
 // Functions Declaration - Matrix operations
 //------------------------------------------------------------------------------------
@@ -580,6 +692,8 @@ RLAPI void rlNormal3f(float x, float y, float z);     // Define one vertex (norm
 RLAPI void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a);  // Define one vertex (color) - 4 byte
 RLAPI void rlColor3f(float x, float y, float z);          // Define one vertex (color) - 3 float
 RLAPI void rlColor4f(float x, float y, float z, float w); // Define one vertex (color) - 4 float
+RLAPI rlQuadBuffer rlBeginQuads(unsigned int textureId, int count); // Reserve quads on render batch (texture set), vertex data written directly on returned buffer
+RLAPI void rlEndQuads(int count);                         // Submit quads written (first count reserved quads), current transform matrix is applied
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - OpenGL style functions (common to 1.1, 3.3+, ES2)
@@ -665,8 +779,19 @@ RLAPI void rlSetFramebufferHeight(int height);          // Set current framebuff
 RLAPI int rlGetFramebufferHeight(void);                 // Get default framebuffer height
 
 RLAPI unsigned int rlGetTextureIdDefault(void);         // Get default texture id
+RLAPI unsigned int rlGetTextureIdSdfShapes(void);       // Get SDF shapes texture id, batch draws using it are drawn with SDF shapes shader (0 if not loaded)
 RLAPI unsigned int rlGetShaderIdDefault(void);          // Get default shader id
 RLAPI int *rlGetShaderLocsDefault(void);                // Get default shader locations
+RLAPI unsigned int rlGetShaderIdSdf(void);              // Get SDF text shader id (loaded on first call)
+RLAPI int *rlGetShaderLocsSdf(void);                    // Get SDF text shader locations
+RLAPI unsigned int rlGetShaderIdSdfShapes(void);        // Get SDF shapes shader id (loaded on first call, 0 if not supported)
+RLAPI int *rlGetShaderLocsSdfShapes(void);              // Get SDF shapes shader locations
+RLAPI unsigned int rlGetShaderIdSkinning(void);         // Get skinning shader id (loaded on first call)
+RLAPI int *rlGetShaderLocsSkinning(void);               // Get skinning shader locations
+RLAPI int rlGetShaderBonesSkinning(void);               // Get number of bone matrices supported by skinning shader
+RLAPI unsigned int rlGetShaderIdInstancing(void);       // Get instancing shader id (loaded on first call, 0 if instancing not supported)
+RLAPI int *rlGetShaderLocsInstancing(void);             // Get instancing shader locations
+RLAPI unsigned int rlGetShaderIdCurrent(void);          // Get current shader id
 
 // Render batch management
 // NOTE: rlgl provides a default render batch to behave like OpenGL 1.1 immediate mode
@@ -677,6 +802,20 @@ RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);                         // D
 RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch);                    // Set the active render batch for rlgl (NULL for default internal)
 RLAPI void rlDrawRenderBatchActive(void);                                   // Update and draw internal render batch
 RLAPI bool rlCheckRenderBatchLimit(int vCount);                             // Check internal buffer overflow for a given number of vertex
+RLAPI void rlEnableRenderBatchSorting(void);                                // Enable render batch draws sorting (2D), non-overlapping draws are merged by mode and texture
+RLAPI void rlDisableRenderBatchSorting(void);                               // Disable render batch draws sorting
+
+// Frame statistics
+RLAPI void rlUpdateFrameStats(void);                                        // Finish current frame statistics (call once per frame), counters are reset
+RLAPI rlFrameStats rlGetFrameStats(void);                                   // Get last finished frame statistics
+RLAPI void rlEnableGpuTimer(void);                                          // Enable GPU timer queries on render batch draws (if supported)
+RLAPI void rlDisableGpuTimer(void);                                         // Disable GPU timer queries
+
+// Display lists management
+RLAPI void rlBeginDisplayList(void);                                        // Begin display list recording, render batch draws are recorded instead of drawn
+RLAPI rlDisplayList rlEndDisplayList(void);                                 // End display list recording, recorded vertex data is uploaded to GPU
+RLAPI void rlDrawDisplayList(rlDisplayList list, Matrix transform, unsigned char r, unsigned char g, unsigned char b, unsigned char a);  // Draw display list with a transform and tint
+RLAPI void rlUnloadDisplayList(rlDisplayList list);                         // Unload display list from GPU memory (VRAM)
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
 
@@ -687,6 +826,7 @@ RLAPI unsigned int rlLoadVertexArray(void);                               // Loa
 RLAPI unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic);            // Load a vertex buffer attribute
 RLAPI unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynamic);     // Load a new attributes element buffer
 RLAPI void rlUpdateVertexBuffer(unsigned int bufferId, const void *data, int dataSize, int offset);     // Update GPU buffer with new data
+RLAPI unsigned int rlUpdateVertexBufferStream(const void *data, int dataSize, int *offset);  // Update streamed vertex buffer with new data, returns buffer id and data offset (bytes)
 RLAPI void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset);   // Update vertex buffer elements with new data
 RLAPI void rlUnloadVertexArray(unsigned int vaoId);
 RLAPI void rlUnloadVertexBuffer(unsigned int vboId);
@@ -721,10 +861,12 @@ RLAPI unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode);
 RLAPI unsigned int rlCompileShader(const char *shaderCode, int type);           // Compile custom shader and return shader id (type: RL_VERTEX_SHADER, RL_FRAGMENT_SHADER, RL_COMPUTE_SHADER)
 RLAPI unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId); // Load custom shader program
 RLAPI void rlUnloadShaderProgram(unsigned int id);                              // Unload shader program
+RLAPI void rlSetShaderCacheCallbacks(rlLoadShaderCacheCallback loadCallback, rlSaveShaderCacheCallback saveCallback); // Set shader program binary cache callbacks (NULL to disable)
 RLAPI int rlGetLocationUniform(unsigned int shaderId, const char *uniformName); // Get shader location uniform
 RLAPI int rlGetLocationAttrib(unsigned int shaderId, const char *attribName);   // Get shader location attribute
 RLAPI void rlSetUniform(int locIndex, const void *value, int uniformType, int count);   // Set shader value uniform
 RLAPI void rlSetUniformMatrix(int locIndex, Matrix mat);                        // Set shader value matrix
+RLAPI void rlSetUniformMatrices(int locIndex, const Matrix *mat, int count);    // Set shader value matrix array
 RLAPI void rlSetUniformSampler(int locIndex, unsigned int textureId);           // Set shader value sampler
 RLAPI void rlSetShader(unsigned int id, int *locs);                             // Set shader currently active (id and locations)
 
@@ -832,6 +974,7 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #include <stdlib.h>                     // Required for: malloc(), free()
 #include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
 #include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
+#include <stddef.h>                     // Required for: offsetof() [Used in rlSetBatchVertexAttributes(), rlSetDisplayListVertexAttributes()]
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -929,6 +1072,15 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2
     #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: 5
 #endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS      "vertexBoneIds"     // Bound by default to shader location: 6
+#endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS  "vertexBoneWeights" // Bound by default to shader location: 7
+#endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TX
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TX  "instanceTransform" // Bound by default to shader location: 8 (mat4, locations 8 to 11)
+#endif
 
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MVP
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
@@ -948,6 +1100,9 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR       "colDiffuse"        // color diffuse (base tint color, multiplied by texture color)
 #endif
+#ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES
+    #define RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES "boneMatrices"    // bone matrices array (skinning)
+#endif
 #ifndef RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0
     #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0  "texture0"          // texture0 (texture slot active 0)
 #endif
@@ -985,10 +1140,26 @@ typedef struct rlglData {
         unsigned int activeTextureId[RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS];    // Active texture ids to be enabled on batch drawing (0 active by default)
         unsigned int defaultVShaderId;      // Default vertex shader id (used by default shader program)
         unsigned int defaultFShaderId;      // Default fragment shader id (used by default shader program)
+        const char *defaultVShaderCode;     // Default vertex shader code (compiled on first use if default shader program is cached)
+        const char *defaultFShaderCode;     // Default fragment shader code (compiled on first use if default shader program is cached)
         unsigned int defaultShaderId;       // Default shader program id, supports vertex color and diffuse texture
         int *defaultShaderLocs;             // Default shader locations pointer to be used on rendering
         unsigned int currentShaderId;       // Current shader id to be used on rendering (by default, defaultShaderId)
         int *currentShaderLocs;             // Current shader locations pointer to be used on rendering (by default, defaultShaderLocs)
+        unsigned int sdfShaderId;           // SDF text shader program id, alpha channel stores glyphs distance field
+        int *sdfShaderLocs;                 // SDF text shader locations pointer (loaded on first use)
+        unsigned int sdfShapesShaderId;     // SDF shapes shader program id, analytic shapes encoded in texcoords
+        int *sdfShapesShaderLocs;           // SDF shapes shader locations pointer (loaded on first use)
+        unsigned int sdfShapesTextureId;    // SDF shapes texture id, 1x1 white pixel marking batch draws of SDF shapes (loaded with shader)
+        unsigned int skinningShaderId;      // Skinning shader program id, default shader with vertex bones transform
+        int *skinningShaderLocs;            // Skinning shader locations pointer (loaded on first use)
+        int skinningShaderBones;            // Skinning shader bone matrices array size, limited by vertex uniform vectors
+        unsigned int instancingShaderId;    // Instancing shader program id, default shader with instance transform attribute
+        int *instancingShaderLocs;          // Instancing shader locations pointer (loaded on first use)
+
+        unsigned int streamBufferId;        // Streamed vertex buffer id, data is written sequentially and buffer orphaned when full
+        int streamBufferSize;               // Streamed vertex buffer size (bytes)
+        int streamBufferOffset;             // Streamed vertex buffer next write offset (bytes)
 
         bool stereoRender;                  // Stereo rendering flag
         Matrix projectionStereo[2];         // VR stereo rendering eyes projection matrices
@@ -1010,6 +1181,32 @@ typedef struct rlglData {
         int framebufferWidth;               // Current framebuffer width
         int framebufferHeight;              // Current framebuffer height
 
+        rlFrameStats frameStats;            // Current frame statistics (being counted)
+        rlFrameStats lastFrameStats;        // Last finished frame statistics
+        bool gpuTimer;                      // GPU timer queries enabled on render batch draws
+        unsigned int timerQueries[RL_GPU_TIMER_FRAMES][RL_GPU_TIMER_QUERIES];  // GPU timer queries (GL_TIME_ELAPSED) by frame
+        int timerQueryCount[RL_GPU_TIMER_FRAMES];   // GPU timer queries used by frame
+        int timerFrame;                     // GPU timer queries current frame index
+        float gpuTime;                      // Last GPU time available (milliseconds)
+
+        bool sortDraws;                     // Render batch draws sorting enabled (merge draws by mode and texture)
+        unsigned char *sortBuffer;          // Render batch vertex data copy, used to reorder draws vertex
+        int sortBufferSize;                 // Render batch sorting buffer size (bytes)
+
+        bool displayListRecording;          // Display list recording, render batch draws are recorded instead of drawn
+        rlBatchVertex *displayListVertices; // Display list vertex data being recorded
+        int displayListVertexCount;         // Display list vertex recorded
+        int displayListVertexCapacity;      // Display list vertex data capacity (vertex)
+        unsigned int *displayListIndices;   // Display list indices being recorded (QUADS drawn as two triangles)
+        int displayListIndexCount;          // Display list indices recorded
+        int displayListIndexCapacity;       // Display list indices capacity
+        rlDisplayListDraw *displayListDraws;    // Display list draws being recorded
+        int displayListDrawCount;           // Display list draws recorded
+        int displayListDrawCapacity;        // Display list draws capacity
+
+        rlLoadShaderCacheCallback loadShaderCache;  // Shader program binary cache load callback (NULL if not used)
+        rlSaveShaderCacheCallback saveShaderCache;  // Shader program binary cache save callback (NULL if not used)
+
     } State;            // Renderer state
     struct {
         bool vao;                           // VAO support (OpenGL ES2 could not support VAO extension) (GL_ARB_vertex_array_object)
@@ -1028,15 +1225,27 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool timerQuery;                    // GPU timer queries support (GL_ARB_timer_query)
+        bool programBinary;                 // Shader program binaries support (GL_ARB_get_program_binary)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
+        int maxVertexAttribs;               // Maximum vertex attributes supported (minimum is 8 on OpenGL ES 2.0)
 
     } ExtSupported;     // Extensions supported flags
 } rlglData;
 
 typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions loader signature (same as GLADloadproc)
 
+// Shader program binary cache data header, followed by program binary
+typedef struct rlShaderCacheHeader {
+    char id[4];                         // Cache data identifier: "rSHB"
+    int version;                        // Cache data version
+    unsigned long long hash;            // Shaders code and driver hash (FNV-1a)
+    unsigned int format;                // Program binary format (driver specific)
+    int binarySize;                     // Program binary size in bytes
+} rlShaderCacheHeader;
+
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 //----------------------------------------------------------------------------------
@@ -1046,6 +1255,11 @@ typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions
 static rlglData RLGL = { 0 };
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+#if defined(GRAPHICS_API_OPENGL_11)
+static rlQuadBuffer rlQuadsScratch = { 0 };     // Quads scratch buffer, submitted by rlEndQuads() (immediate mode)
+static int rlQuadsScratchCapacity = 0;          // Quads scratch buffer capacity (quads)
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_ES2) && !defined(GRAPHICS_API_OPENGL_ES3)
 // NOTE: VAO functionality is exposed through extensions (OES)
 static PFNGLGENVERTEXARRAYSOESPROC glGenVertexArrays = NULL;
@@ -1064,12 +1278,37 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static void rlLoadShaderSdf(void);          // Load SDF text shader
+static void rlUnloadShaderSdf(void);        // Unload SDF text shader
+static void rlLoadShaderSdfShapes(void);    // Load SDF shapes shader
+static void rlUnloadShaderSdfShapes(void);  // Unload SDF shapes shader
+static void rlLoadShaderSkinning(void);     // Load skinning shader
+static void rlUnloadShaderSkinning(void);   // Unload skinning shader
+static void rlLoadShaderInstancing(void);   // Load instancing shader
+static void rlUnloadShaderInstancing(void); // Unload instancing shader
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static const char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
+#if defined(RLGL_RENDER_BATCH_INTERLEAVED)
+static void rlSetBatchVertexAttributes(void);   // Set render batch interleaved vertex attributes (buffer bound)
+#endif
+static bool rlSortRenderBatchDraws(rlRenderBatch *batch, bool keepLastDraw);   // Sort render batch draws, merging non-overlapping draws by mode and texture
+static void rlResetRenderBatch(rlRenderBatch *batch);   // Reset render batch draws and change to next buffer
+static unsigned int rlGetBatchDrawShader(unsigned int textureId, int **locs);   // Get shader to be used by a batch draw
+static void rlRecordRenderBatch(rlRenderBatch *batch);  // Record render batch draws into the display list being recorded
+static void rlSetDisplayListVertexAttributes(void);     // Set display list vertex attributes (buffer bound)
+static void rlCompileShaderDefault(void);   // Compile default vertex and fragment shaders (if not compiled yet)
+#if defined(GRAPHICS_API_OPENGL_33)
+static unsigned long long rlGetShaderCacheHash(const char *vsCode, const char *fsCode, char *name);   // Get shader program cache hash and name (16 hex chars)
+#endif
+static unsigned int rlLoadShaderProgramCache(const char *vsCode, const char *fsCode);   // Load shader program from binary cache, 0 if not available
+static void rlSaveShaderProgramCache(unsigned int id, const char *vsCode, const char *fsCode);   // Save linked shader program binary to cache
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
+#if defined(GRAPHICS_API_OPENGL_11)
+static rlQuadBuffer rlGetQuadsScratch(int count);                   // Get quads scratch buffer, grown to count quads if required
+#endif
 
 // Auxiliar matrix math functions
 static Matrix rlMatrixIdentity(void);                       // Get identity matrix
@@ -1369,7 +1608,11 @@ void rlBegin(int mode)
             }
         }
 
-        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS)
+        {
+            // NOTE: If draws sorting is enabled, merging draws could avoid the batch draw
+            if (!RLGL.State.sortDraws || !rlSortRenderBatchDraws(RLGL.currentBatch, true)) rlDrawRenderBatch(RLGL.currentBatch);
+        }
 
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
@@ -1427,6 +1670,20 @@ void rlVertex3f(float x, float y, float z)
         }
     }
 
+#if defined(RLGL_RENDER_BATCH_INTERLEAVED)
+    // Add vertex position, current texcoord and current color
+    // WARNING: By default rlVertexBuffer struct does not store normals
+    rlBatchVertex *vertex = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertexData[RLGL.State.vertexCounter];
+    vertex->position[0] = tx;
+    vertex->position[1] = ty;
+    vertex->position[2] = tz;
+    vertex->texcoord[0] = RLGL.State.texcoordx;
+    vertex->texcoord[1] = RLGL.State.texcoordy;
+    vertex->color[0] = RLGL.State.colorr;
+    vertex->color[1] = RLGL.State.colorg;
+    vertex->color[2] = RLGL.State.colorb;
+    vertex->color[3] = RLGL.State.colora;
+#else
     // Add vertices
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter] = tx;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 1] = ty;
@@ -1443,6 +1700,7 @@ void rlVertex3f(float x, float y, float z)
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 1] = RLGL.State.colorg;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 2] = RLGL.State.colorb;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 3] = RLGL.State.colora;
+#endif
 
     RLGL.State.vertexCounter++;
     RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount++;
@@ -1500,6 +1758,115 @@ void rlColor3f(float x, float y, float z)
 
 #endif
 
+// Reserve quads on render batch (texture set), vertex data written directly on returned buffer
+// NOTE: Reserved quads are limited by batch size (buffer count could be less than requested),
+// batch is drawn if there is not enough space available, rlEndQuads() must be called before any other rlgl call
+rlQuadBuffer rlBeginQuads(unsigned int textureId, int count)
+{
+    rlQuadBuffer quads = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlBegin(RL_QUADS);
+    rlSetTexture((textureId != 0)? textureId : RLGL.State.defaultTextureId);
+
+    int elementCount = RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount;
+
+    if (count > elementCount - 1) count = elementCount - 1;
+    if (count < 0) count = 0;
+
+    rlCheckRenderBatchLimit(count*4);
+
+    // NOTE: Batch could be drawn by limit check (next vertex buffer used), buffer retrieved after it
+    rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+
+#if defined(RLGL_RENDER_BATCH_INTERLEAVED)
+    rlBatchVertex *vertexData = buffer->vertexData + RLGL.State.vertexCounter;
+
+    quads.vertices = vertexData->position;
+    quads.texcoords = vertexData->texcoord;
+    quads.colors = vertexData->color;
+    quads.vertexStride = sizeof(rlBatchVertex);
+    quads.texcoordStride = sizeof(rlBatchVertex);
+    quads.colorStride = sizeof(rlBatchVertex);
+#else
+    quads.vertices = buffer->vertices + 3*RLGL.State.vertexCounter;
+    quads.texcoords = buffer->texcoords + 2*RLGL.State.vertexCounter;
+    quads.colors = buffer->colors + 4*RLGL.State.vertexCounter;
+    quads.vertexStride = 3*sizeof(float);
+    quads.texcoordStride = 2*sizeof(float);
+    quads.colorStride = 4*sizeof(unsigned char);
+#endif
+    quads.count = count;
+    quads.depth = RLGL.currentBatch->currentDepth;
+#endif
+#if defined(GRAPHICS_API_OPENGL_11)
+    rlSetTexture(textureId);
+
+    quads = rlGetQuadsScratch(count);
+#endif
+
+    return quads;
+}
+
+// Submit quads written (first count reserved quads), current transform matrix is applied
+void rlEndQuads(int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+
+#if defined(RLGL_RENDER_BATCH_INTERLEAVED)
+    if (RLGL.State.transformRequired)
+    {
+        Matrix mat = RLGL.State.transform;
+        rlBatchVertex *vertexData = buffer->vertexData + RLGL.State.vertexCounter;
+
+        for (int i = 0; i < count*4; i++)
+        {
+            float x = vertexData[i].position[0];
+            float y = vertexData[i].position[1];
+            float z = vertexData[i].position[2];
+
+            vertexData[i].position[0] = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
+            vertexData[i].position[1] = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
+            vertexData[i].position[2] = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+        }
+    }
+#else
+    if (RLGL.State.transformRequired)
+    {
+        Matrix mat = RLGL.State.transform;
+        float *vertices = buffer->vertices + 3*RLGL.State.vertexCounter;
+
+        for (int i = 0; i < count*4; i++)
+        {
+            float x = vertices[i*3];
+            float y = vertices[i*3 + 1];
+            float z = vertices[i*3 + 2];
+
+            vertices[i*3] = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
+            vertices[i*3 + 1] = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
+            vertices[i*3 + 2] = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+        }
+    }
+#endif
+
+    RLGL.State.vertexCounter += count*4;
+    RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount += count*4;
+
+    rlEnd();
+#endif
+#if defined(GRAPHICS_API_OPENGL_11)
+    glBegin(GL_QUADS);
+    for (int i = 0; i < count*4; i++)
+    {
+        glColor4ub(rlQuadsScratch.colors[i*4], rlQuadsScratch.colors[i*4 + 1], rlQuadsScratch.colors[i*4 + 2], rlQuadsScratch.colors[i*4 + 3]);
+        glTexCoord2f(rlQuadsScratch.texcoords[i*2], rlQuadsScratch.texcoords[i*2 + 1]);
+        glVertex3f(rlQuadsScratch.vertices[i*3], rlQuadsScratch.vertices[i*3 + 1], rlQuadsScratch.vertices[i*3 + 2]);
+    }
+    glEnd();
+#endif
+}
+
 //--------------------------------------------------------------------------------------
 // Module Functions Definition - OpenGL style functions (common to 1.1, 3.3+, ES2)
 //--------------------------------------------------------------------------------------
@@ -1546,7 +1913,11 @@ void rlSetTexture(unsigned int id)
                 }
             }
 
-            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS)
+            {
+                // NOTE: If draws sorting is enabled, merging draws could avoid the batch draw
+                if (!RLGL.State.sortDraws || !rlSortRenderBatchDraws(RLGL.currentBatch, true)) rlDrawRenderBatch(RLGL.currentBatch);
+            }
 
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
@@ -1570,6 +1941,9 @@ void rlEnableTexture(unsigned int id)
     glEnable(GL_TEXTURE_2D);
 #endif
     glBindTexture(GL_TEXTURE_2D, id);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.frameStats.textureBinds++;
+#endif
 }
 
 // Disable texture
@@ -1586,6 +1960,7 @@ void rlEnableTextureCubemap(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    RLGL.State.frameStats.textureBinds++;
 #endif
 }
 
@@ -1694,6 +2069,7 @@ void rlEnableShader(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
     glUseProgram(id);
+    RLGL.State.frameStats.stateChanges++;
 #endif
 }
 
@@ -1710,6 +2086,7 @@ void rlEnableFramebuffer(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
     glBindFramebuffer(GL_FRAMEBUFFER, id);
+    RLGL.State.frameStats.stateChanges++;
 #endif
 }
 
@@ -1954,6 +2331,7 @@ void rlSetBlendMode(int mode)
     if ((RLGL.State.currentBlendMode != mode) || ((mode == RL_BLEND_CUSTOM || mode == RL_BLEND_CUSTOM_SEPARATE) && RLGL.State.glCustomBlendModeModified))
     {
         rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.frameStats.stateChanges++;
 
         switch (mode)
         {
@@ -2108,6 +2486,9 @@ void rlglInit(int width, int height)
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Get vertex attributes supported, required on shaders linking (instance transform location)
+    glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &RLGL.ExtSupported.maxVertexAttribs);
+
     // Init default white texture
     unsigned char pixels[4] = { 255, 255, 255, 255 };   // 1 pixel RGBA (4 bytes)
     RLGL.State.defaultTextureId = rlLoadTexture(pixels, 1, 1, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
@@ -2183,11 +2564,36 @@ void rlglClose(void)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     rlUnloadRenderBatch(RLGL.defaultBatch);
 
+    if (RLGL.State.sdfShaderLocs != NULL) rlUnloadShaderSdf();    // Unload SDF text shader (if loaded)
+    if (RLGL.State.sdfShapesShaderLocs != NULL) rlUnloadShaderSdfShapes();    // Unload SDF shapes shader (if loaded)
+    if (RLGL.State.skinningShaderLocs != NULL) rlUnloadShaderSkinning();    // Unload skinning shader (if loaded)
+    if (RLGL.State.instancingShaderLocs != NULL) rlUnloadShaderInstancing();    // Unload instancing shader (if loaded)
+    if (RLGL.State.streamBufferId != 0) glDeleteBuffers(1, &RLGL.State.streamBufferId);    // Unload streamed vertex buffer (if loaded)
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.State.timerQueries[0][0] != 0) glDeleteQueries(RL_GPU_TIMER_FRAMES*RL_GPU_TIMER_QUERIES, &RLGL.State.timerQueries[0][0]);  // Unload GPU timer queries (if loaded)
+#endif
+    RL_FREE(RLGL.State.sortBuffer);   // Unload render batch sorting buffer (if used)
+    RLGL.State.sortBuffer = NULL;
+    RLGL.State.sortBufferSize = 0;
+    RL_FREE(RLGL.State.displayListVertices);  // Unload display list recording buffers (if recording)
+    RL_FREE(RLGL.State.displayListIndices);
+    RL_FREE(RLGL.State.displayListDraws);
+    RLGL.State.displayListVertices = NULL;
+    RLGL.State.displayListIndices = NULL;
+    RLGL.State.displayListDraws = NULL;
+    RLGL.State.displayListRecording = false;
     rlUnloadShaderDefault();          // Unload default shader
 
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
 #endif
+#if defined(GRAPHICS_API_OPENGL_11)
+    RL_FREE(rlQuadsScratch.vertices);
+    RL_FREE(rlQuadsScratch.texcoords);
+    RL_FREE(rlQuadsScratch.colors);
+    rlQuadsScratch = (rlQuadBuffer){ 0 };
+    rlQuadsScratchCapacity = 0;
+#endif
 }
 
 // Load OpenGL extensions
@@ -2211,6 +2617,17 @@ void rlLoadExtensions(void *loader)
     for (int i = 0; i < numExt; i++) TRACELOG(RL_LOG_INFO, "    %s", glGetStringi(GL_EXTENSIONS, i));
 #endif
 
+    // GPU timer queries: OpenGL 3.3 core or GL_ARB_timer_query
+    RLGL.ExtSupported.timerQuery = (GLAD_GL_VERSION_3_3 || GLAD_GL_ARB_timer_query);
+
+    // Shader program binaries: OpenGL 4.1 core or GL_ARB_get_program_binary, at least one binary format required
+    if (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_get_program_binary)
+    {
+        GLint binaryFormats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormats);
+        RLGL.ExtSupported.programBinary = (binaryFormats > 0);
+    }
+
 #if defined(GRAPHICS_API_OPENGL_21)
     // Register supported extensions flags
     // Optional OpenGL 2.1 extensions
@@ -2454,6 +2871,7 @@ void rlLoadExtensions(void *loader)
     if (RLGL.ExtSupported.texCompASTC) TRACELOG(RL_LOG_INFO, "GL: ASTC compressed textures supported");
     if (RLGL.ExtSupported.computeShader) TRACELOG(RL_LOG_INFO, "GL: Compute shaders supported");
     if (RLGL.ExtSupported.ssbo) TRACELOG(RL_LOG_INFO, "GL: Shader storage buffer objects supported");
+    if (RLGL.ExtSupported.programBinary) TRACELOG(RL_LOG_INFO, "GL: Shader program binaries supported");
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -2529,6 +2947,17 @@ unsigned int rlGetTextureIdDefault(void)
     return id;
 }
 
+// Get SDF shapes texture id
+// NOTE: Texture is loaded with SDF shapes shader, rlGetShaderIdSdfShapes() must be called first
+unsigned int rlGetTextureIdSdfShapes(void)
+{
+    unsigned int id = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    id = RLGL.State.sdfShapesTextureId;
+#endif
+    return id;
+}
+
 // Get default shader id
 unsigned int rlGetShaderIdDefault(void)
 {
@@ -2549,6 +2978,126 @@ int *rlGetShaderLocsDefault(void)
     return locs;
 }
 
+// Get SDF text shader id
+// NOTE: Shader is loaded on first call, returns 0 if not supported
+unsigned int rlGetShaderIdSdf(void)
+{
+    unsigned int id = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.sdfShaderLocs == NULL) rlLoadShaderSdf();
+    id = RLGL.State.sdfShaderId;
+#endif
+    return id;
+}
+
+// Get SDF text shader locs
+int *rlGetShaderLocsSdf(void)
+{
+    int *locs = NULL;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.sdfShaderLocs == NULL) rlLoadShaderSdf();
+    locs = RLGL.State.sdfShaderLocs;
+#endif
+    return locs;
+}
+
+// Get SDF shapes shader id
+// NOTE: Shader is loaded on first call, returns 0 if not supported
+unsigned int rlGetShaderIdSdfShapes(void)
+{
+    unsigned int id = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.sdfShapesShaderLocs == NULL) rlLoadShaderSdfShapes();
+    id = RLGL.State.sdfShapesShaderId;
+#endif
+    return id;
+}
+
+// Get SDF shapes shader locs
+int *rlGetShaderLocsSdfShapes(void)
+{
+    int *locs = NULL;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.sdfShapesShaderLocs == NULL) rlLoadShaderSdfShapes();
+    locs = RLGL.State.sdfShapesShaderLocs;
+#endif
+    return locs;
+}
+
+// Get skinning shader id
+// NOTE: Shader is loaded on first call, returns 0 if not supported
+unsigned int rlGetShaderIdSkinning(void)
+{
+    unsigned int id = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.skinningShaderLocs == NULL) rlLoadShaderSkinning();
+    id = RLGL.State.skinningShaderId;
+#endif
+    return id;
+}
+
+// Get skinning shader locs
+int *rlGetShaderLocsSkinning(void)
+{
+    int *locs = NULL;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.skinningShaderLocs == NULL) rlLoadShaderSkinning();
+    locs = RLGL.State.skinningShaderLocs;
+#endif
+    return locs;
+}
+
+// Get number of bone matrices supported by skinning shader
+// NOTE: Shader is loaded on first call, returns 0 if not supported
+int rlGetShaderBonesSkinning(void)
+{
+    int bones = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.skinningShaderLocs == NULL) rlLoadShaderSkinning();
+    if (RLGL.State.skinningShaderId > 0) bones = RLGL.State.skinningShaderBones;
+#endif
+    return bones;
+}
+
+// Get instancing shader id
+// NOTE: Shader is loaded on first call, returns 0 if instancing is not supported
+unsigned int rlGetShaderIdInstancing(void)
+{
+    unsigned int id = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.instancing)
+    {
+        if (RLGL.State.instancingShaderLocs == NULL) rlLoadShaderInstancing();
+        id = RLGL.State.instancingShaderId;
+    }
+#endif
+    return id;
+}
+
+// Get instancing shader locs
+int *rlGetShaderLocsInstancing(void)
+{
+    int *locs = NULL;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.ExtSupported.instancing)
+    {
+        if (RLGL.State.instancingShaderLocs == NULL) rlLoadShaderInstancing();
+        locs = RLGL.State.instancingShaderLocs;
+    }
+#endif
+    return locs;
+}
+
+// Get current shader id
+unsigned int rlGetShaderIdCurrent(void)
+{
+    unsigned int id = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    id = RLGL.State.currentShaderId;
+#endif
+    return id;
+}
+
 // Render batch management
 //------------------------------------------------------------------------------------------------
 // Load render batch
@@ -2565,9 +3114,13 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     {
         batch.vertexBuffer[i].elementCount = bufferElements;
 
+#if defined(RLGL_RENDER_BATCH_INTERLEAVED)
+        batch.vertexBuffer[i].vertexData = (rlBatchVertex *)RL_CALLOC(bufferElements*4, sizeof(rlBatchVertex));   // 4 vertex by quad
+#else
         batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
         batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
         batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+#endif
 #if defined(GRAPHICS_API_OPENGL_33)
         batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
 #endif
@@ -2575,9 +3128,11 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.vertexBuffer[i].indices = (unsigned short *)RL_MALLOC(bufferElements*6*sizeof(unsigned short));  // 6 int by quad (indices)
 #endif
 
+#if !defined(RLGL_RENDER_BATCH_INTERLEAVED)
         for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
         for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
         for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
+#endif
 
         int k = 0;
 
@@ -2611,6 +3166,13 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
             glBindVertexArray(batch.vertexBuffer[i].vaoId);
         }
 
+#if defined(RLGL_RENDER_BATCH_INTERLEAVED)
+        // Quads - Interleaved vertex buffer binding and attributes enable
+        glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*sizeof(rlBatchVertex), batch.vertexBuffer[i].vertexData, GL_DYNAMIC_DRAW);
+        rlSetBatchVertexAttributes();
+#else
         // Quads - Vertex buffers binding and attributes enable
         // Vertex position buffer (shader-location = 0)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
@@ -2632,6 +3194,7 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+#endif
 
         // Fill index buffer
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
@@ -2707,9 +3270,13 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
 
         // Free vertex arrays memory from CPU (RAM)
+#if defined(RLGL_RENDER_BATCH_INTERLEAVED)
+        RL_FREE(batch.vertexBuffer[i].vertexData);
+#else
         RL_FREE(batch.vertexBuffer[i].vertices);
         RL_FREE(batch.vertexBuffer[i].texcoords);
         RL_FREE(batch.vertexBuffer[i].colors);
+#endif
         RL_FREE(batch.vertexBuffer[i].indices);
     }
 
@@ -2724,6 +3291,17 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 void rlDrawRenderBatch(rlRenderBatch *batch)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Merge batch draws by mode and texture (if enabled), vertex data is reordered before being updated
+    if (RLGL.State.sortDraws) rlSortRenderBatchDraws(batch, false);
+
+    // Batch draws are recorded into the display list being recorded, nothing is drawn
+    if (RLGL.State.displayListRecording)
+    {
+        rlRecordRenderBatch(batch);
+        rlResetRenderBatch(batch);
+        return;
+    }
+
     // Update batch vertex buffers
     //------------------------------------------------------------------------------------------------------------
     // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
@@ -2733,6 +3311,14 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         // Activate elements VAO
         if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
 
+#if defined(RLGL_RENDER_BATCH_INTERLEAVED)
+        // Interleaved vertex buffer (positions, texture coordinates and colors)
+        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*sizeof(rlBatchVertex), batch->vertexBuffer[batch->currentBuffer].vertexData);
+
+        RLGL.State.frameStats.bufferUploads++;
+        RLGL.State.frameStats.bufferUploadSize += RLGL.State.vertexCounter*sizeof(rlBatchVertex);
+#else
         // Vertex positions buffer
         glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
         glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
@@ -2748,6 +3334,11 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
         //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
 
+        RLGL.State.frameStats.bufferUploads += 3;
+        RLGL.State.frameStats.bufferUploadSize += RLGL.State.vertexCounter*(3*sizeof(float) + 2*sizeof(float) + 4*sizeof(unsigned char));
+#endif
+        RLGL.State.frameStats.batchDraws++;
+
         // NOTE: glMapBuffer() causes sync issue.
         // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job.
         // To avoid waiting (idle), you can call first glBufferData() with NULL pointer before glMapBuffer().
@@ -2776,6 +3367,18 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     int eyeCount = 1;
     if (RLGL.State.stereoRender) eyeCount = 2;
 
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Measure batch draw GPU time, queries results are read some frames later by rlUpdateFrameStats()
+    bool timerQuery = (RLGL.State.gpuTimer && (RLGL.State.vertexCounter > 0) &&
+        (RLGL.State.timerQueryCount[RLGL.State.timerFrame] < RL_GPU_TIMER_QUERIES));
+
+    if (timerQuery)
+    {
+        glBeginQuery(GL_TIME_ELAPSED, RLGL.State.timerQueries[RLGL.State.timerFrame][RLGL.State.timerQueryCount[RLGL.State.timerFrame]]);
+        RLGL.State.timerQueryCount[RLGL.State.timerFrame]++;
+    }
+#endif
+
     for (int eye = 0; eye < eyeCount; eye++)
     {
         if (eyeCount == 2)
@@ -2808,6 +3411,11 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
             else
             {
+#if defined(RLGL_RENDER_BATCH_INTERLEAVED)
+                // Bind vertex attribs: position, texcoord and color (shader-location = 0, 1, 3)
+                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+                rlSetBatchVertexAttributes();
+#else
                 // Bind vertex attrib: position (shader-location = 0)
                 glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
                 glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
@@ -2822,6 +3430,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
                 glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
                 glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+#endif
 
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
             }
@@ -2838,6 +3447,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 {
                     glActiveTexture(GL_TEXTURE0 + 1 + i);
                     glBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
+                    RLGL.State.frameStats.textureBinds++;
                 }
             }
 
@@ -2845,11 +3455,33 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
             glActiveTexture(GL_TEXTURE0);
 
+            unsigned int drawShaderId = RLGL.State.currentShaderId;
+
             for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
             {
+                // Draws using SDF shapes texture replace default shader by SDF shapes shader
+                // NOTE: Vertex attributes locations are the same for all shaders (bound on shader program loading)
+                int *locs = NULL;
+                unsigned int shaderId = rlGetBatchDrawShader(batch->draws[i].textureId, &locs);
+
+                if (shaderId != drawShaderId)
+                {
+                    glUseProgram(shaderId);
+                    glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_MVP], 1, false, matMVPfloat);
+                    glUniform4f(locs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
+                    glUniform1i(locs[RL_SHADER_LOC_MAP_DIFFUSE], 0);
+
+                    RLGL.State.frameStats.stateChanges++;
+                    drawShaderId = shaderId;
+                }
+
                 // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
                 glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
 
+                RLGL.State.frameStats.textureBinds++;
+                RLGL.State.frameStats.drawCalls++;
+                RLGL.State.frameStats.vertexCount += batch->draws[i].vertexCount;
+
                 if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
                 else
                 {
@@ -2881,40 +3513,20 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         glUseProgram(0);    // Unbind shader program
     }
 
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (timerQuery) glEndQuery(GL_TIME_ELAPSED);
+#endif
+
     // Restore viewport to default measures
     if (eyeCount == 2) rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
     //------------------------------------------------------------------------------------------------------------
 
-    // Reset batch buffers
-    //------------------------------------------------------------------------------------------------------------
-    // Reset vertex counter for next frame
-    RLGL.State.vertexCounter = 0;
-
-    // Reset depth for next draw
-    batch->currentDepth = -1.0f;
-
     // Restore projection/modelview matrices
     RLGL.State.projection = matProjection;
     RLGL.State.modelview = matModelView;
 
-    // Reset RLGL.currentBatch->draws array
-    for (int i = 0; i < RL_DEFAULT_BATCH_DRAWCALLS; i++)
-    {
-        batch->draws[i].mode = RL_QUADS;
-        batch->draws[i].vertexCount = 0;
-        batch->draws[i].textureId = RLGL.State.defaultTextureId;
-    }
-
-    // Reset active texture units for next batch
-    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) RLGL.State.activeTextureId[i] = 0;
-
-    // Reset draws counter to one draw for the batch
-    batch->drawCounter = 1;
-    //------------------------------------------------------------------------------------------------------------
-
-    // Change to next buffer in the list (in case of multi-buffering)
-    batch->currentBuffer++;
-    if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
+    // Reset batch buffers
+    rlResetRenderBatch(batch);
 #endif
 }
 
@@ -2937,20 +3549,341 @@ void rlDrawRenderBatchActive(void)
 #endif
 }
 
-// Check internal buffer overflow for a given number of vertex
-// and force a rlRenderBatch draw call if required
-bool rlCheckRenderBatchLimit(int vCount)
+// Enable render batch draws sorting (2D)
+// NOTE: On batch drawing, draws are moved before previous draws (to be merged with a draw with same mode and texture)
+// only if their vertex XY bounds do not overlap, it's intended for 2D drawing where draw order defines visibility
+void rlEnableRenderBatchSorting(void)
 {
-    bool overflow = false;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlDrawRenderBatch(RLGL.currentBatch);
+    RLGL.State.sortDraws = true;
+#endif
+}
 
+// Disable render batch draws sorting
+void rlDisableRenderBatchSorting(void)
+{
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if ((RLGL.State.vertexCounter + vCount) >=
-        (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4))
-    {
-        overflow = true;
+    rlDrawRenderBatch(RLGL.currentBatch);
+    RLGL.State.sortDraws = false;
+#endif
+}
 
-        // Store current primitive drawing mode and texture id
-        int currentMode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
+// Finish current frame statistics (call once per frame), counters are reset
+// NOTE: GPU time is read from the oldest frame queries in flight (RL_GPU_TIMER_FRAMES - 1 frames latency),
+// only if all its results are available, previous GPU time is kept otherwise
+void rlUpdateFrameStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.State.gpuTimer)
+    {
+        RLGL.State.timerFrame = (RLGL.State.timerFrame + 1)%RL_GPU_TIMER_FRAMES;
+
+        int queryCount = RLGL.State.timerQueryCount[RLGL.State.timerFrame];
+
+        if (queryCount > 0)
+        {
+            GLint available = 0;
+            glGetQueryObjectiv(RLGL.State.timerQueries[RLGL.State.timerFrame][queryCount - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+
+            if (available)
+            {
+                GLuint64 time = 0;
+                GLuint64 elapsed = 0;
+
+                for (int i = 0; i < queryCount; i++)
+                {
+                    glGetQueryObjectui64v(RLGL.State.timerQueries[RLGL.State.timerFrame][i], GL_QUERY_RESULT, &elapsed);
+                    time += elapsed;
+                }
+
+                RLGL.State.gpuTime = (float)((double)time/1000000.0);
+            }
+        }
+
+        RLGL.State.timerQueryCount[RLGL.State.timerFrame] = 0;
+    }
+#endif
+
+    RLGL.State.frameStats.gpuTime = RLGL.State.gpuTimer? RLGL.State.gpuTime : -1.0f;
+    RLGL.State.lastFrameStats = RLGL.State.frameStats;
+    RLGL.State.frameStats = (rlFrameStats){ 0 };
+#endif
+}
+
+// Get last finished frame statistics
+rlFrameStats rlGetFrameStats(void)
+{
+    rlFrameStats stats = { 0 };
+    stats.gpuTime = -1.0f;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    stats = RLGL.State.lastFrameStats;
+#endif
+
+    return stats;
+}
+
+// Enable GPU timer queries on render batch draws (if supported)
+// NOTE: Only render batch draws are measured, queries are loaded on first enable
+void rlEnableGpuTimer(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (!RLGL.ExtSupported.timerQuery)
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: GPU timer queries not supported");
+        return;
+    }
+
+    if (RLGL.State.timerQueries[0][0] == 0) glGenQueries(RL_GPU_TIMER_FRAMES*RL_GPU_TIMER_QUERIES, &RLGL.State.timerQueries[0][0]);
+
+    for (int i = 0; i < RL_GPU_TIMER_FRAMES; i++) RLGL.State.timerQueryCount[i] = 0;
+    RLGL.State.gpuTime = 0.0f;
+    RLGL.State.gpuTimer = true;
+#else
+    TRACELOG(RL_LOG_WARNING, "GL: GPU timer queries not supported");
+#endif
+}
+
+// Disable GPU timer queries
+void rlDisableGpuTimer(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    RLGL.State.gpuTimer = false;
+#endif
+}
+
+// Begin display list recording, render batch draws are recorded instead of drawn
+// NOTE: Vertex data is recorded as submitted to the render batch, modelview and projection matrices
+// are applied on rlDrawDisplayList(), additional active textures (rlActiveTextureSlot()) are not recorded
+void rlBeginDisplayList(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.displayListRecording)
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Display list already being recorded");
+        return;
+    }
+
+    rlDrawRenderBatch(RLGL.currentBatch);   // Previous batch draws are not part of the display list
+
+    RLGL.State.displayListRecording = true;
+    RLGL.State.displayListVertexCount = 0;
+    RLGL.State.displayListIndexCount = 0;
+    RLGL.State.displayListDrawCount = 0;
+#endif
+}
+
+// End display list recording, recorded vertex data is uploaded to GPU
+rlDisplayList rlEndDisplayList(void)
+{
+    rlDisplayList list = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.State.displayListRecording)
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Display list not being recorded");
+        return list;
+    }
+
+    rlDrawRenderBatch(RLGL.currentBatch);   // Record pending batch draws
+    RLGL.State.displayListRecording = false;
+
+    if (RLGL.State.displayListVertexCount > 0)
+    {
+        rlBatchVertex *vertices = RLGL.State.displayListVertices;
+        int vertexCount = RLGL.State.displayListVertexCount;
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+        // NOTE: OpenGL ES 2.0 indices are 16bit, display list vertex are unindexed if more vertex are required
+        unsigned short *indices = NULL;
+
+        if (vertexCount <= 65536)
+        {
+            indices = (unsigned short *)RL_MALLOC(RLGL.State.displayListIndexCount*sizeof(unsigned short));
+            for (int i = 0; i < RLGL.State.displayListIndexCount; i++) indices[i] = (unsigned short)RLGL.State.displayListIndices[i];
+        }
+        else
+        {
+            vertexCount = RLGL.State.displayListIndexCount;
+            vertices = (rlBatchVertex *)RL_MALLOC(vertexCount*sizeof(rlBatchVertex));
+            for (int i = 0; i < vertexCount; i++) vertices[i] = RLGL.State.displayListVertices[RLGL.State.displayListIndices[i]];
+        }
+#else
+        unsigned int *indices = RLGL.State.displayListIndices;
+#endif
+        if (RLGL.ExtSupported.vao)
+        {
+            glGenVertexArrays(1, &list.vaoId);
+            glBindVertexArray(list.vaoId);
+        }
+
+        glGenBuffers(1, &list.vboId[0]);
+        glBindBuffer(GL_ARRAY_BUFFER, list.vboId[0]);
+        glBufferData(GL_ARRAY_BUFFER, vertexCount*sizeof(rlBatchVertex), vertices, GL_STATIC_DRAW);
+
+        if (indices != NULL)
+        {
+            glGenBuffers(1, &list.vboId[1]);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, list.vboId[1]);
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, RLGL.State.displayListIndexCount*sizeof(indices[0]), indices, GL_STATIC_DRAW);
+        }
+
+        if (RLGL.ExtSupported.vao)
+        {
+            rlSetDisplayListVertexAttributes();
+            glBindVertexArray(0);
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+        RL_FREE(indices);
+        if (vertices != RLGL.State.displayListVertices) RL_FREE(vertices);
+#endif
+        list.vertexCount = vertexCount;
+        list.drawCount = RLGL.State.displayListDrawCount;
+        list.draws = (rlDisplayListDraw *)RL_MALLOC(list.drawCount*sizeof(rlDisplayListDraw));
+        memcpy(list.draws, RLGL.State.displayListDraws, list.drawCount*sizeof(rlDisplayListDraw));
+
+        TRACELOG(RL_LOG_INFO, "RLGL: [VBO ID %i] Display list loaded successfully (%i vertex, %i draws)", list.vboId[0], list.vertexCount, list.drawCount);
+    }
+    else TRACELOG(RL_LOG_WARNING, "RLGL: Display list recorded without vertex data");
+
+    // Recording buffers are not kept, vertex data lives in GPU memory
+    RL_FREE(RLGL.State.displayListVertices);
+    RL_FREE(RLGL.State.displayListIndices);
+    RL_FREE(RLGL.State.displayListDraws);
+    RLGL.State.displayListVertices = NULL;
+    RLGL.State.displayListIndices = NULL;
+    RLGL.State.displayListDraws = NULL;
+    RLGL.State.displayListVertexCount = 0;
+    RLGL.State.displayListVertexCapacity = 0;
+    RLGL.State.displayListIndexCount = 0;
+    RLGL.State.displayListIndexCapacity = 0;
+    RLGL.State.displayListDrawCount = 0;
+    RLGL.State.displayListDrawCapacity = 0;
+#endif
+
+    return list;
+}
+
+// Draw display list with a transform and tint
+// NOTE: Transform is applied before current modelview (and current transform matrix, if pushed),
+// tint is set as shader diffuse color, draws are issued with the shaders active when recorded
+void rlDrawDisplayList(rlDisplayList list, Matrix transform, unsigned char r, unsigned char g, unsigned char b, unsigned char a)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (list.vboId[0] == 0) return;
+
+    if (RLGL.State.displayListRecording)
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Display list can not be drawn while recording a display list");
+        return;
+    }
+
+    rlDrawRenderBatch(RLGL.currentBatch);   // Previous batch draws are drawn first to keep drawing order
+
+    Matrix matModel = transform;
+    if (RLGL.State.transformRequired) matModel = rlMatrixMultiply(transform, RLGL.State.transform);
+
+    Matrix matMVP = rlMatrixMultiply(rlMatrixMultiply(matModel, RLGL.State.modelview), RLGL.State.projection);
+    float matMVPfloat[16] = {
+        matMVP.m0, matMVP.m1, matMVP.m2, matMVP.m3,
+        matMVP.m4, matMVP.m5, matMVP.m6, matMVP.m7,
+        matMVP.m8, matMVP.m9, matMVP.m10, matMVP.m11,
+        matMVP.m12, matMVP.m13, matMVP.m14, matMVP.m15
+    };
+
+    if (RLGL.ExtSupported.vao) glBindVertexArray(list.vaoId);
+    else
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, list.vboId[0]);
+        rlSetDisplayListVertexAttributes();
+        if (list.vboId[1] > 0) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, list.vboId[1]);
+    }
+
+    glActiveTexture(GL_TEXTURE0);
+
+    for (int i = 0, vertexOffset = 0; i < list.drawCount; i++)
+    {
+        if ((i == 0) || (list.draws[i].shaderId != list.draws[i - 1].shaderId))
+        {
+            glUseProgram(list.draws[i].shaderId);
+
+            glUniformMatrix4fv(list.draws[i].shaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, matMVPfloat);
+            glUniform4f(list.draws[i].shaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], (float)r/255.0f, (float)g/255.0f, (float)b/255.0f, (float)a/255.0f);
+            glUniform1i(list.draws[i].shaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
+
+            RLGL.State.frameStats.stateChanges++;
+        }
+
+        if ((i == 0) || (list.draws[i].textureId != list.draws[i - 1].textureId))
+        {
+            glBindTexture(GL_TEXTURE_2D, list.draws[i].textureId);
+            RLGL.State.frameStats.textureBinds++;
+        }
+
+        RLGL.State.frameStats.drawCalls++;
+        RLGL.State.frameStats.vertexCount += list.draws[i].vertexCount;
+
+        if (list.vboId[1] == 0) glDrawArrays(list.draws[i].mode, vertexOffset, list.draws[i].vertexCount);
+        else
+        {
+#if defined(GRAPHICS_API_OPENGL_33)
+            glDrawElements(list.draws[i].mode, list.draws[i].vertexCount, GL_UNSIGNED_INT, (GLvoid *)(vertexOffset*sizeof(GLuint)));
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+            glDrawElements(list.draws[i].mode, list.draws[i].vertexCount, GL_UNSIGNED_SHORT, (GLvoid *)(vertexOffset*sizeof(GLushort)));
+#endif
+        }
+
+        vertexOffset += list.draws[i].vertexCount;
+    }
+
+    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    else
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    }
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glUseProgram(0);
+#endif
+}
+
+// Unload display list from GPU memory (VRAM)
+void rlUnloadDisplayList(rlDisplayList list)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (list.vboId[0] == 0) return;
+
+    if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &list.vaoId);
+    glDeleteBuffers(1, &list.vboId[0]);
+    if (list.vboId[1] > 0) glDeleteBuffers(1, &list.vboId[1]);
+    RL_FREE(list.draws);
+
+    TRACELOG(RL_LOG_INFO, "RLGL: [VBO ID %i] Display list unloaded successfully", list.vboId[0]);
+#endif
+}
+
+// Check internal buffer overflow for a given number of vertex
+// and force a rlRenderBatch draw call if required
+bool rlCheckRenderBatchLimit(int vCount)
+{
+    bool overflow = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((RLGL.State.vertexCounter + vCount) >=
+        (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4))
+    {
+        overflow = true;
+
+        // Store current primitive drawing mode and texture id
+        int currentMode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
         int currentTexture = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId;
 
         rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
@@ -3660,7 +4593,62 @@ void rlUpdateVertexBuffer(unsigned int id, const void *data, int dataSize, int o
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ARRAY_BUFFER, id);
     glBufferSubData(GL_ARRAY_BUFFER, offset, dataSize, data);
+
+    RLGL.State.frameStats.bufferUploads++;
+    RLGL.State.frameStats.bufferUploadSize += dataSize;
+#endif
+}
+
+// Update streamed vertex buffer with new data, returns buffer id and data offset
+// NOTE: Data is appended to a single buffer reused by all calls, when buffer is full it is orphaned
+// (new storage requested) instead of overwriting data that could be in use by previous draw calls
+// NOTE: Returned buffer is bound, dataSize and offset are provided in bytes
+unsigned int rlUpdateVertexBufferStream(const void *data, int dataSize, int *offset)
+{
+    unsigned int id = 0;
+    *offset = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (dataSize > RLGL.State.streamBufferSize)
+    {
+        // Buffer too small, reload it with enough space for several updates
+        if (RLGL.State.streamBufferId != 0) glDeleteBuffers(1, &RLGL.State.streamBufferId);
+
+        RLGL.State.streamBufferSize = (2*RLGL.State.streamBufferSize > RL_DEFAULT_STREAM_BUFFER_SIZE)? 2*RLGL.State.streamBufferSize : RL_DEFAULT_STREAM_BUFFER_SIZE;
+        if (RLGL.State.streamBufferSize < 4*dataSize) RLGL.State.streamBufferSize = 4*dataSize;
+
+        glGenBuffers(1, &RLGL.State.streamBufferId);
+        glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.streamBufferId);
+        glBufferData(GL_ARRAY_BUFFER, RLGL.State.streamBufferSize, NULL, GL_STREAM_DRAW);
+        RLGL.State.streamBufferOffset = 0;
+
+        TRACELOG(RL_LOG_DEBUG, "VBO: [ID %i] Streamed vertex buffer loaded (%i bytes)", RLGL.State.streamBufferId, RLGL.State.streamBufferSize);
+    }
+    else
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, RLGL.State.streamBufferId);
+
+        if ((RLGL.State.streamBufferOffset + dataSize) > RLGL.State.streamBufferSize)
+        {
+            // Orphan buffer storage, driver keeps previous storage until draw calls using it are finished
+            glBufferData(GL_ARRAY_BUFFER, RLGL.State.streamBufferSize, NULL, GL_STREAM_DRAW);
+            RLGL.State.streamBufferOffset = 0;
+        }
+    }
+
+    glBufferSubData(GL_ARRAY_BUFFER, RLGL.State.streamBufferOffset, dataSize, data);
+    *offset = RLGL.State.streamBufferOffset;
+
+    RLGL.State.frameStats.bufferUploads++;
+    RLGL.State.frameStats.bufferUploadSize += dataSize;
+
+    // NOTE: Offset is kept aligned to 16 bytes
+    RLGL.State.streamBufferOffset += (dataSize + 15) & ~15;
+
+    id = RLGL.State.streamBufferId;
 #endif
+
+    return id;
 }
 
 // Update vertex buffer elements with new data
@@ -3670,6 +4658,9 @@ void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSiz
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
     glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, dataSize, data);
+
+    RLGL.State.frameStats.bufferUploads++;
+    RLGL.State.frameStats.bufferUploadSize += dataSize;
 #endif
 }
 
@@ -3715,6 +4706,10 @@ void rlDisableVertexAttribute(unsigned int index)
 void rlDrawVertexArray(int offset, int count)
 {
     glDrawArrays(GL_TRIANGLES, offset, count);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.frameStats.drawCalls++;
+    RLGL.State.frameStats.vertexCount += count;
+#endif
 }
 
 // Draw vertex array elements
@@ -3725,6 +4720,10 @@ void rlDrawVertexArrayElements(int offset, int count, const void *buffer)
     if (offset > 0) bufferPtr += offset;
 
     glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.frameStats.drawCalls++;
+    RLGL.State.frameStats.vertexCount += count;
+#endif
 }
 
 // Draw vertex array instanced
@@ -3732,6 +4731,8 @@ void rlDrawVertexArrayInstanced(int offset, int count, int instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDrawArraysInstanced(GL_TRIANGLES, 0, count, instances);
+    RLGL.State.frameStats.drawCalls++;
+    RLGL.State.frameStats.vertexCount += count*instances;
 #endif
 }
 
@@ -3744,6 +4745,8 @@ void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffe
     if (offset > 0) bufferPtr += offset;
 
     glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr, instances);
+    RLGL.State.frameStats.drawCalls++;
+    RLGL.State.frameStats.vertexCount += count*instances;
 #endif
 }
 
@@ -3833,68 +4836,82 @@ unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode)
     unsigned int vertexShaderId = 0;
     unsigned int fragmentShaderId = 0;
 
-    // Compile vertex shader (if provided)
-    if (vsCode != NULL) vertexShaderId = rlCompileShader(vsCode, GL_VERTEX_SHADER);
-    // In case no vertex shader was provided or compilation failed, we use default vertex shader
-    if (vertexShaderId == 0) vertexShaderId = RLGL.State.defaultVShaderId;
+    // In case no shader code is provided, we just assign the default shader program id,
+    // otherwise, program is loaded from binary cache (if available), using default shader code for the missing one
+    if ((vsCode == NULL) && (fsCode == NULL)) id = RLGL.State.defaultShaderId;
+    else id = rlLoadShaderProgramCache((vsCode != NULL)? vsCode : RLGL.State.defaultVShaderCode, (fsCode != NULL)? fsCode : RLGL.State.defaultFShaderCode);
 
-    // Compile fragment shader (if provided)
-    if (fsCode != NULL) fragmentShaderId = rlCompileShader(fsCode, GL_FRAGMENT_SHADER);
-    // In case no fragment shader was provided or compilation failed, we use default fragment shader
-    if (fragmentShaderId == 0) fragmentShaderId = RLGL.State.defaultFShaderId;
-
-    // In case vertex and fragment shader are the default ones, no need to recompile, we can just assign the default shader program id
-    if ((vertexShaderId == RLGL.State.defaultVShaderId) && (fragmentShaderId == RLGL.State.defaultFShaderId)) id = RLGL.State.defaultShaderId;
-    else
+    if (id == 0)
     {
-        // One of or both shader are new, we need to compile a new shader program
-        id = rlLoadShaderProgram(vertexShaderId, fragmentShaderId);
+        // Compile vertex shader (if provided)
+        if (vsCode != NULL) vertexShaderId = rlCompileShader(vsCode, GL_VERTEX_SHADER);
 
-        // We can detach and delete vertex/fragment shaders (if not default ones)
-        // NOTE: We detach shader before deletion to make sure memory is freed
-        if (vertexShaderId != RLGL.State.defaultVShaderId)
-        {
-            // WARNING: Shader program linkage could fail and returned id is 0
-            if (id > 0) glDetachShader(id, vertexShaderId);
-            glDeleteShader(vertexShaderId);
-        }
-        if (fragmentShaderId != RLGL.State.defaultFShaderId)
-        {
-            // WARNING: Shader program linkage could fail and returned id is 0
-            if (id > 0) glDetachShader(id, fragmentShaderId);
-            glDeleteShader(fragmentShaderId);
-        }
+        // Compile fragment shader (if provided)
+        if (fsCode != NULL) fragmentShaderId = rlCompileShader(fsCode, GL_FRAGMENT_SHADER);
 
-        // In case shader program loading failed, we assign default shader
-        if (id == 0)
-        {
-            // In case shader loading fails, we return the default shader
-            TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load custom shader code, using default shader");
-            id = RLGL.State.defaultShaderId;
-        }
-        /*
+        // In case no shader was provided or compilation failed, we use default shaders
+        // NOTE: Default shaders are not compiled if default shader program was loaded from cache
+        if ((vertexShaderId == 0) || (fragmentShaderId == 0)) rlCompileShaderDefault();
+        if (vertexShaderId == 0) vertexShaderId = RLGL.State.defaultVShaderId;
+        if (fragmentShaderId == 0) fragmentShaderId = RLGL.State.defaultFShaderId;
+
+        // In case vertex and fragment shader are the default ones, no need to recompile, we can just assign the default shader program id
+        if ((vertexShaderId == RLGL.State.defaultVShaderId) && (fragmentShaderId == RLGL.State.defaultFShaderId)) id = RLGL.State.defaultShaderId;
         else
         {
-            // Get available shader uniforms
-            // NOTE: This information is useful for debug...
-            int uniformCount = -1;
-            glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &uniformCount);
+            // One of or both shader are new, we need to compile a new shader program
+            id = rlLoadShaderProgram(vertexShaderId, fragmentShaderId);
 
-            for (int i = 0; i < uniformCount; i++)
+            // Save program binary to cache, keyed by the shaders code actually linked
+            rlSaveShaderProgramCache(id, (vertexShaderId == RLGL.State.defaultVShaderId)? RLGL.State.defaultVShaderCode : vsCode,
+                (fragmentShaderId == RLGL.State.defaultFShaderId)? RLGL.State.defaultFShaderCode : fsCode);
+
+            // We can detach and delete vertex/fragment shaders (if not default ones)
+            // NOTE: We detach shader before deletion to make sure memory is freed
+            if (vertexShaderId != RLGL.State.defaultVShaderId)
+            {
+                // WARNING: Shader program linkage could fail and returned id is 0
+                if (id > 0) glDetachShader(id, vertexShaderId);
+                glDeleteShader(vertexShaderId);
+            }
+            if (fragmentShaderId != RLGL.State.defaultFShaderId)
+            {
+                // WARNING: Shader program linkage could fail and returned id is 0
+                if (id > 0) glDetachShader(id, fragmentShaderId);
+                glDeleteShader(fragmentShaderId);
+            }
+
+            // In case shader program loading failed, we assign default shader
+            if (id == 0)
+            {
+                // In case shader loading fails, we return the default shader
+                TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load custom shader code, using default shader");
+                id = RLGL.State.defaultShaderId;
+            }
+            /*
+            else
             {
-                int namelen = -1;
-                int num = -1;
-                char name[256] = { 0 };     // Assume no variable names longer than 256
-                GLenum type = GL_ZERO;
+                // Get available shader uniforms
+                // NOTE: This information is useful for debug...
+                int uniformCount = -1;
+                glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &uniformCount);
+
+                for (int i = 0; i < uniformCount; i++)
+                {
+                    int namelen = -1;
+                    int num = -1;
+                    char name[256] = { 0 };     // Assume no variable names longer than 256
+                    GLenum type = GL_ZERO;
 
-                // Get the name of the uniforms
-                glGetActiveUniform(id, i, sizeof(name) - 1, &namelen, &num, &type, name);
+                    // Get the name of the uniforms
+                    glGetActiveUniform(id, i, sizeof(name) - 1, &namelen, &num, &type, name);
 
-                name[namelen] = 0;
-                TRACELOGD("SHADER: [ID %i] Active uniform (%s) set at location: %i", id, name, glGetUniformLocation(id, name));
+                    name[namelen] = 0;
+                    TRACELOGD("SHADER: [ID %i] Active uniform (%s) set at location: %i", id, name, glGetUniformLocation(id, name));
+                }
             }
+            */
         }
-        */
     }
 #endif
 
@@ -3976,9 +4993,19 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
     glBindAttribLocation(program, 3, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
     glBindAttribLocation(program, 4, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
     glBindAttribLocation(program, 5, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    glBindAttribLocation(program, 6, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS);
+    glBindAttribLocation(program, 7, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS);
+
+    // NOTE: Instance transform matrix requires 4 locations, only bound if supported (OpenGL ES 2.0 minimum is 8)
+    if (RLGL.ExtSupported.maxVertexAttribs >= 12) glBindAttribLocation(program, 8, RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TX);
 
     // NOTE: If some attrib name is no found on the shader, it locations becomes -1
 
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Request program binary to be retrievable, required for shader programs cache
+    if (RLGL.ExtSupported.programBinary && (RLGL.State.saveShaderCache != NULL)) glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif
+
     glLinkProgram(program);
 
     // NOTE: All uniform variables are intitialised to 0 when a program links
@@ -4028,6 +5055,17 @@ void rlUnloadShaderProgram(unsigned int id)
 #endif
 }
 
+// Set shader program binary cache callbacks (NULL to disable)
+// NOTE: Cache is used by rlLoadShaderCode() and internal shaders, it must be set before rlglInit() to include default shader,
+// programs binaries are only available with OpenGL 4.1 or GL_ARB_get_program_binary
+void rlSetShaderCacheCallbacks(rlLoadShaderCacheCallback loadCallback, rlSaveShaderCacheCallback saveCallback)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.State.loadShaderCache = loadCallback;
+    RLGL.State.saveShaderCache = saveCallback;
+#endif
+}
+
 // Get shader location uniform
 int rlGetLocationUniform(unsigned int shaderId, const char *uniformName)
 {
@@ -4103,6 +5141,33 @@ void rlSetUniformMatrix(int locIndex, Matrix mat)
 #endif
 }
 
+// Set shader value matrix array
+void rlSetUniformMatrices(int locIndex, const Matrix *matrices, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    // NOTE: Matrix struct data is row-major, it can be transposed on upload
+    glUniformMatrix4fv(locIndex, count, true, (const float *)matrices);
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    // WARNING: OpenGL ES 2.0 does not support matrix transpose on upload
+    float *matfloat = (float *)RL_MALLOC(count*16*sizeof(float));
+
+    for (int i = 0; i < count; i++)
+    {
+        const Matrix mat = matrices[i];
+        float *dst = matfloat + i*16;
+
+        dst[0] = mat.m0; dst[1] = mat.m1; dst[2] = mat.m2; dst[3] = mat.m3;
+        dst[4] = mat.m4; dst[5] = mat.m5; dst[6] = mat.m6; dst[7] = mat.m7;
+        dst[8] = mat.m8; dst[9] = mat.m9; dst[10] = mat.m10; dst[11] = mat.m11;
+        dst[12] = mat.m12; dst[13] = mat.m13; dst[14] = mat.m14; dst[15] = mat.m15;
+    }
+
+    glUniformMatrix4fv(locIndex, count, false, matfloat);
+
+    RL_FREE(matfloat);
+#endif
+}
+
 // Set shader value uniform sampler
 void rlSetUniformSampler(int locIndex, unsigned int textureId)
 {
@@ -4131,6 +5196,7 @@ void rlSetShader(unsigned int id, int *locs)
     if (RLGL.State.currentShaderId != id)
     {
         rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.frameStats.stateChanges++;
         RLGL.State.currentShaderId = id;
         RLGL.State.currentShaderLocs = locs;
     }
@@ -4646,12 +5712,21 @@ static void rlLoadShaderDefault(void)
     "}                                  \n";
 #endif
 
-    // NOTE: Compiled vertex/fragment shaders are not deleted,
-    // they are kept for re-use as default shaders in case some shader loading fails
-    RLGL.State.defaultVShaderId = rlCompileShader(defaultVShaderCode, GL_VERTEX_SHADER);     // Compile default vertex shader
-    RLGL.State.defaultFShaderId = rlCompileShader(defaultFShaderCode, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+    // NOTE: Default shaders code is kept, default shaders are compiled on first use if program is loaded from cache
+    RLGL.State.defaultVShaderCode = defaultVShaderCode;
+    RLGL.State.defaultFShaderCode = defaultFShaderCode;
+
+    RLGL.State.defaultShaderId = rlLoadShaderProgramCache(defaultVShaderCode, defaultFShaderCode);
+
+    if (RLGL.State.defaultShaderId == 0)
+    {
+        // NOTE: Compiled vertex/fragment shaders are not deleted,
+        // they are kept for re-use as default shaders in case some shader loading fails
+        rlCompileShaderDefault();
 
-    RLGL.State.defaultShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
+        RLGL.State.defaultShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
+        rlSaveShaderProgramCache(RLGL.State.defaultShaderId, defaultVShaderCode, defaultFShaderCode);
+    }
 
     if (RLGL.State.defaultShaderId > 0)
     {
@@ -4676,37 +5751,572 @@ static void rlUnloadShaderDefault(void)
 {
     glUseProgram(0);
 
-    glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
-    glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
-    glDeleteShader(RLGL.State.defaultVShaderId);
-    glDeleteShader(RLGL.State.defaultFShaderId);
+    // NOTE: Default shaders are not attached if default shader program was loaded from cache
+    // and they are only compiled if required, shaders still attached are deleted with the program
+    if (RLGL.State.defaultVShaderId > 0) glDeleteShader(RLGL.State.defaultVShaderId);
+    if (RLGL.State.defaultFShaderId > 0) glDeleteShader(RLGL.State.defaultFShaderId);
 
     glDeleteProgram(RLGL.State.defaultShaderId);
 
     RL_FREE(RLGL.State.defaultShaderLocs);
 
+    RLGL.State.defaultVShaderId = 0;
+    RLGL.State.defaultFShaderId = 0;
+
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
 }
 
-#if defined(RLGL_SHOW_GL_DETAILS_INFO)
-// Get compressed format official GL identifier name
-static const char *rlGetCompressedFormatName(int format)
+// Load SDF text shader (distance field stored in texture alpha channel, edge at 0.5)
+// NOTE: Default vertex shader is reused, only a fragment shader is compiled
+// NOTE: Loaded: RLGL.State.sdfShaderId, RLGL.State.sdfShaderLocs
+static void rlLoadShaderSdf(void)
 {
-    switch (format)
-    {
-        // GL_EXT_texture_compression_s3tc
-        case 0x83F0: return "GL_COMPRESSED_RGB_S3TC_DXT1_EXT"; break;
-        case 0x83F1: return "GL_COMPRESSED_RGBA_S3TC_DXT1_EXT"; break;
-        case 0x83F2: return "GL_COMPRESSED_RGBA_S3TC_DXT3_EXT"; break;
-        case 0x83F3: return "GL_COMPRESSED_RGBA_S3TC_DXT5_EXT"; break;
-        // GL_3DFX_texture_compression_FXT1
-        case 0x86B0: return "GL_COMPRESSED_RGB_FXT1_3DFX"; break;
-        case 0x86B1: return "GL_COMPRESSED_RGBA_FXT1_3DFX"; break;
-        // GL_IMG_texture_compression_pvrtc
-        case 0x8C00: return "GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG"; break;
-        case 0x8C01: return "GL_COMPRESSED_RGB_PVRTC_2BPPV1_IMG"; break;
-        case 0x8C02: return "GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG"; break;
-        case 0x8C03: return "GL_COMPRESSED_RGBA_PVRTC_2BPPV1_IMG"; break;
+    RLGL.State.sdfShaderLocs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+
+    // NOTE: All locations must be reseted to -1 (no location)
+    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.State.sdfShaderLocs[i] = -1;
+
+    // Fragment shader directly defined, no external file required
+    // NOTE: Edge smoothing is computed with screen-space derivatives, so text is crisp at any scale
+    const char *sdfFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float distance = texture2D(texture0, fragTexCoord).a; \n"
+    "    float smoothing = 0.5*fwidth(distance);               \n"
+    "    float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance); \n"
+    "    gl_FragColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse;     \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float distance = texture(texture0, fragTexCoord).a;   \n"
+    "    float smoothing = 0.5*fwidth(distance);               \n"
+    "    float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance); \n"
+    "    finalColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse;       \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "#extension GL_OES_standard_derivatives : enable \n"   // Required for fwidth(), fixed smoothing otherwise
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform sampler2D texture0;        \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    float distance = texture2D(texture0, fragTexCoord).a; \n"
+    "#if defined(GL_OES_standard_derivatives)                  \n"
+    "    float smoothing = 0.5*fwidth(distance);               \n"
+    "#else                                                     \n"
+    "    float smoothing = 0.04;                               \n"
+    "#endif                                                    \n"
+    "    float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance); \n"
+    "    gl_FragColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse;     \n"
+    "}                                  \n";
+#endif
+
+    RLGL.State.sdfShaderId = rlLoadShaderProgramCache(RLGL.State.defaultVShaderCode, sdfFShaderCode);
+
+    if (RLGL.State.sdfShaderId == 0)
+    {
+        rlCompileShaderDefault();
+        unsigned int fShaderId = rlCompileShader(sdfFShaderCode, GL_FRAGMENT_SHADER);
+
+        RLGL.State.sdfShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, fShaderId);
+        rlSaveShaderProgramCache(RLGL.State.sdfShaderId, RLGL.State.defaultVShaderCode, sdfFShaderCode);
+
+        // NOTE: Fragment shader is not required once linked, default vertex shader is kept for default shader
+        if (RLGL.State.sdfShaderId > 0)
+        {
+            glDetachShader(RLGL.State.sdfShaderId, RLGL.State.defaultVShaderId);
+            glDetachShader(RLGL.State.sdfShaderId, fShaderId);
+        }
+        glDeleteShader(fShaderId);
+    }
+
+    if (RLGL.State.sdfShaderId > 0)
+    {
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] SDF text shader loaded successfully", RLGL.State.sdfShaderId);
+
+        // Set SDF shader locations, same attributes and uniforms as default shader
+        RLGL.State.sdfShaderLocs[RL_SHADER_LOC_VERTEX_POSITION] = glGetAttribLocation(RLGL.State.sdfShaderId, "vertexPosition");
+        RLGL.State.sdfShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(RLGL.State.sdfShaderId, "vertexTexCoord");
+        RLGL.State.sdfShaderLocs[RL_SHADER_LOC_VERTEX_COLOR] = glGetAttribLocation(RLGL.State.sdfShaderId, "vertexColor");
+        RLGL.State.sdfShaderLocs[RL_SHADER_LOC_MATRIX_MVP]  = glGetUniformLocation(RLGL.State.sdfShaderId, "mvp");
+        RLGL.State.sdfShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.sdfShaderId, "colDiffuse");
+        RLGL.State.sdfShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.sdfShaderId, "texture0");
+    }
+    else TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load SDF text shader");
+}
+
+// Unload SDF text shader
+// NOTE: Unloads: RLGL.State.sdfShaderId, RLGL.State.sdfShaderLocs
+static void rlUnloadShaderSdf(void)
+{
+    if (RLGL.State.sdfShaderId > 0)
+    {
+        glUseProgram(0);
+        glDeleteProgram(RLGL.State.sdfShaderId);
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] SDF text shader unloaded successfully", RLGL.State.sdfShaderId);
+    }
+
+    RL_FREE(RLGL.State.sdfShaderLocs);
+    RLGL.State.sdfShaderId = 0;
+    RLGL.State.sdfShaderLocs = NULL;
+}
+
+// Load SDF shapes shader (analytic anti-aliased shapes, one quad per shape) and SDF shapes texture
+// NOTE: Shape quads encode the shape kind and one parameter in small texcoords cell offsets (up to 64), shape size
+// in pixels is computed from texcoords screen-space derivatives, so edges are anti-aliased at any scale with 4 vertices
+// NOTE: Shader is only used by batch draws using SDF shapes texture, see rlGetBatchDrawShader()
+// NOTE: Default vertex shader is reused, only a fragment shader is compiled
+// NOTE: Loaded: RLGL.State.sdfShapesShaderId, RLGL.State.sdfShapesShaderLocs, RLGL.State.sdfShapesTextureId
+static void rlLoadShaderSdfShapes(void)
+{
+    RLGL.State.sdfShapesShaderLocs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+
+    // NOTE: All locations must be reseted to -1 (no location)
+    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.State.sdfShapesShaderLocs[i] = -1;
+
+    // Fragment shader directly defined, no external file required
+    const char *sdfShapesFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 cell = floor((fragTexCoord + 2.0)/4.0);      \n"     // Texcoords store: cell*4 + uv, uv in (-2.0, 2.0) range
+    "    vec2 uv = fragTexCoord - 4.0*cell;                \n"     // Position from shape center, shape edges at uv = 1.0
+    "    float code = (cell.x + 16.0) + 32.0*(cell.y + 8.0); \n"     // Shape code: kind*256 + param*254
+    "    float kind = floor(code/256.0);                   \n"
+    "    float param = (code - 256.0*kind)/254.0;          \n"
+    "    vec2 size = 1.0/vec2(length(vec2(dFdx(uv.x), dFdy(uv.x))), length(vec2(dFdx(uv.y), dFdy(uv.y)))); \n"     // Shape half-size (pixels), only scales anti-aliasing ramp and corners radius
+    "    vec2 p = uv*size;                                 \n"     // Fragment position from shape center (pixels)
+    "    float d = 0.0;                                    \n"
+    "    if (kind < 0.5)                                   \n"     // Rounded box, param: roundness
+    "    {                                                 \n"
+    "        float r = param*min(size.x, size.y);          \n"
+    "        vec2 q = abs(p) - size + r;                   \n"
+    "        d = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - r; \n"
+    "    }                                                 \n"
+    "    else                                              \n"     // Ring, param: inner radius/outer radius
+    "    {                                                 \n"
+    "        float l = length(p);                          \n"
+    "        d = max(l - size.x, param*size.x - l);        \n"
+    "    }                                                 \n"
+    "    float alpha = clamp(0.5 - d, 0.0, 1.0);           \n"
+    "    gl_FragColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse; \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "out vec4 finalColor;               \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 cell = floor((fragTexCoord + 2.0)/4.0);      \n"     // Texcoords store: cell*4 + uv, uv in (-2.0, 2.0) range
+    "    vec2 uv = fragTexCoord - 4.0*cell;                \n"     // Position from shape center, shape edges at uv = 1.0
+    "    float code = (cell.x + 16.0) + 32.0*(cell.y + 8.0); \n"     // Shape code: kind*256 + param*254
+    "    float kind = floor(code/256.0);                   \n"
+    "    float param = (code - 256.0*kind)/254.0;          \n"
+    "    vec2 size = 1.0/vec2(length(vec2(dFdx(uv.x), dFdy(uv.x))), length(vec2(dFdx(uv.y), dFdy(uv.y)))); \n"     // Shape half-size (pixels), only scales anti-aliasing ramp and corners radius
+    "    vec2 p = uv*size;                                 \n"     // Fragment position from shape center (pixels)
+    "    float d = 0.0;                                    \n"
+    "    if (kind < 0.5)                                   \n"     // Rounded box, param: roundness
+    "    {                                                 \n"
+    "        float r = param*min(size.x, size.y);          \n"
+    "        vec2 q = abs(p) - size + r;                   \n"
+    "        d = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - r; \n"
+    "    }                                                 \n"
+    "    else                                              \n"     // Ring, param: inner radius/outer radius
+    "    {                                                 \n"
+    "        float l = length(p);                          \n"
+    "        d = max(l - size.x, param*size.x - l);        \n"
+    "    }                                                 \n"
+    "    float alpha = clamp(0.5 - d, 0.0, 1.0);           \n"
+    "    finalColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse; \n"
+    "}                                  \n";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "#extension GL_OES_standard_derivatives : require \n"    // Required for dFdx()/dFdy(), shader fails to load otherwise
+    "#if defined(GL_FRAGMENT_PRECISION_HIGH) \n"
+    "precision highp float;             \n"     // Texcoords offsets require high precision
+    "#else                              \n"
+    "precision mediump float;           \n"
+    "#endif                             \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "uniform vec4 colDiffuse;           \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec2 cell = floor((fragTexCoord + 2.0)/4.0);      \n"     // Texcoords store: cell*4 + uv, uv in (-2.0, 2.0) range
+    "    vec2 uv = fragTexCoord - 4.0*cell;                \n"     // Position from shape center, shape edges at uv = 1.0
+    "    float code = (cell.x + 16.0) + 32.0*(cell.y + 8.0); \n"     // Shape code: kind*256 + param*254
+    "    float kind = floor(code/256.0);                   \n"
+    "    float param = (code - 256.0*kind)/254.0;          \n"
+    "    vec2 size = 1.0/vec2(length(vec2(dFdx(uv.x), dFdy(uv.x))), length(vec2(dFdx(uv.y), dFdy(uv.y)))); \n"     // Shape half-size (pixels), only scales anti-aliasing ramp and corners radius
+    "    vec2 p = uv*size;                                 \n"     // Fragment position from shape center (pixels)
+    "    float d = 0.0;                                    \n"
+    "    if (kind < 0.5)                                   \n"     // Rounded box, param: roundness
+    "    {                                                 \n"
+    "        float r = param*min(size.x, size.y);          \n"
+    "        vec2 q = abs(p) - size + r;                   \n"
+    "        d = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - r; \n"
+    "    }                                                 \n"
+    "    else                                              \n"     // Ring, param: inner radius/outer radius
+    "    {                                                 \n"
+    "        float l = length(p);                          \n"
+    "        d = max(l - size.x, param*size.x - l);        \n"
+    "    }                                                 \n"
+    "    float alpha = clamp(0.5 - d, 0.0, 1.0);           \n"
+    "    gl_FragColor = vec4(fragColor.rgb, fragColor.a*alpha)*colDiffuse; \n"
+    "}                                  \n";
+#endif
+
+    RLGL.State.sdfShapesShaderId = rlLoadShaderProgramCache(RLGL.State.defaultVShaderCode, sdfShapesFShaderCode);
+
+    if (RLGL.State.sdfShapesShaderId == 0)
+    {
+        rlCompileShaderDefault();
+        unsigned int fShaderId = rlCompileShader(sdfShapesFShaderCode, GL_FRAGMENT_SHADER);
+
+        if (fShaderId > 0)
+        {
+            RLGL.State.sdfShapesShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, fShaderId);
+            rlSaveShaderProgramCache(RLGL.State.sdfShapesShaderId, RLGL.State.defaultVShaderCode, sdfShapesFShaderCode);
+
+            // NOTE: Fragment shader is not required once linked, default vertex shader is kept for default shader
+            if (RLGL.State.sdfShapesShaderId > 0)
+            {
+                glDetachShader(RLGL.State.sdfShapesShaderId, RLGL.State.defaultVShaderId);
+                glDetachShader(RLGL.State.sdfShapesShaderId, fShaderId);
+            }
+            glDeleteShader(fShaderId);
+        }
+    }
+
+    if (RLGL.State.sdfShapesShaderId > 0)
+    {
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] SDF shapes shader loaded successfully", RLGL.State.sdfShapesShaderId);
+
+        // Set SDF shapes shader locations, same attributes and uniforms as default shader
+        RLGL.State.sdfShapesShaderLocs[RL_SHADER_LOC_VERTEX_POSITION] = glGetAttribLocation(RLGL.State.sdfShapesShaderId, "vertexPosition");
+        RLGL.State.sdfShapesShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(RLGL.State.sdfShapesShaderId, "vertexTexCoord");
+        RLGL.State.sdfShapesShaderLocs[RL_SHADER_LOC_VERTEX_COLOR] = glGetAttribLocation(RLGL.State.sdfShapesShaderId, "vertexColor");
+        RLGL.State.sdfShapesShaderLocs[RL_SHADER_LOC_MATRIX_MVP]  = glGetUniformLocation(RLGL.State.sdfShapesShaderId, "mvp");
+        RLGL.State.sdfShapesShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.sdfShapesShaderId, "colDiffuse");
+        RLGL.State.sdfShapesShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.sdfShapesShaderId, "texture0");
+
+        // SDF shapes texture, never sampled, batch draws using it are SDF shapes draws
+        unsigned char pixels[4] = { 255, 255, 255, 255 };
+        RLGL.State.sdfShapesTextureId = rlLoadTexture(pixels, 1, 1, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+    }
+    else TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load SDF shapes shader");
+}
+
+// Unload SDF shapes shader
+// NOTE: Unloads: RLGL.State.sdfShapesShaderId, RLGL.State.sdfShapesShaderLocs, RLGL.State.sdfShapesTextureId
+static void rlUnloadShaderSdfShapes(void)
+{
+    if (RLGL.State.sdfShapesTextureId > 0) glDeleteTextures(1, &RLGL.State.sdfShapesTextureId);
+
+    if (RLGL.State.sdfShapesShaderId > 0)
+    {
+        glUseProgram(0);
+        glDeleteProgram(RLGL.State.sdfShapesShaderId);
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] SDF shapes shader unloaded successfully", RLGL.State.sdfShapesShaderId);
+    }
+
+    RL_FREE(RLGL.State.sdfShapesShaderLocs);
+    RLGL.State.sdfShapesShaderId = 0;
+    RLGL.State.sdfShapesShaderLocs = NULL;
+    RLGL.State.sdfShapesTextureId = 0;
+}
+
+// Load skinning shader (default shader with vertex position transformed by up to 4 weighted bone matrices)
+// NOTE: Default fragment shader is reused, only a vertex shader is compiled
+// NOTE: Loaded: RLGL.State.skinningShaderId, RLGL.State.skinningShaderLocs
+static void rlLoadShaderSkinning(void)
+{
+    RLGL.State.skinningShaderLocs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+
+    // NOTE: All locations must be reseted to -1 (no location)
+    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.State.skinningShaderLocs[i] = -1;
+
+    // Bone matrices array is sized to fit in vertex uniforms, required minimum is 128 vectors (GL 2.1, ES2) or 256 (GL 3.3),
+    // meshes with more bones are skinned on CPU
+    int uniformVectors = 0;
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    glGetIntegerv(GL_MAX_VERTEX_UNIFORM_VECTORS, &uniformVectors);
+#else
+    glGetIntegerv(GL_MAX_VERTEX_UNIFORM_COMPONENTS, &uniformVectors);
+    uniformVectors /= 4;
+#endif
+    RLGL.State.skinningShaderBones = (uniformVectors - RL_SHADER_RESERVED_UNIFORMS)/4;
+    if (RLGL.State.skinningShaderBones > RL_MAX_SHADER_BONES) RLGL.State.skinningShaderBones = RL_MAX_SHADER_BONES;
+    if (RLGL.State.skinningShaderBones < 1) RLGL.State.skinningShaderBones = 1;
+
+    // Vertex shader directly defined, no external file required
+    // NOTE: Bone ids are provided as float values, supported by all GLSL versions
+    const char *skinningVShaderHeader =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute vec4 vertexBoneIds;      \n"
+    "attribute vec4 vertexBoneWeights;  \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "in vec4 vertexBoneIds;             \n"
+    "in vec4 vertexBoneWeights;         \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL) (on some browsers)
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute vec4 vertexBoneIds;      \n"
+    "attribute vec4 vertexBoneWeights;  \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 mvp;                  \n";
+
+    const char *skinningVShaderMain =
+    "void main()                        \n"
+    "{                                  \n"
+    "    mat4 skinMatrix = vertexBoneWeights.x*boneMatrices[int(vertexBoneIds.x)] + \n"
+    "        vertexBoneWeights.y*boneMatrices[int(vertexBoneIds.y)] + \n"
+    "        vertexBoneWeights.z*boneMatrices[int(vertexBoneIds.z)] + \n"
+    "        vertexBoneWeights.w*boneMatrices[int(vertexBoneIds.w)];  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    gl_Position = mvp*skinMatrix*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    // NOTE: Bone matrices array size is written without sprintf(), stdio is not required by rlgl
+    char bonesCount[8] = { 0 };
+    int digits = 0;
+    for (int bones = RLGL.State.skinningShaderBones; (bones > 0) && (digits < 7); bones /= 10) digits++;
+    for (int i = digits - 1, bones = RLGL.State.skinningShaderBones; i >= 0; i--, bones /= 10) bonesCount[i] = '0' + bones%10;
+
+    char skinningVShaderCode[2048] = { 0 };
+    strcpy(skinningVShaderCode, skinningVShaderHeader);
+    strcat(skinningVShaderCode, "uniform mat4 boneMatrices[");
+    strcat(skinningVShaderCode, bonesCount);
+    strcat(skinningVShaderCode, "]; \n");
+    strcat(skinningVShaderCode, skinningVShaderMain);
+
+    RLGL.State.skinningShaderId = rlLoadShaderProgramCache(skinningVShaderCode, RLGL.State.defaultFShaderCode);
+
+    if (RLGL.State.skinningShaderId == 0)
+    {
+        rlCompileShaderDefault();
+        unsigned int vShaderId = rlCompileShader(skinningVShaderCode, GL_VERTEX_SHADER);
+
+        RLGL.State.skinningShaderId = rlLoadShaderProgram(vShaderId, RLGL.State.defaultFShaderId);
+        rlSaveShaderProgramCache(RLGL.State.skinningShaderId, skinningVShaderCode, RLGL.State.defaultFShaderCode);
+
+        // NOTE: Vertex shader is not required once linked, default fragment shader is kept for default shader
+        if (RLGL.State.skinningShaderId > 0)
+        {
+            glDetachShader(RLGL.State.skinningShaderId, vShaderId);
+            glDetachShader(RLGL.State.skinningShaderId, RLGL.State.defaultFShaderId);
+        }
+        glDeleteShader(vShaderId);
+    }
+
+    if (RLGL.State.skinningShaderId > 0)
+    {
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Skinning shader loaded successfully (%i bones)", RLGL.State.skinningShaderId, RLGL.State.skinningShaderBones);
+
+        // Set skinning shader locations, default shader locations and bones data
+        RLGL.State.skinningShaderLocs[RL_SHADER_LOC_VERTEX_POSITION] = glGetAttribLocation(RLGL.State.skinningShaderId, "vertexPosition");
+        RLGL.State.skinningShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(RLGL.State.skinningShaderId, "vertexTexCoord");
+        RLGL.State.skinningShaderLocs[RL_SHADER_LOC_VERTEX_COLOR] = glGetAttribLocation(RLGL.State.skinningShaderId, "vertexColor");
+        RLGL.State.skinningShaderLocs[RL_SHADER_LOC_VERTEX_BONEIDS] = glGetAttribLocation(RLGL.State.skinningShaderId, "vertexBoneIds");
+        RLGL.State.skinningShaderLocs[RL_SHADER_LOC_VERTEX_BONEWEIGHTS] = glGetAttribLocation(RLGL.State.skinningShaderId, "vertexBoneWeights");
+        RLGL.State.skinningShaderLocs[RL_SHADER_LOC_MATRIX_MVP]  = glGetUniformLocation(RLGL.State.skinningShaderId, "mvp");
+        RLGL.State.skinningShaderLocs[RL_SHADER_LOC_BONE_MATRICES]  = glGetUniformLocation(RLGL.State.skinningShaderId, "boneMatrices");
+        RLGL.State.skinningShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.skinningShaderId, "colDiffuse");
+        RLGL.State.skinningShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.skinningShaderId, "texture0");
+    }
+    else TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load skinning shader");
+}
+
+// Load instancing shader (default shader with vertex position transformed by instance transform attribute)
+// NOTE: Default fragment shader is reused, only a vertex shader is compiled
+// NOTE: Loaded: RLGL.State.instancingShaderId, RLGL.State.instancingShaderLocs
+static void rlLoadShaderInstancing(void)
+{
+    RLGL.State.instancingShaderLocs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+
+    // NOTE: All locations must be reseted to -1 (no location)
+    for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) RLGL.State.instancingShaderLocs[i] = -1;
+
+    // Vertex shader directly defined, no external file required
+    const char *instancingVShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute mat4 instanceTransform;  \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330                       \n"
+    "in vec3 vertexPosition;            \n"
+    "in vec2 vertexTexCoord;            \n"
+    "in vec4 vertexColor;               \n"
+    "in mat4 instanceTransform;         \n"
+    "out vec2 fragTexCoord;             \n"
+    "out vec4 fragColor;                \n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL) (on some browsers)
+    "attribute vec3 vertexPosition;     \n"
+    "attribute vec2 vertexTexCoord;     \n"
+    "attribute vec4 vertexColor;        \n"
+    "attribute mat4 instanceTransform;  \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+#endif
+    "uniform mat4 mvp;                  \n"
+    "void main()                        \n"
+    "{                                  \n"
+    "    fragTexCoord = vertexTexCoord; \n"
+    "    fragColor = vertexColor;       \n"
+    "    gl_Position = mvp*instanceTransform*vec4(vertexPosition, 1.0); \n"
+    "}                                  \n";
+
+    RLGL.State.instancingShaderId = rlLoadShaderProgramCache(instancingVShaderCode, RLGL.State.defaultFShaderCode);
+
+    if (RLGL.State.instancingShaderId == 0)
+    {
+        rlCompileShaderDefault();
+        unsigned int vShaderId = rlCompileShader(instancingVShaderCode, GL_VERTEX_SHADER);
+
+        RLGL.State.instancingShaderId = rlLoadShaderProgram(vShaderId, RLGL.State.defaultFShaderId);
+        rlSaveShaderProgramCache(RLGL.State.instancingShaderId, instancingVShaderCode, RLGL.State.defaultFShaderCode);
+
+        // NOTE: Vertex shader is not required once linked, default fragment shader is kept for default shader
+        if (RLGL.State.instancingShaderId > 0)
+        {
+            glDetachShader(RLGL.State.instancingShaderId, vShaderId);
+            glDetachShader(RLGL.State.instancingShaderId, RLGL.State.defaultFShaderId);
+        }
+        glDeleteShader(vShaderId);
+    }
+
+    // Instance transform must use its default location, not used by meshes vertex arrays (VAO)
+    if ((RLGL.State.instancingShaderId > 0) && (glGetAttribLocation(RLGL.State.instancingShaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TX) != 8))
+    {
+        TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Instance transform attribute location not available", RLGL.State.instancingShaderId);
+        glDeleteProgram(RLGL.State.instancingShaderId);
+        RLGL.State.instancingShaderId = 0;
+    }
+
+    if (RLGL.State.instancingShaderId > 0)
+    {
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Instancing shader loaded successfully", RLGL.State.instancingShaderId);
+
+        // Set instancing shader locations, default shader locations and instance transform attribute
+        // NOTE: Instance transform attribute location is provided as model matrix location, as expected by DrawMeshInstanced()
+        RLGL.State.instancingShaderLocs[RL_SHADER_LOC_VERTEX_POSITION] = glGetAttribLocation(RLGL.State.instancingShaderId, "vertexPosition");
+        RLGL.State.instancingShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(RLGL.State.instancingShaderId, "vertexTexCoord");
+        RLGL.State.instancingShaderLocs[RL_SHADER_LOC_VERTEX_COLOR] = glGetAttribLocation(RLGL.State.instancingShaderId, "vertexColor");
+        RLGL.State.instancingShaderLocs[RL_SHADER_LOC_MATRIX_MODEL] = glGetAttribLocation(RLGL.State.instancingShaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TX);
+        RLGL.State.instancingShaderLocs[RL_SHADER_LOC_MATRIX_MVP]  = glGetUniformLocation(RLGL.State.instancingShaderId, "mvp");
+        RLGL.State.instancingShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.instancingShaderId, "colDiffuse");
+        RLGL.State.instancingShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.instancingShaderId, "texture0");
+    }
+    else TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load instancing shader");
+}
+
+// Unload instancing shader
+// NOTE: Unloads: RLGL.State.instancingShaderId, RLGL.State.instancingShaderLocs
+static void rlUnloadShaderInstancing(void)
+{
+    if (RLGL.State.instancingShaderId > 0)
+    {
+        glUseProgram(0);
+        glDeleteProgram(RLGL.State.instancingShaderId);
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Instancing shader unloaded successfully", RLGL.State.instancingShaderId);
+    }
+
+    RL_FREE(RLGL.State.instancingShaderLocs);
+    RLGL.State.instancingShaderId = 0;
+    RLGL.State.instancingShaderLocs = NULL;
+}
+
+// Unload skinning shader
+// NOTE: Unloads: RLGL.State.skinningShaderId, RLGL.State.skinningShaderLocs
+static void rlUnloadShaderSkinning(void)
+{
+    if (RLGL.State.skinningShaderId > 0)
+    {
+        glUseProgram(0);
+        glDeleteProgram(RLGL.State.skinningShaderId);
+
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Skinning shader unloaded successfully", RLGL.State.skinningShaderId);
+    }
+
+    RL_FREE(RLGL.State.skinningShaderLocs);
+    RLGL.State.skinningShaderId = 0;
+    RLGL.State.skinningShaderLocs = NULL;
+    RLGL.State.skinningShaderBones = 0;
+}
+
+#if defined(RLGL_SHOW_GL_DETAILS_INFO)
+// Get compressed format official GL identifier name
+static const char *rlGetCompressedFormatName(int format)
+{
+    switch (format)
+    {
+        // GL_EXT_texture_compression_s3tc
+        case 0x83F0: return "GL_COMPRESSED_RGB_S3TC_DXT1_EXT"; break;
+        case 0x83F1: return "GL_COMPRESSED_RGBA_S3TC_DXT1_EXT"; break;
+        case 0x83F2: return "GL_COMPRESSED_RGBA_S3TC_DXT3_EXT"; break;
+        case 0x83F3: return "GL_COMPRESSED_RGBA_S3TC_DXT5_EXT"; break;
+        // GL_3DFX_texture_compression_FXT1
+        case 0x86B0: return "GL_COMPRESSED_RGB_FXT1_3DFX"; break;
+        case 0x86B1: return "GL_COMPRESSED_RGBA_FXT1_3DFX"; break;
+        // GL_IMG_texture_compression_pvrtc
+        case 0x8C00: return "GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG"; break;
+        case 0x8C01: return "GL_COMPRESSED_RGB_PVRTC_2BPPV1_IMG"; break;
+        case 0x8C02: return "GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG"; break;
+        case 0x8C03: return "GL_COMPRESSED_RGBA_PVRTC_2BPPV1_IMG"; break;
         // GL_OES_compressed_ETC1_RGB8_texture
         case 0x8D64: return "GL_ETC1_RGB8_OES"; break;
         // GL_ARB_texture_compression_rgtc
@@ -4766,6 +6376,440 @@ static const char *rlGetCompressedFormatName(int format)
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+#if defined(RLGL_RENDER_BATCH_INTERLEAVED) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+// Set render batch interleaved vertex attributes (buffer bound)
+// NOTE: All attributes are read from the same buffer with a stride of one rlBatchVertex
+static void rlSetBatchVertexAttributes(void)
+{
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, position));
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, texcoord));
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, color));
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+}
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Sort render batch draws, merging non-overlapping draws by mode and texture
+// NOTE: Every draw is appended to the last previous group with same mode and texture, as long as its XY bounds
+// do not overlap any group drawn in between, so overlapping geometry keeps its drawing order.
+// If keepLastDraw is set, an empty draw is kept at the end (draw being started), returns true if draws were merged
+static bool rlSortRenderBatchDraws(rlRenderBatch *batch, bool keepLastDraw)
+{
+    int drawCount = batch->drawCounter;
+    int vertexCount = RLGL.State.vertexCounter;
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+
+    if ((drawCount < 2) || (vertexCount == 0)) return false;
+
+    float bounds[RL_DEFAULT_BATCH_DRAWCALLS][4] = { 0 };    // Groups XY bounds: min x, min y, max x, max y
+    int groupFirst[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };     // Groups first draw
+    int groupLast[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };      // Groups last draw
+    int groupVertexCount[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    int drawNext[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };       // Next draw on same group (-1 for last)
+    int drawOffset[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };     // Draws vertex offset on current vertex data
+    int groupCount = 0;
+    int usedDrawCount = 0;
+
+    for (int i = 0, offset = 0; i < drawCount; offset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment), i++)
+    {
+        drawOffset[i] = offset;
+        drawNext[i] = -1;
+
+        if (batch->draws[i].vertexCount == 0) continue;
+        usedDrawCount++;
+
+        // Get draw vertex XY bounds
+        float drawBounds[4] = { 0 };
+        for (int v = offset; v < (offset + batch->draws[i].vertexCount); v++)
+        {
+#if defined(RLGL_RENDER_BATCH_INTERLEAVED)
+            float x = buffer->vertexData[v].position[0];
+            float y = buffer->vertexData[v].position[1];
+#else
+            float x = buffer->vertices[v*3];
+            float y = buffer->vertices[v*3 + 1];
+#endif
+            if ((v == offset) || (x < drawBounds[0])) drawBounds[0] = x;
+            if ((v == offset) || (y < drawBounds[1])) drawBounds[1] = y;
+            if ((v == offset) || (x > drawBounds[2])) drawBounds[2] = x;
+            if ((v == offset) || (y > drawBounds[3])) drawBounds[3] = y;
+        }
+
+        // Look for a previous group to merge with, draw can not be moved before an overlapping group
+        int group = -1;
+        for (int g = groupCount - 1; g >= 0; g--)
+        {
+            if ((batch->draws[groupFirst[g]].mode == batch->draws[i].mode) &&
+                (batch->draws[groupFirst[g]].textureId == batch->draws[i].textureId)) { group = g; break; }
+
+            if ((drawBounds[0] <= bounds[g][2]) && (drawBounds[2] >= bounds[g][0]) &&
+                (drawBounds[1] <= bounds[g][3]) && (drawBounds[3] >= bounds[g][1])) break;
+        }
+
+        if (group == -1)
+        {
+            group = groupCount;
+            groupCount++;
+
+            groupFirst[group] = i;
+            groupVertexCount[group] = 0;
+            for (int k = 0; k < 4; k++) bounds[group][k] = drawBounds[k];
+        }
+        else
+        {
+            drawNext[groupLast[group]] = i;
+
+            if (drawBounds[0] < bounds[group][0]) bounds[group][0] = drawBounds[0];
+            if (drawBounds[1] < bounds[group][1]) bounds[group][1] = drawBounds[1];
+            if (drawBounds[2] > bounds[group][2]) bounds[group][2] = drawBounds[2];
+            if (drawBounds[3] > bounds[group][3]) bounds[group][3] = drawBounds[3];
+        }
+
+        groupLast[group] = i;
+        groupVertexCount[group] += batch->draws[i].vertexCount;
+    }
+
+    // Nothing to merge or not enough draws saved to continue the batch
+    if ((groupCount == usedDrawCount) || (groupCount == 0)) return false;
+    if (keepLastDraw && ((groupCount + 1) >= RL_DEFAULT_BATCH_DRAWCALLS)) return false;
+
+    // Every group starts aligned to 4 vertex (required by QUADS indexed drawing)
+    int sortedVertexCount = 0;
+    for (int g = 0; g < groupCount; g++) sortedVertexCount += (groupVertexCount[g] + 3)/4*4;
+    if (sortedVertexCount > buffer->elementCount*4) return false;
+
+    // Copy current vertex data to be reordered by groups
+    int vertexSize = 3*sizeof(float) + 2*sizeof(float) + 4*sizeof(unsigned char);
+    if ((vertexCount*vertexSize) > RLGL.State.sortBufferSize)
+    {
+        RL_FREE(RLGL.State.sortBuffer);
+        RLGL.State.sortBufferSize = buffer->elementCount*4*vertexSize;
+        RLGL.State.sortBuffer = (unsigned char *)RL_MALLOC(RLGL.State.sortBufferSize);
+    }
+
+#if defined(RLGL_RENDER_BATCH_INTERLEAVED)
+    rlBatchVertex *vertexData = (rlBatchVertex *)RLGL.State.sortBuffer;
+    memcpy(vertexData, buffer->vertexData, vertexCount*sizeof(rlBatchVertex));
+#else
+    float *vertices = (float *)RLGL.State.sortBuffer;
+    float *texcoords = vertices + 3*vertexCount;
+    unsigned char *colors = (unsigned char *)(texcoords + 2*vertexCount);
+    memcpy(vertices, buffer->vertices, vertexCount*3*sizeof(float));
+    memcpy(texcoords, buffer->texcoords, vertexCount*2*sizeof(float));
+    memcpy(colors, buffer->colors, vertexCount*4*sizeof(unsigned char));
+#endif
+
+    rlDrawCall draws[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+
+    for (int g = 0, offset = 0; g < groupCount; g++)
+    {
+        draws[g].mode = batch->draws[groupFirst[g]].mode;
+        draws[g].textureId = batch->draws[groupFirst[g]].textureId;
+        draws[g].vertexCount = groupVertexCount[g];
+        draws[g].vertexAlignment = (4 - groupVertexCount[g]%4)%4;
+
+        for (int i = groupFirst[g]; i != -1; i = drawNext[i])
+        {
+            int count = batch->draws[i].vertexCount;
+#if defined(RLGL_RENDER_BATCH_INTERLEAVED)
+            memcpy(buffer->vertexData + offset, vertexData + drawOffset[i], count*sizeof(rlBatchVertex));
+#else
+            memcpy(buffer->vertices + 3*offset, vertices + 3*drawOffset[i], count*3*sizeof(float));
+            memcpy(buffer->texcoords + 2*offset, texcoords + 2*drawOffset[i], count*2*sizeof(float));
+            memcpy(buffer->colors + 4*offset, colors + 4*drawOffset[i], count*4*sizeof(unsigned char));
+#endif
+            offset += count;
+        }
+
+        offset += draws[g].vertexAlignment;
+    }
+
+    for (int i = 0; i < drawCount; i++)
+    {
+        if (i < groupCount) batch->draws[i] = draws[i];
+        else
+        {
+            batch->draws[i].mode = RL_QUADS;
+            batch->draws[i].vertexCount = 0;
+            batch->draws[i].vertexAlignment = 0;
+            batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        }
+    }
+
+    batch->drawCounter = keepLastDraw? (groupCount + 1) : groupCount;
+    RLGL.State.vertexCounter = sortedVertexCount;
+
+    return true;
+}
+
+// Reset render batch draws and change to next buffer (in case of multi-buffering)
+static void rlResetRenderBatch(rlRenderBatch *batch)
+{
+    // Reset vertex counter for next frame
+    RLGL.State.vertexCounter = 0;
+
+    // Reset depth for next draw
+    batch->currentDepth = -1.0f;
+
+    // Reset RLGL.currentBatch->draws array
+    for (int i = 0; i < RL_DEFAULT_BATCH_DRAWCALLS; i++)
+    {
+        batch->draws[i].mode = RL_QUADS;
+        batch->draws[i].vertexCount = 0;
+        batch->draws[i].textureId = RLGL.State.defaultTextureId;
+    }
+
+    // Reset active texture units for next batch
+    for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) RLGL.State.activeTextureId[i] = 0;
+
+    // Reset draws counter to one draw for the batch
+    batch->drawCounter = 1;
+
+    // Change to next buffer in the list (in case of multi-buffering)
+    batch->currentBuffer++;
+    if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
+}
+
+// Get shader to be used by a batch draw, current shader by default
+// NOTE: Draws using SDF shapes texture are drawn with SDF shapes shader if default shader is enabled,
+// shape quads are not drawn by the default shader, and any other geometry is not drawn by SDF shapes shader
+static unsigned int rlGetBatchDrawShader(unsigned int textureId, int **locs)
+{
+    unsigned int shaderId = RLGL.State.currentShaderId;
+    *locs = RLGL.State.currentShaderLocs;
+
+    if ((RLGL.State.sdfShapesTextureId > 0) && (textureId == RLGL.State.sdfShapesTextureId) && (shaderId == RLGL.State.defaultShaderId))
+    {
+        shaderId = RLGL.State.sdfShapesShaderId;
+        *locs = RLGL.State.sdfShapesShaderLocs;
+    }
+
+    return shaderId;
+}
+
+// Record render batch draws into the display list being recorded
+// NOTE: QUADS are recorded as indexed TRIANGLES, vertex alignment is not recorded and
+// consecutive draws with same mode, texture and shader are merged into one draw
+static void rlRecordRenderBatch(rlRenderBatch *batch)
+{
+    const rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+    static const int quadIndices[6] = { 0, 1, 2, 0, 2, 3 };    // Same order as render batch index buffer
+
+    for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+    {
+        int mode = (batch->draws[i].mode == RL_LINES)? RL_LINES : RL_TRIANGLES;
+        int vertexCount = batch->draws[i].vertexCount;
+        int indexCount = (batch->draws[i].mode == RL_QUADS)? vertexCount/4*6 : vertexCount;
+
+        if (indexCount > 0)
+        {
+            if ((RLGL.State.displayListVertexCount + vertexCount) > RLGL.State.displayListVertexCapacity)
+            {
+                int capacity = (RLGL.State.displayListVertexCapacity > 0)? 2*RLGL.State.displayListVertexCapacity : 1024;
+                while (capacity < (RLGL.State.displayListVertexCount + vertexCount)) capacity *= 2;
+
+                RLGL.State.displayListVertices = (rlBatchVertex *)RL_REALLOC(RLGL.State.displayListVertices, capacity*sizeof(rlBatchVertex));
+                RLGL.State.displayListVertexCapacity = capacity;
+            }
+
+            if ((RLGL.State.displayListIndexCount + indexCount) > RLGL.State.displayListIndexCapacity)
+            {
+                int capacity = (RLGL.State.displayListIndexCapacity > 0)? 2*RLGL.State.displayListIndexCapacity : 1536;
+                while (capacity < (RLGL.State.displayListIndexCount + indexCount)) capacity *= 2;
+
+                RLGL.State.displayListIndices = (unsigned int *)RL_REALLOC(RLGL.State.displayListIndices, capacity*sizeof(unsigned int));
+                RLGL.State.displayListIndexCapacity = capacity;
+            }
+
+            int *shaderLocs = NULL;
+            unsigned int shaderId = rlGetBatchDrawShader(batch->draws[i].textureId, &shaderLocs);
+            rlDisplayListDraw *draw = (RLGL.State.displayListDrawCount > 0)? &RLGL.State.displayListDraws[RLGL.State.displayListDrawCount - 1] : NULL;
+
+            if ((draw != NULL) && (draw->mode == mode) && (draw->textureId == batch->draws[i].textureId) && (draw->shaderId == shaderId)) draw->vertexCount += indexCount;
+            else
+            {
+                if (RLGL.State.displayListDrawCount >= RLGL.State.displayListDrawCapacity)
+                {
+                    RLGL.State.displayListDrawCapacity = (RLGL.State.displayListDrawCapacity > 0)? 2*RLGL.State.displayListDrawCapacity : 16;
+                    RLGL.State.displayListDraws = (rlDisplayListDraw *)RL_REALLOC(RLGL.State.displayListDraws, RLGL.State.displayListDrawCapacity*sizeof(rlDisplayListDraw));
+                }
+
+                draw = &RLGL.State.displayListDraws[RLGL.State.displayListDrawCount];
+                draw->mode = mode;
+                draw->vertexCount = indexCount;
+                draw->textureId = batch->draws[i].textureId;
+                draw->shaderId = shaderId;
+                draw->shaderLocs = shaderLocs;
+                RLGL.State.displayListDrawCount++;
+            }
+
+            // Copy draw vertex data
+            rlBatchVertex *vertex = RLGL.State.displayListVertices + RLGL.State.displayListVertexCount;
+#if defined(RLGL_RENDER_BATCH_INTERLEAVED)
+            memcpy(vertex, buffer->vertexData + vertexOffset, vertexCount*sizeof(rlBatchVertex));
+#else
+            for (int v = vertexOffset; v < (vertexOffset + vertexCount); v++, vertex++)
+            {
+                memcpy(vertex->position, buffer->vertices + 3*v, 3*sizeof(float));
+                memcpy(vertex->texcoord, buffer->texcoords + 2*v, 2*sizeof(float));
+                memcpy(vertex->color, buffer->colors + 4*v, 4*sizeof(unsigned char));
+            }
+#endif
+            // Generate draw indices, QUADS are converted to two TRIANGLES
+            unsigned int *index = RLGL.State.displayListIndices + RLGL.State.displayListIndexCount;
+            unsigned int first = (unsigned int)RLGL.State.displayListVertexCount;
+
+            if (batch->draws[i].mode == RL_QUADS) for (int k = 0; k < indexCount; k++) index[k] = first + k/6*4 + quadIndices[k%6];
+            else for (int k = 0; k < indexCount; k++) index[k] = first + k;
+
+            RLGL.State.displayListVertexCount += vertexCount;
+            RLGL.State.displayListIndexCount += indexCount;
+        }
+
+        vertexOffset += (vertexCount + batch->draws[i].vertexAlignment);
+    }
+}
+
+// Set display list vertex attributes (buffer bound)
+// NOTE: Attributes locations are the same for all shaders (bound on shader program loading)
+static void rlSetDisplayListVertexAttributes(void)
+{
+    glVertexAttribPointer(RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, position));
+    glEnableVertexAttribArray(RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+
+    glVertexAttribPointer(RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, texcoord));
+    glEnableVertexAttribArray(RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+
+    glVertexAttribPointer(RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, color));
+    glEnableVertexAttribArray(RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+}
+
+// Compile default vertex and fragment shaders (if not compiled yet)
+// NOTE: Not required if default shader program is loaded from cache, until some shader program needs them
+static void rlCompileShaderDefault(void)
+{
+    if (RLGL.State.defaultVShaderId == 0) RLGL.State.defaultVShaderId = rlCompileShader(RLGL.State.defaultVShaderCode, GL_VERTEX_SHADER);     // Compile default vertex shader
+    if (RLGL.State.defaultFShaderId == 0) RLGL.State.defaultFShaderId = rlCompileShader(RLGL.State.defaultFShaderCode, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+}
+
+#if defined(GRAPHICS_API_OPENGL_33)
+// Get shader program cache hash and name (16 hex chars + '\0')
+// NOTE: Hash (FNV-1a 64bit) includes shaders code and driver vendor, renderer and version,
+// program binaries are not valid across drivers, so a driver update invalidates the cache
+static unsigned long long rlGetShaderCacheHash(const char *vsCode, const char *fsCode, char *name)
+{
+    const char *strings[5] = { vsCode, fsCode, (const char *)glGetString(GL_VENDOR), (const char *)glGetString(GL_RENDERER), (const char *)glGetString(GL_VERSION) };
+    unsigned long long hash = 14695981039346656037ULL;
+
+    for (int s = 0; s < 5; s++)
+    {
+        // NOTE: String terminator is also hashed to separate consecutive strings
+        const char *str = (strings[s] != NULL)? strings[s] : "";
+
+        for (int i = 0; ; i++)
+        {
+            hash ^= (unsigned char)str[i];
+            hash *= 1099511628211ULL;
+
+            if (str[i] == '\0') break;
+        }
+    }
+
+    for (int i = 0; i < 16; i++) name[i] = "0123456789abcdef"[(hash >> (60 - 4*i)) & 0xf];
+    name[16] = '\0';
+
+    return hash;
+}
+#endif
+
+// Load shader program from binary cache, 0 if not available
+// NOTE: Cache data is rejected if hash does not match or driver fails to load the program binary
+static unsigned int rlLoadShaderProgramCache(const char *vsCode, const char *fsCode)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (RLGL.ExtSupported.programBinary && (RLGL.State.loadShaderCache != NULL) && (vsCode != NULL) && (fsCode != NULL))
+    {
+        char name[17] = { 0 };
+        unsigned long long hash = rlGetShaderCacheHash(vsCode, fsCode, name);
+
+        int dataSize = 0;
+        unsigned char *data = RLGL.State.loadShaderCache(name, &dataSize);
+
+        if (data != NULL)
+        {
+            rlShaderCacheHeader header = { 0 };
+            if (dataSize >= (int)sizeof(rlShaderCacheHeader)) memcpy(&header, data, sizeof(rlShaderCacheHeader));
+
+            if ((memcmp(header.id, "rSHB", 4) == 0) && (header.version == 1) && (header.hash == hash) &&
+                (header.binarySize > 0) && (dataSize == (int)sizeof(rlShaderCacheHeader) + header.binarySize))
+            {
+                id = glCreateProgram();
+                glProgramBinary(id, header.format, data + sizeof(rlShaderCacheHeader), header.binarySize);
+
+                GLint success = 0;
+                glGetProgramiv(id, GL_LINK_STATUS, &success);
+
+                if (success == GL_FALSE)
+                {
+                    TRACELOG(RL_LOG_WARNING, "SHADER: [%s] Program binary cache not valid, shaders compilation required", name);
+                    glDeleteProgram(id);
+                    id = 0;
+                }
+                else TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully from cache [%s]", id, name);
+            }
+
+            RL_FREE(data);
+        }
+    }
+#endif
+
+    return id;
+}
+
+// Save linked shader program binary to cache
+static void rlSaveShaderProgramCache(unsigned int id, const char *vsCode, const char *fsCode)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if ((id > 0) && RLGL.ExtSupported.programBinary && (RLGL.State.saveShaderCache != NULL) && (vsCode != NULL) && (fsCode != NULL))
+    {
+        GLint binarySize = 0;
+        glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+
+        if (binarySize > 0)
+        {
+            unsigned char *data = (unsigned char *)RL_MALLOC(sizeof(rlShaderCacheHeader) + binarySize);
+
+            GLenum format = 0;
+            GLsizei length = 0;
+            glGetProgramBinary(id, binarySize, &length, &format, data + sizeof(rlShaderCacheHeader));
+
+            if (length > 0)
+            {
+                char name[17] = { 0 };
+                rlShaderCacheHeader header = { 0 };
+                memcpy(header.id, "rSHB", 4);
+                header.version = 1;
+                header.hash = rlGetShaderCacheHash(vsCode, fsCode, name);
+                header.format = format;
+                header.binarySize = length;
+                memcpy(data, &header, sizeof(rlShaderCacheHeader));
+
+                RLGL.State.saveShaderCache(name, data, sizeof(rlShaderCacheHeader) + length);
+            }
+
+            RL_FREE(data);
+        }
+    }
+#endif
+}
+#endif
+
 // Get pixel data size in bytes (image or texture)
 // NOTE: Size depends on pixel format
 static int rlGetPixelDataSize(int width, int height, int format)
@@ -4815,6 +6859,30 @@ static int rlGetPixelDataSize(int width, int height, int format)
     return dataSize;
 }
 
+#if defined(GRAPHICS_API_OPENGL_11)
+// Get quads scratch buffer, grown to count quads if required
+static rlQuadBuffer rlGetQuadsScratch(int count)
+{
+    if (count < 0) count = 0;
+
+    if (count > rlQuadsScratchCapacity)
+    {
+        rlQuadsScratch.vertices = (float *)RL_REALLOC(rlQuadsScratch.vertices, count*4*3*sizeof(float));
+        rlQuadsScratch.texcoords = (float *)RL_REALLOC(rlQuadsScratch.texcoords, count*4*2*sizeof(float));
+        rlQuadsScratch.colors = (unsigned char *)RL_REALLOC(rlQuadsScratch.colors, count*4*4*sizeof(unsigned char));
+        rlQuadsScratchCapacity = count;
+    }
+
+    rlQuadBuffer quads = rlQuadsScratch;
+    quads.vertexStride = 3*sizeof(float);
+    quads.texcoordStride = 2*sizeof(float);
+    quads.colorStride = 4*sizeof(unsigned char);
+    quads.count = count;
+
+    return quads;
+}
+#endif
+
 // Auxiliar math functions
 
 // Get identity matrix
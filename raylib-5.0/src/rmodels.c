@@ -12,12 +12,19 @@
 *       #define SUPPORT_FILEFORMAT_GLTF
 *       #define SUPPORT_FILEFORMAT_VOX
 *       #define SUPPORT_FILEFORMAT_M3D
+*       #define SUPPORT_FILEFORMAT_RMSH
 *           Selected desired fileformats to be supported for model data loading.
+*           NOTE: RMSH is raylib binary mesh format, exported by ExportModel()/ExportMesh()
 *
 *       #define SUPPORT_MESH_GENERATION
 *           Support procedural mesh generation functions, uses external par_shapes.h library
 *           NOTE: Some generated meshes DO NOT include generated texture coordinates
 *
+*       #define SUPPORT_GPU_SKINNING
+*           Support GPU skinning for animated models, UpdateModelAnimation() computes bone matrices
+*           and DrawMesh() transforms vertex on vertex shader (default skinning shader if required)
+*           NOTE: mesh.animVertices is not updated for GPU skinned meshes, use UpdateModelAnimationVertices()
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -115,12 +122,11 @@
     #endif
 #endif
 
-#if defined(_WIN32)
-    #include <direct.h>     // Required for: _chdir() [Used in LoadOBJ()]
-    #define CHDIR _chdir
+// Thread local storage, required to identify model loads parsed by worker threads
+#if defined(SUPPORT_WORKER_THREADS) && !defined(_WIN32) && !defined(PLATFORM_WEB)
+    #define MODEL_THREAD_LOCAL __thread
 #else
-    #include <unistd.h>     // Required for: chdir() (POSIX) [Used in LoadOBJ()]
-    #define CHDIR chdir
+    #define MODEL_THREAD_LOCAL
 #endif
 
 //----------------------------------------------------------------------------------
@@ -129,19 +135,221 @@
 #ifndef MAX_MATERIAL_MAPS
     #define MAX_MATERIAL_MAPS       12    // Maximum number of maps supported
 #endif
+#ifndef MAX_FILEPATH_LENGTH
+    #define MAX_FILEPATH_LENGTH   4096    // Maximum length for filepaths
+#endif
 #ifndef MAX_MESH_VERTEX_BUFFERS
-    #define MAX_MESH_VERTEX_BUFFERS  7    // Maximum vertex buffers (VBO) per mesh
+    #define MAX_MESH_VERTEX_BUFFERS  9    // Maximum vertex buffers (VBO) per mesh
+#endif
+#ifndef SKINNING_BLOCK_SIZE
+    #define SKINNING_BLOCK_SIZE     64    // Number of vertices processed together by CPU skinning: UpdateModelAnimation()
+#endif
+#ifndef SKINNING_VERTICES_PER_WORKER
+    #define SKINNING_VERTICES_PER_WORKER 8192   // Minimum number of vertices skinned by every worker: UpdateModelAnimation()
+#endif
+#ifndef MESH_BVH_LEAF_TRIANGLES
+    #define MESH_BVH_LEAF_TRIANGLES     4     // Maximum number of triangles by leaf node (if split is cheaper): GenMeshBvh()
+#endif
+#ifndef MESH_BVH_SAH_BINS
+    #define MESH_BVH_SAH_BINS          12     // Number of bins evaluated by surface area heuristic on node split: GenMeshBvh()
+#endif
+#ifndef MESH_BVH_MAX_DEPTH
+    #define MESH_BVH_MAX_DEPTH         48     // Maximum depth of mesh bounding volume hierarchy: GenMeshBvh()
+#endif
+#ifndef MESH_BOUNDS_CACHE_SETS
+    #define MESH_BOUNDS_CACHE_SETS    256     // Number of sets in mesh bounding boxes cache (4 meshes by set): BeginMeshQueue()
+#endif
+#ifndef MESH_VERTEX_CACHE_SIZE
+    #define MESH_VERTEX_CACHE_SIZE     32     // Post-transform vertex cache size simulated on triangles reordering: OptimizeMesh()
+#endif
+#ifndef MESH_STREAM_COUNT
+    #define MESH_STREAM_COUNT          10     // Number of mesh vertex data streams (CPU): OptimizeMesh()
+#endif
+#ifndef MODEL_LOD_SCREEN_SIZE
+    #define MODEL_LOD_SCREEN_SIZE   0.25f     // Model projected size (ratio of screen height) drawn at full detail, every halving selects next level of detail: DrawModelEx()
+#endif
+#ifndef MODEL_LOD_MIN_TRIANGLES
+    #define MODEL_LOD_MIN_TRIANGLES    64     // Minimum mesh triangles to generate a level of detail: GenModelLods()
+#endif
+#ifndef TERRAIN_LOD_DISTANCE
+    #define TERRAIN_LOD_DISTANCE     2.0f     // Terrain distance drawn at full detail (in chunks), every doubling selects next level of detail: DrawTerrain()
+#endif
+#ifndef RMSH_FILE_VERSION
+    #define RMSH_FILE_VERSION           1     // RMSH binary mesh file format version: LoadModel(), ExportModel()
+#endif
+#ifndef MESH_QUEUE_MIN_INSTANCES
+    #define MESH_QUEUE_MIN_INSTANCES    2     // Minimum number of equal queued meshes drawn as a single instanced draw: EndMeshQueue()
 #endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Model file format loader
+typedef Model (*ModelFileLoader)(const char *fileName);
+
+// Model asynchronous load state
+typedef enum {
+    MODEL_LOAD_QUEUED = 0,          // Waiting for a worker to parse the file
+    MODEL_LOAD_PARSING,             // Parsing file and decoding materials textures (worker thread)
+    MODEL_LOAD_UPLOADING,           // Uploading meshes and textures to GPU: UpdateModelLoads()
+    MODEL_LOAD_READY                // Model ready to be retrieved: GetLoadedModel()
+} ModelLoadState;
+
+// Model asynchronous load
+typedef struct ModelLoad {
+    char *fileName;                 // Model file name (copy)
+    ModelFileLoader loader;         // File format loader, selected on LoadModelAsync()
+    ModelLoadState state;           // Load state, shared with workers (LockWorkerData())
+    Model model;                    // Model data, GPU data uploaded by UpdateModelLoads()
+    Image *images;                  // Materials textures decoded images, waiting for GPU upload
+    int imageCount;                 // Number of decoded images
+    int uploadCount;                // Number of meshes and images already uploaded
+    bool cancelled;                 // Load cancelled while parsing, unloaded once parsed: UpdateModelLoads()
+} ModelLoad;
+
+// Mesh CPU skinning job, vertex blocks are split between workers
+typedef struct MeshSkinningJob {
+    const float *vertices;          // Bind pose vertex positions (XYZ)
+    const float *normals;           // Bind pose vertex normals (XYZ), NULL if not skinned
+    const unsigned char *boneIds;   // Vertex bone ids (4 per vertex)
+    const float *boneWeights;       // Vertex bone weights (4 per vertex)
+    const float *boneTransforms;    // Bones affine transform for positions (3x4, 12 floats per bone, row order)
+    const float *boneRotations;     // Bones rotation for normals (3x3, 9 floats per bone, row order)
+    float *animVertices;            // Output animated vertex positions
+    float *animNormals;             // Output animated vertex normals
+    int vertexCount;                // Number of vertices to skin
+} MeshSkinningJob;
+
+// Mesh bounding volume hierarchy node, nodes are stored in depth-first order
+// NOTE: Interior node left child is the next node, leaf nodes have triangleCount > 0
+typedef struct MeshBvhNode {
+    Vector3 min;                    // Node bounds minimum
+    int index;                      // Interior node: right child node index, leaf node: first triangle index
+    Vector3 max;                    // Node bounds maximum
+    int triangleCount;              // Number of triangles in leaf node (0 for interior nodes)
+} MeshBvhNode;
+
+// Mesh bounding volume hierarchy
+struct rMeshBvh {
+    MeshBvhNode *nodes;             // Hierarchy nodes, root is nodes[0]
+    int nodeCount;                  // Number of nodes
+    Vector3 *triangles;             // Triangles vertex positions (3 per triangle), in leaf order
+    int triangleCount;              // Number of triangles
+};
+
+// Mesh bounding volume hierarchy build data
+typedef struct MeshBvhBuilder {
+    rMeshBvh *bvh;                  // Hierarchy being built
+    Vector3 *vertices;              // Mesh triangles vertex positions (3 per triangle)
+    Vector3 *centroids;             // Triangles centroid
+    BoundingBox *bounds;            // Triangles bounds
+    int *order;                     // Triangles order, sorted by leaf on split
+} MeshBvhBuilder;
+
+#if defined(SUPPORT_FILEFORMAT_RMSH)
+// RMSH file header, followed by materials (map colors and values), bones (BoneInfo),
+// bind pose (Transform) and meshes (RMSHMeshHeader followed by vertex streams)
+// NOTE: Data is stored in native byte order, streams are laid out as expected by UploadMesh()
+typedef struct RMSHHeader {
+    char id[4];                     // File identifier: "rMSH"
+    int version;                    // File version
+    int meshCount;                  // Number of meshes
+    int materialCount;              // Number of materials
+    int materialMapCount;           // Number of maps by material
+    int boneCount;                  // Number of bones
+} RMSHHeader;
+
+// RMSH mesh header, followed by available streams in RMSH_STREAM_* order, every stream padded to 4 bytes
+typedef struct RMSHMeshHeader {
+    int vertexCount;                // Number of vertices
+    int triangleCount;              // Number of triangles
+    unsigned int streams;           // Available streams (RMSH_STREAM_* flags)
+    int indexDataSize;              // Indices data size (bytes), indices are delta encoded if RMSH_STREAM_INDICES_PACKED
+    int material;                   // Mesh material index
+} RMSHMeshHeader;
+
+// RMSH mesh streams
+typedef enum {
+    RMSH_STREAM_VERTICES = 1,       // Vertex positions (float x 3)
+    RMSH_STREAM_TEXCOORDS = 2,      // Vertex texcoords (float x 2)
+    RMSH_STREAM_TEXCOORDS2 = 4,     // Vertex texcoords2 (float x 2)
+    RMSH_STREAM_NORMALS = 8,        // Vertex normals (float x 3)
+    RMSH_STREAM_TANGENTS = 16,      // Vertex tangents (float x 4)
+    RMSH_STREAM_COLORS = 32,        // Vertex colors (unsigned char x 4)
+    RMSH_STREAM_BONEIDS = 64,       // Vertex bone ids (unsigned char x 4)
+    RMSH_STREAM_BONEWEIGHTS = 128,  // Vertex bone weights (float x 4)
+    RMSH_STREAM_INDICES = 256,      // Indices (unsigned short)
+    RMSH_STREAM_INDICES_PACKED = 512    // Indices, zigzag delta encoded as variable length integers
+} RMSHStream;
+#endif
+
+// Mesh simplification quadric (symmetric 4x4 matrix), sum of squared distances to planes
+typedef struct MeshQuadric {
+    double xx, xy, xz, xw;
+    double yy, yz, yw;
+    double zz, zw;
+    double ww;
+} MeshQuadric;
+
+// Mesh simplification edge collapse candidate
+typedef struct MeshCollapse {
+    float cost;                     // Collapse error (quadric error at target position)
+    unsigned int from;              // Position removed
+    unsigned int to;                // Position kept
+} MeshCollapse;
+
+// Mesh bounding box cache entry, meshes are identified by vertex data
+typedef struct MeshBoundsEntry {
+    const float *vertices;          // Mesh vertex positions (key)
+    int vertexCount;                // Mesh vertex count (key)
+    BoundingBox bounds;             // Mesh bounding box
+} MeshBoundsEntry;
+
+// Mesh queue entry, one DrawMesh() call
+typedef struct MeshQueueEntry {
+    Mesh mesh;                      // Mesh to draw
+    Material material;              // Mesh material
+    Color color;                    // Material diffuse color at queuing time (tinted by DrawModel*())
+    Matrix transform;               // Mesh transform (including rlgl internal transform)
+    bool wires;                     // Mesh drawn in wires mode (DrawModelWires*())
+} MeshQueueEntry;
+
+// Mesh queue sorting key
+// NOTE: Consecutive entries with equal keys (except index) can be drawn instanced
+typedef struct MeshQueueKey {
+    unsigned int shader;            // Material shader id
+    unsigned int texture;           // Material diffuse texture id
+    unsigned int mesh;              // Mesh vertex array id
+    const MaterialMap *maps;        // Material maps
+    unsigned int color;             // Material diffuse color at queuing time (RGBA packed)
+    bool wires;                     // Mesh drawn in wires mode
+    int index;                      // Entry index, keeps queuing order for equal keys
+} MeshQueueKey;
+
+// Mesh queue, meshes drawing is delayed until EndMeshQueue()
+typedef struct MeshQueue {
+    bool active;                    // Mesh queue active, DrawMesh() queues meshes
+    bool wires;                     // Queued meshes are drawn in wires mode
+    bool culling;                   // Frustum culling enabled (view and projection available)
+    Vector4 frustum[6];             // Frustum planes (world space) at BeginMeshQueue()
+    MeshQueueEntry *entries;        // Queued meshes
+    int count;                      // Number of queued meshes
+    int capacity;                   // Queued meshes capacity
+    int culledCount;                // Number of meshes culled on current queue
+    int instancedCount;             // Number of meshes drawn instanced on current queue
+    int drawCount;                  // Number of draw calls issued on current queue (DrawMesh()/DrawMeshInstanced())
+} MeshQueue;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// ...
+static MeshQueue meshQueue = { 0 };                                         // Mesh queue, used by BeginMeshQueue()/EndMeshQueue()
+static MeshBoundsEntry meshBoundsCache[MESH_BOUNDS_CACHE_SETS][4] = { 0 };  // Meshes bounding box cache, used by mesh queue culling
+
+static ModelLoad **modelLoads = NULL;                   // Model asynchronous loads, indexed by load id (NULL if id is free)
+static int modelLoadCount = 0;                          // Model asynchronous loads ids allocated
+static int modelLoadWorkerCount = 0;                    // Number of workers parsing queued model loads
+static MODEL_THREAD_LOCAL ModelLoad *modelLoadCurrent = NULL;   // Model load parsed by current thread (materials textures upload deferred)
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
@@ -164,9 +372,55 @@ static Model LoadVOX(const char *filename);     // Load VOX mesh data
 static Model LoadM3D(const char *filename);     // Load M3D mesh data
 static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCount);   // Load M3D animation data
 #endif
+#if defined(SUPPORT_FILEFORMAT_RMSH)
+static Model LoadRMSH(const char *fileName);    // Load RMSH mesh data
+static bool ExportRMSH(Model model, const char *fileName);  // Export RMSH mesh data
+static bool ReadRMSHData(const unsigned char **data, int *dataSize, void *dst, int size);   // Read RMSH data block (padded to 4 bytes)
+static int PackMeshIndices(const unsigned short *indices, int count, unsigned char *packed);   // Pack indices as zigzag delta variable length integers
+static bool UnpackMeshIndices(const unsigned char *packed, int packedSize, unsigned short *indices, int count);   // Unpack indices packed by PackMeshIndices()
+#endif
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
-static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
+static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount, const char *texPath);  // Process obj materials
+#endif
+static ModelFileLoader GetModelFileLoader(const char *fileName);   // Get model file format loader (NULL if not supported)
+static Model LoadModelData(const char *fileName, ModelFileLoader loader);   // Load model data from file (CPU only, no GPU upload for meshes)
+static void ParseModelLoad(ModelLoad *load);        // Parse model load file, textures are decoded but not uploaded
+static void ParseModelLoadsWork(void *data);        // Parse queued model loads until queue is empty (worker thread)
+static void UnloadModelLoadData(ModelLoad *load);   // Unload model load data, CPU and uploaded GPU data (render thread)
+static Texture2D LoadModelTexture(const char *texPath, const char *fileName);    // Load model material texture from file (upload deferred on asynchronous loads)
+static void GetModelDirectoryPath(const char *fileName, char *dirPath);         // Get model file directory path, reentrant version of GetDirectoryPath()
+static Texture2D LoadModelTextureFromImage(Image image);        // Load model material texture from image (upload deferred on asynchronous loads)
+static Matrix GetBoneMatrix(Transform bindPose, Transform framePose);  // Get bone transformation matrix from bind pose to frame pose
+static int BuildMeshBvhNode(MeshBvhBuilder *builder, int first, int count, int depth);    // Build mesh bounding volume hierarchy node, returns node index
+static float GetRayCollisionMeshBvh(Ray ray, const rMeshBvh *bvh, int *triangle);          // Get closest ray hit distance in mesh bounding volume hierarchy (-1 if no hit)
+static BoundingBox GetMeshBoundingBoxCached(Mesh mesh);     // Get mesh bounding box, computed once by mesh
+static void UnloadMeshBoundingBoxCached(Mesh mesh);         // Remove mesh bounding box from cache
+static bool IsMeshVisible(Mesh mesh, Matrix transform);     // Check if mesh bounding box is inside mesh queue frustum
+static void GetFrustumPlanes(Matrix matrix, Vector4 *planes);   // Get frustum planes from (view-)projection matrix
+static bool IsBoxInFrustum(Vector3 center, Vector3 extent, const Vector4 *planes);    // Check if box (center and half extents) is inside frustum planes
+static Mesh GenTerrainChunkMesh(const float *heights, const Vector3 *normals, int mapX, int mapZ, Vector3 scale, int startX, int startZ, int chunkSize, int step, float skirtDepth);    // Generate terrain chunk mesh for one level of detail
+static int CompareMeshQueueKeys(const void *a, const void *b);  // Compare mesh queue keys, for qsort()
+static bool IsMeshQueueEntryInstanceable(const MeshQueueEntry *entry);  // Check if queued mesh can be drawn instanced
+static void GetMeshStreams(Mesh mesh, void **streams, int *streamSizes);    // Get mesh vertex data streams and vertex size by stream
+static void SetMeshStreams(Mesh *mesh, void **streams);    // Set mesh vertex data streams
+#if defined(SUPPORT_TRACELOG_DEBUG)
+static float GetMeshACMR(const unsigned int *indices, int indexCount, int vertexCount);    // Get mesh average cache miss ratio (FIFO cache)
 #endif
+static void OptimizeMeshVertexCache(unsigned int *indices, int indexCount, int vertexCount);   // Reorder triangles for vertex cache
+static void OptimizeMeshOverdraw(unsigned int *indices, int indexCount, const Vector3 *positions, int vertexCount);   // Reorder triangles clusters for overdraw
+static void AddMeshQuadric(MeshQuadric *q, const MeshQuadric *add);     // Add quadrics
+static float GetMeshQuadricError(const MeshQuadric *q, Vector3 p);      // Get quadric error at position
+static int CompareMeshCollapses(const void *a, const void *b);  // Compare mesh collapses by cost, for qsort()
+static int CompareMeshEdges(const void *a, const void *b);      // Compare mesh edges (64bit keys), for qsort()
+static int GetModelLod(Model model, Matrix transform);      // Get model level of detail by projected bounding sphere size
+static void UpdateModelAnimationData(Model model, ModelAnimation anim, int frame, bool gpuSkinning);   // Update model animation data for a given frame
+static void SkinMeshWork(void *data, int worker, int workerCount);      // Skin mesh vertex blocks assigned to one worker
+#if defined(SUPPORT_GPU_SKINNING)
+static bool IsMeshSkinnable(Model model, int meshIndex);   // Check if model mesh can be skinned on GPU
+static void UpdateMeshBones(Mesh *mesh, Model model, ModelAnimation anim, int frame);  // Update mesh bone matrices for GPU skinning
+#endif
+
+extern void UnloadModelLoads(void);                 // Unload all asynchronous model loads, called on CloseWindow()
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -1031,48 +1285,232 @@ void DrawGrid(int slices, float spacing)
 // Load model from files (mesh and material)
 Model LoadModel(const char *fileName)
 {
-    Model model = { 0 };
+    Model model = LoadModelData(fileName, GetModelFileLoader(fileName));
 
-#if defined(SUPPORT_FILEFORMAT_OBJ)
-    if (IsFileExtension(fileName, ".obj")) model = LoadOBJ(fileName);
-#endif
-#if defined(SUPPORT_FILEFORMAT_IQM)
-    if (IsFileExtension(fileName, ".iqm")) model = LoadIQM(fileName);
-#endif
-#if defined(SUPPORT_FILEFORMAT_GLTF)
-    if (IsFileExtension(fileName, ".gltf") || IsFileExtension(fileName, ".glb")) model = LoadGLTF(fileName);
-#endif
-#if defined(SUPPORT_FILEFORMAT_VOX)
-    if (IsFileExtension(fileName, ".vox")) model = LoadVOX(fileName);
-#endif
-#if defined(SUPPORT_FILEFORMAT_M3D)
-    if (IsFileExtension(fileName, ".m3d")) model = LoadM3D(fileName);
-#endif
+    // Upload vertex data to GPU (static meshes)
+    for (int i = 0; i < model.meshCount; i++) UploadMesh(&model.meshes[i], false);
 
-    // Make sure model transform is set to identity matrix!
-    model.transform = MatrixIdentity();
+    return model;
+}
+
+// Load model asynchronously, file parsing and textures decoding is done by worker threads
+// NOTE: Returns load id (-1 on failure), GPU data is uploaded by UpdateModelLoads() on render thread
+// and model is retrieved with GetLoadedModel() once IsModelLoadReady()
+int LoadModelAsync(const char *fileName)
+{
+    ModelFileLoader loader = GetModelFileLoader(fileName);
 
-    if ((model.meshCount != 0) && (model.meshes != NULL))
+    if (loader == NULL)
     {
-        // Upload vertex data to GPU (static meshes)
-        for (int i = 0; i < model.meshCount; i++) UploadMesh(&model.meshes[i], false);
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Model file format not supported", fileName);
+        return -1;
     }
-    else TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load model mesh(es) data", fileName);
 
-    if (model.materialCount == 0)
+    ModelLoad *load = (ModelLoad *)RL_CALLOC(1, sizeof(ModelLoad));
+    load->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+    strcpy(load->fileName, fileName);
+    load->loader = loader;
+
+    LockWorkerData();
+
+    int id = 0;
+    while ((id < modelLoadCount) && (modelLoads[id] != NULL)) id++;
+
+    if (id == modelLoadCount)
     {
-        TRACELOG(LOG_WARNING, "MATERIAL: [%s] Failed to load model material data, default to white material", fileName);
+        modelLoadCount = (modelLoadCount == 0)? 8 : modelLoadCount*2;
+        modelLoads = (ModelLoad **)RL_REALLOC(modelLoads, modelLoadCount*sizeof(ModelLoad *));
+        for (int i = id; i < modelLoadCount; i++) modelLoads[i] = NULL;
+    }
 
-        model.materialCount = 1;
-        model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
-        model.materials[0] = LoadMaterialDefault();
+    modelLoads[id] = load;
+    load->state = MODEL_LOAD_QUEUED;
 
-        if (model.meshMaterial == NULL) model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+    // Start a new worker if all running workers are busy (queued loads are shared by workers)
+    bool startWorker = (modelLoadWorkerCount < GetWorkerCount());
+    if (startWorker) modelLoadWorkerCount++;
+
+    UnlockWorkerData();
+
+    if (startWorker && !QueueWorkerTask(ParseModelLoadsWork, NULL))
+    {
+        // Worker threads not available, queued loads are parsed on calling thread
+        ParseModelLoadsWork(NULL);
+    }
+
+    return id;
+}
+
+// Update model asynchronous loads, parsed models data is uploaded to GPU (meshes and textures)
+// NOTE: Uploads stop once timeBudget (in seconds) is exceeded, at least one upload is done by call,
+// returns the number of model loads not ready yet
+int UpdateModelLoads(float timeBudget)
+{
+    double startTime = GetTime();
+    bool timeout = false;
+    int pendingCount = 0;
+
+    for (int i = 0; i < modelLoadCount; i++)
+    {
+        ModelLoad *load = modelLoads[i];
+        if (load == NULL) continue;
+
+        LockWorkerData();
+        ModelLoadState state = load->state;
+        UnlockWorkerData();
+
+        // Cancelled loads are unloaded once parsed by workers
+        if (load->cancelled)
+        {
+            if (state != MODEL_LOAD_PARSING)
+            {
+                modelLoads[i] = NULL;
+                UnloadModelLoadData(load);
+            }
+
+            continue;
+        }
+
+        if (state == MODEL_LOAD_READY) continue;
+
+        if (state == MODEL_LOAD_UPLOADING)
+        {
+            int uploadTotal = load->model.meshCount + load->imageCount;
+
+            while (!timeout && (load->uploadCount < uploadTotal))
+            {
+                if (load->uploadCount < load->model.meshCount) UploadMesh(&load->model.meshes[load->uploadCount], false);
+                else
+                {
+                    int index = load->uploadCount - load->model.meshCount;
+
+                    Texture2D texture = LoadTextureFromImage(load->images[index]);
+                    UnloadImage(load->images[index]);
+
+                    // Replace placeholder textures referencing uploaded image
+                    for (int m = 0; m < load->model.materialCount; m++)
+                    {
+                        for (int k = 0; k < MAX_MATERIAL_MAPS; k++)
+                        {
+                            Texture2D *mapTexture = &load->model.materials[m].maps[k].texture;
+                            if ((mapTexture->id == 0) && (mapTexture->mipmaps == -(index + 1))) *mapTexture = texture;
+                        }
+                    }
+                }
+
+                load->uploadCount++;
+                timeout = ((GetTime() - startTime) >= timeBudget);
+            }
+
+            if (load->uploadCount == uploadTotal)
+            {
+                RL_FREE(load->images);
+                load->images = NULL;
+
+                LockWorkerData();
+                load->state = MODEL_LOAD_READY;
+                UnlockWorkerData();
+
+                TRACELOG(LOG_INFO, "MODEL: [%s] Model loaded asynchronously (%i meshes, %i textures)", load->fileName, load->model.meshCount, load->imageCount);
+                continue;
+            }
+        }
+
+        pendingCount++;
+    }
+
+    return pendingCount;
+}
+
+// Check if an asynchronous model load is ready
+bool IsModelLoadReady(int loadId)
+{
+    bool ready = false;
+
+    if ((loadId >= 0) && (loadId < modelLoadCount) && (modelLoads[loadId] != NULL))
+    {
+        LockWorkerData();
+        ready = !modelLoads[loadId]->cancelled && (modelLoads[loadId]->state == MODEL_LOAD_READY);
+        UnlockWorkerData();
     }
 
+    return ready;
+}
+
+// Get asynchronously loaded model, load id is released
+// NOTE: Model must be ready (IsModelLoadReady()), an empty model is returned otherwise
+Model GetLoadedModel(int loadId)
+{
+    Model model = { 0 };
+
+    if (!IsModelLoadReady(loadId))
+    {
+        TRACELOG(LOG_WARNING, "MODEL: Model load id %i is not ready", loadId);
+        return model;
+    }
+
+    ModelLoad *load = modelLoads[loadId];
+    model = load->model;
+
+    LockWorkerData();
+    modelLoads[loadId] = NULL;
+    UnlockWorkerData();
+
+    RL_FREE(load->fileName);
+    RL_FREE(load);
+
     return model;
 }
 
+// Unload asynchronous model load (cancelled if not ready), load id is released
+// NOTE: A load being parsed by a worker thread is unloaded by UpdateModelLoads() once parsed
+void UnloadModelLoad(int loadId)
+{
+    if ((loadId < 0) || (loadId >= modelLoadCount) || (modelLoads[loadId] == NULL) || modelLoads[loadId]->cancelled) return;
+
+    ModelLoad *load = modelLoads[loadId];
+
+    LockWorkerData();
+    bool parsing = (load->state == MODEL_LOAD_PARSING);
+    if (parsing) load->cancelled = true;
+    else modelLoads[loadId] = NULL;     // Queued loads are not picked by workers anymore
+    UnlockWorkerData();
+
+    if (!parsing) UnloadModelLoadData(load);
+}
+
+// Unload all asynchronous model loads, worker threads are joined
+// NOTE: Called on CloseWindow(), loads data must be unloaded before closing GPU context
+extern void UnloadModelLoads(void)
+{
+    for (int i = 0; i < modelLoadCount; i++) UnloadModelLoad(i);
+
+    // Wait for loads being parsed, no more queued loads available
+    CloseWorkerPool();
+
+    for (int i = 0; i < modelLoadCount; i++)
+    {
+        if (modelLoads[i] != NULL) UnloadModelLoadData(modelLoads[i]);
+    }
+
+    RL_FREE(modelLoads);
+    modelLoads = NULL;
+    modelLoadCount = 0;
+}
+
+// Export model data to file (meshes, bones and materials maps colors/values)
+// NOTE: Materials textures and shaders are not exported, they must be set after loading
+bool ExportModel(Model model, const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FILEFORMAT_RMSH)
+    if (IsFileExtension(fileName, ".rmsh")) success = ExportRMSH(model, fileName);
+#endif
+
+    return success;
+}
+
 // Load model from generated mesh
 // WARNING: A shallow copy of mesh is generated, passed by value,
 // as long as struct contains pointers to data and some values, we get a copy
@@ -1117,6 +1555,10 @@ void UnloadModel(Model model)
     // Unload meshes
     for (int i = 0; i < model.meshCount; i++) UnloadMesh(model.meshes[i]);
 
+    // Unload levels of detail meshes
+    for (int i = 0; i < model.lodCount*model.meshCount; i++) UnloadMesh(model.lodMeshes[i]);
+    RL_FREE(model.lodMeshes);
+
     // Unload materials maps
     // NOTE: As the user could be sharing shaders and textures between models,
     // we don't unload the material but just free its maps,
@@ -1135,6 +1577,51 @@ void UnloadModel(Model model)
     TRACELOG(LOG_INFO, "MODEL: Unloaded model (and meshes) from RAM and VRAM");
 }
 
+// Generate model levels of detail, every level halves meshes triangles
+// NOTE: Levels are selected by DrawModel*() depending on model projected size, skinned meshes and
+// meshes that can not be simplified further are drawn with previous level
+void GenModelLods(Model *model, int lodCount)
+{
+    for (int i = 0; i < model->lodCount*model->meshCount; i++) UnloadMesh(model->lodMeshes[i]);
+    RL_FREE(model->lodMeshes);
+
+    model->lodCount = 0;
+    model->lodMeshes = NULL;
+
+    if ((lodCount <= 0) || (model->meshCount <= 0)) return;
+
+    model->lodCount = lodCount;
+    model->lodMeshes = (Mesh *)RL_CALLOC(lodCount*model->meshCount, sizeof(Mesh));
+
+    for (int i = 0; i < model->meshCount; i++)
+    {
+        Mesh mesh = model->meshes[i];
+
+        if ((mesh.boneIds != NULL) || (mesh.vertices == NULL)) continue;
+
+        int previousCount = mesh.triangleCount;
+        for (int lod = 1; lod <= lodCount; lod++)
+        {
+            float ratio = 1.0f/(float)(1 << lod);
+            if ((mesh.triangleCount*ratio) < MODEL_LOD_MIN_TRIANGLES) break;
+
+            Mesh lodMesh = GenMeshSimplified(mesh, ratio);
+
+            // Level not generated if it does not reduce previous level triangles significantly
+            if ((lodMesh.vertexCount == 0) || (lodMesh.triangleCount > previousCount*3/4))
+            {
+                UnloadMesh(lodMesh);
+                break;
+            }
+
+            model->lodMeshes[(lod - 1)*model->meshCount + i] = lodMesh;
+            previousCount = lodMesh.triangleCount;
+        }
+    }
+
+    TRACELOG(LOG_INFO, "MODEL: Levels of detail generated (%i levels, %i meshes)", lodCount, model->meshCount);
+}
+
 // Compute model bounding box limits (considers all meshes)
 BoundingBox GetModelBoundingBox(Model model)
 {
@@ -1190,6 +1677,8 @@ void UploadMesh(Mesh *mesh, bool dynamic)
     mesh->vboId[4] = 0;     // Vertex buffer: tangents
     mesh->vboId[5] = 0;     // Vertex buffer: texcoords2
     mesh->vboId[6] = 0;     // Vertex buffer: indices
+    mesh->vboId[7] = 0;     // Vertex buffer: bone ids
+    mesh->vboId[8] = 0;     // Vertex buffer: bone weights
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     mesh->vaoId = rlLoadVertexArray();
@@ -1276,6 +1765,22 @@ void UploadMesh(Mesh *mesh, bool dynamic)
         rlDisableVertexAttribute(5);
     }
 
+#if defined(SUPPORT_GPU_SKINNING)
+    if ((mesh->boneIds != NULL) && (mesh->boneWeights != NULL))
+    {
+        // Enable vertex attribute: bone ids (shader-location = 6)
+        // NOTE: Bone ids are not normalized, shader receives them as float values
+        mesh->vboId[7] = rlLoadVertexBuffer(mesh->boneIds, mesh->vertexCount*4*sizeof(unsigned char), dynamic);
+        rlSetVertexAttribute(6, 4, RL_UNSIGNED_BYTE, 0, 0, 0);
+        rlEnableVertexAttribute(6);
+
+        // Enable vertex attribute: bone weights (shader-location = 7)
+        mesh->vboId[8] = rlLoadVertexBuffer(mesh->boneWeights, mesh->vertexCount*4*sizeof(float), dynamic);
+        rlSetVertexAttribute(7, 4, RL_FLOAT, 0, 0, 0);
+        rlEnableVertexAttribute(7);
+    }
+#endif
+
     if (mesh->indices != NULL)
     {
         mesh->vboId[6] = rlLoadVertexBufferElement(mesh->indices, mesh->triangleCount*3*sizeof(unsigned short), dynamic);
@@ -1297,6 +1802,33 @@ void UpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSize, int
 // Draw a 3d mesh with material and transform
 void DrawMesh(Mesh mesh, Material material, Matrix transform)
 {
+    if (meshQueue.active)
+    {
+        // Accumulate rlgl internal transform (push/pop), mesh is drawn later
+        transform = MatrixMultiply(transform, rlGetMatrixTransform());
+
+        if (meshQueue.culling && !IsMeshVisible(mesh, transform))
+        {
+            meshQueue.culledCount++;
+            return;
+        }
+
+        if (meshQueue.count >= meshQueue.capacity)
+        {
+            meshQueue.capacity = (meshQueue.capacity > 0)? meshQueue.capacity*2 : 256;
+            meshQueue.entries = (MeshQueueEntry *)RL_REALLOC(meshQueue.entries, meshQueue.capacity*sizeof(MeshQueueEntry));
+        }
+
+        MeshQueueEntry *entry = &meshQueue.entries[meshQueue.count++];
+        entry->mesh = mesh;
+        entry->material = material;
+        entry->color = material.maps[MATERIAL_MAP_DIFFUSE].color;
+        entry->transform = transform;
+        entry->wires = meshQueue.wires;
+
+        return;
+    }
+
 #if defined(GRAPHICS_API_OPENGL_11)
     #define GL_VERTEX_ARRAY         0x8074
     #define GL_NORMAL_ARRAY         0x8075
@@ -1330,6 +1862,16 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(SUPPORT_GPU_SKINNING)
+    // Mesh skinned on GPU with default shader, use default skinning shader instead
+    // NOTE: material is a local copy, provided material is not modified
+    if ((mesh.boneCount > 0) && (mesh.boneMatrices != NULL) && (material.shader.id == rlGetShaderIdDefault()))
+    {
+        material.shader.id = rlGetShaderIdSkinning();
+        material.shader.locs = rlGetShaderLocsSkinning();
+    }
+#endif
+
     // Bind shader program
     rlEnableShader(material.shader.id);
 
@@ -1388,6 +1930,12 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
 
     // Upload model normal matrix (if locations available)
     if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixTranspose(MatrixInvert(matModel)));
+
+    // Upload bone matrices for current animation frame (if mesh is skinned on GPU and location available)
+    if ((mesh.boneCount > 0) && (mesh.boneMatrices != NULL) && (material.shader.locs[SHADER_LOC_BONE_MATRICES] != -1))
+    {
+        rlSetUniformMatrices(material.shader.locs[SHADER_LOC_BONE_MATRICES], mesh.boneMatrices, mesh.boneCount);
+    }
     //-----------------------------------------------------
 
     // Bind active texture maps (if available)
@@ -1467,6 +2015,21 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
             rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02]);
         }
 
+        // Bind mesh VBO data: vertex bone ids and weights (shader-location = 6 and 7, if available)
+        if ((material.shader.locs[SHADER_LOC_VERTEX_BONEIDS] != -1) && (mesh.vboId[7] != 0))
+        {
+            rlEnableVertexBuffer(mesh.vboId[7]);
+            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEIDS], 4, RL_UNSIGNED_BYTE, 0, 0, 0);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEIDS]);
+        }
+
+        if ((material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS] != -1) && (mesh.vboId[8] != 0))
+        {
+            rlEnableVertexBuffer(mesh.vboId[8]);
+            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS], 4, RL_FLOAT, 0, 0, 0);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS]);
+        }
+
         if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[6]);
     }
 
@@ -1532,7 +2095,15 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // Instancing required variables
     float16 *instanceTransforms = NULL;
-    unsigned int instancesVboId = 0;
+    int instancesOffset = 0;
+
+    // Mesh drawn with default shader, use default instancing shader instead (if supported)
+    // NOTE: material is a local copy, provided material is not modified
+    if ((material.shader.id == rlGetShaderIdDefault()) && (rlGetShaderIdInstancing() > 0))
+    {
+        material.shader.id = rlGetShaderIdInstancing();
+        material.shader.locs = rlGetShaderLocsInstancing();
+    }
 
     // Bind shader program
     rlEnableShader(material.shader.id);
@@ -1588,17 +2159,15 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
     // Enable mesh VAO to attach new buffer
     rlEnableVertexArray(mesh.vaoId);
 
-    // This could alternatively use a static VBO and either glMapBuffer() or glBufferSubData().
-    // It isn't clear which would be reliably faster in all cases and on all platforms,
-    // anecdotally glMapBuffer() seems very slow (syncs) while glBufferSubData() seems
-    // no faster, since we're transferring all the transform matrices anyway
-    instancesVboId = rlLoadVertexBuffer(instanceTransforms, instances*sizeof(float16), false);
+    // Instances transforms are appended to rlgl streamed vertex buffer, reused by all instanced draws,
+    // instead of loading and unloading a new buffer on every call
+    rlUpdateVertexBufferStream(instanceTransforms, instances*sizeof(float16), &instancesOffset);
 
     // Instances transformation matrices are send to shader attribute location: SHADER_LOC_MATRIX_MODEL
     for (unsigned int i = 0; i < 4; i++)
     {
         rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 4, RL_FLOAT, 0, sizeof(Matrix), (void *)(i*sizeof(Vector4)));
+        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 4, RL_FLOAT, 0, sizeof(Matrix), (void *)(size_t)(instancesOffset + i*sizeof(Vector4)));
         rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 1);
     }
 
@@ -1611,6 +2180,12 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
 
     // Upload model normal matrix (if locations available)
     if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixTranspose(MatrixInvert(matModel)));
+
+    // Upload bone matrices for current animation frame (if mesh is skinned on GPU and location available)
+    if ((mesh.boneCount > 0) && (mesh.boneMatrices != NULL) && (material.shader.locs[SHADER_LOC_BONE_MATRICES] != -1))
+    {
+        rlSetUniformMatrices(material.shader.locs[SHADER_LOC_BONE_MATRICES], mesh.boneMatrices, mesh.boneCount);
+    }
     //-----------------------------------------------------
 
     // Bind active texture maps (if available)
@@ -1733,6 +2308,13 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
         }
     }
 
+    // Disable instances transformation attributes, mesh VAO could be used later by non-instanced draws
+    for (unsigned int i = 0; i < 4; i++)
+    {
+        rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 0);
+        rlDisableVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i);
+    }
+
     // Disable all possible vertex array objects (or VBOs)
     rlDisableVertexArray();
     rlDisableVertexBuffer();
@@ -1741,8 +2323,6 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
     // Disable shader program
     rlDisableShader();
 
-    // Remove instance transforms buffer
-    rlUnloadVertexBuffer(instancesVboId);
     RL_FREE(instanceTransforms);
 #endif
 }
@@ -1756,6 +2336,9 @@ void UnloadMesh(Mesh mesh)
     if (mesh.vboId != NULL) for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(mesh.vboId[i]);
     RL_FREE(mesh.vboId);
 
+    // NOTE: Vertex data pointer identifies cached bounding box, it must be removed before freeing data
+    UnloadMeshBoundingBoxCached(mesh);
+
     RL_FREE(mesh.vertices);
     RL_FREE(mesh.texcoords);
     RL_FREE(mesh.normals);
@@ -1768,6 +2351,14 @@ void UnloadMesh(Mesh mesh)
     RL_FREE(mesh.animNormals);
     RL_FREE(mesh.boneWeights);
     RL_FREE(mesh.boneIds);
+    RL_FREE(mesh.boneMatrices);
+
+    if (mesh.bvh != NULL)
+    {
+        RL_FREE(mesh.bvh->nodes);
+        RL_FREE(mesh.bvh->triangles);
+        RL_FREE(mesh.bvh);
+    }
 }
 
 // Export mesh data to file
@@ -1842,6 +2433,16 @@ bool ExportMesh(Mesh mesh, const char *fileName)
 
         RL_FREE(txtData);
     }
+#if defined(SUPPORT_FILEFORMAT_RMSH)
+    else if (IsFileExtension(fileName, ".rmsh"))
+    {
+        Model model = { 0 };
+        model.meshCount = 1;
+        model.meshes = &mesh;
+
+        success = ExportRMSH(model, fileName);
+    }
+#endif
     else if (IsFileExtension(fileName, ".raw"))
     {
         // TODO: Support additional file formats to export mesh vertex data
@@ -1852,7 +2453,8 @@ bool ExportMesh(Mesh mesh, const char *fileName)
 
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
 // Process obj materials
-static void ProcessMaterialsOBJ(Material *materials, tinyobj_material_t *mats, int materialCount)
+// NOTE: Textures file names are relative to texPath directory (if not NULL)
+static void ProcessMaterialsOBJ(Material *materials, tinyobj_material_t *mats, int materialCount, const char *texPath)
 {
     // Init model mats
     for (int m = 0; m < materialCount; m++)
@@ -1865,21 +2467,21 @@ static void ProcessMaterialsOBJ(Material *materials, tinyobj_material_t *mats, i
         // NOTE: rlgl default texture is a 1x1 pixel UNCOMPRESSED_R8G8B8A8
         materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = (Texture2D){ rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
 
-        if (mats[m].diffuse_texname != NULL) materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = LoadTexture(mats[m].diffuse_texname);  //char *diffuse_texname; // map_Kd
+        if (mats[m].diffuse_texname != NULL) materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = LoadModelTexture(texPath, mats[m].diffuse_texname);  //char *diffuse_texname; // map_Kd
         else materials[m].maps[MATERIAL_MAP_DIFFUSE].color = (Color){ (unsigned char)(mats[m].diffuse[0]*255.0f), (unsigned char)(mats[m].diffuse[1]*255.0f), (unsigned char)(mats[m].diffuse[2] * 255.0f), 255 }; //float diffuse[3];
         materials[m].maps[MATERIAL_MAP_DIFFUSE].value = 0.0f;
 
-        if (mats[m].specular_texname != NULL) materials[m].maps[MATERIAL_MAP_SPECULAR].texture = LoadTexture(mats[m].specular_texname);  //char *specular_texname; // map_Ks
+        if (mats[m].specular_texname != NULL) materials[m].maps[MATERIAL_MAP_SPECULAR].texture = LoadModelTexture(texPath, mats[m].specular_texname);  //char *specular_texname; // map_Ks
         materials[m].maps[MATERIAL_MAP_SPECULAR].color = (Color){ (unsigned char)(mats[m].specular[0]*255.0f), (unsigned char)(mats[m].specular[1]*255.0f), (unsigned char)(mats[m].specular[2] * 255.0f), 255 }; //float specular[3];
         materials[m].maps[MATERIAL_MAP_SPECULAR].value = 0.0f;
 
-        if (mats[m].bump_texname != NULL) materials[m].maps[MATERIAL_MAP_NORMAL].texture = LoadTexture(mats[m].bump_texname);  //char *bump_texname; // map_bump, bump
+        if (mats[m].bump_texname != NULL) materials[m].maps[MATERIAL_MAP_NORMAL].texture = LoadModelTexture(texPath, mats[m].bump_texname);  //char *bump_texname; // map_bump, bump
         materials[m].maps[MATERIAL_MAP_NORMAL].color = WHITE;
         materials[m].maps[MATERIAL_MAP_NORMAL].value = mats[m].shininess;
 
         materials[m].maps[MATERIAL_MAP_EMISSION].color = (Color){ (unsigned char)(mats[m].emission[0]*255.0f), (unsigned char)(mats[m].emission[1]*255.0f), (unsigned char)(mats[m].emission[2] * 255.0f), 255 }; //float emission[3];
 
-        if (mats[m].displacement_texname != NULL) materials[m].maps[MATERIAL_MAP_HEIGHT].texture = LoadTexture(mats[m].displacement_texname);  //char *displacement_texname; // disp
+        if (mats[m].displacement_texname != NULL) materials[m].maps[MATERIAL_MAP_HEIGHT].texture = LoadModelTexture(texPath, mats[m].displacement_texname);  //char *displacement_texname; // disp
     }
 }
 #endif
@@ -1901,7 +2503,7 @@ Material *LoadMaterials(const char *fileName, int *materialCount)
         if (result != TINYOBJ_SUCCESS) TRACELOG(LOG_WARNING, "MATERIAL: [%s] Failed to parse materials file", fileName);
 
         materials = RL_MALLOC(count*sizeof(Material));
-        ProcessMaterialsOBJ(materials, mats, count);
+        ProcessMaterialsOBJ(materials, mats, count, NULL);
 
         tinyobj_materials_free(mats, count);
     }
@@ -1994,12 +2596,32 @@ ModelAnimation *LoadModelAnimations(const char *fileName, int *animCount)
 
 // Update model animated vertex data (positions and normals) for a given frame
 // NOTE: Updated data is uploaded to GPU
+// WARNING: With SUPPORT_GPU_SKINNING, only bone matrices are computed for meshes that can be skinned on GPU,
+// vertex transformation happens on DrawMesh() and mesh.animVertices/mesh.animNormals are NOT updated,
+// use UpdateModelAnimationVertices() if animated vertex data is required on CPU (i.e. collisions, bounds)
 void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
+{
+    UpdateModelAnimationData(model, anim, frame, true);
+}
+
+// Update model animated vertex data on CPU (mesh.animVertices, mesh.animNormals) for a given frame
+// NOTE: All meshes are skinned on CPU, GPU skinned meshes data is not uploaded (GPU keeps bind pose data)
+void UpdateModelAnimationVertices(Model model, ModelAnimation anim, int frame)
+{
+    UpdateModelAnimationData(model, anim, frame, false);
+}
+
+// Update model animation data for a given frame, GPU skinned meshes only update bone matrices if gpuSkinning is enabled
+// NOTE: On CPU skinning, bones transforms are computed once per frame and vertices are skinned by worker threads
+static void UpdateModelAnimationData(Model model, ModelAnimation anim, int frame, bool gpuSkinning)
 {
     if ((anim.frameCount > 0) && (anim.bones != NULL) && (anim.framePoses != NULL))
     {
         if (frame >= anim.frameCount) frame = frame%anim.frameCount;
 
+        float *boneTransforms = NULL;   // Bones position transforms for CPU skinning (3x4 per bone)
+        float *boneRotations = NULL;    // Bones normal rotations for CPU skinning (3x3 per bone)
+
         for (int m = 0; m < model.meshCount; m++)
         {
             Mesh mesh = model.meshes[m];
@@ -2010,87 +2632,77 @@ void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
                 continue;
             }
 
-            bool updated = false;           // Flag to check when anim vertex information is updated
-            Vector3 animVertex = { 0 };
-            Vector3 animNormal = { 0 };
-
-            Vector3 inTranslation = { 0 };
-            Quaternion inRotation = { 0 };
-            // Vector3 inScale = { 0 };
+            if (mesh.animVertices == NULL) continue;
 
-            Vector3 outTranslation = { 0 };
-            Quaternion outRotation = { 0 };
-            Vector3 outScale = { 0 };
+            bool upload = true;     // Skinned vertex data uploaded to GPU for model drawing
 
-            int boneId = 0;
-            int boneCounter = 0;
-            float boneWeight = 0.0;
-
-            const int vValues = mesh.vertexCount*3;
-            for (int vCounter = 0; vCounter < vValues; vCounter += 3)
+#if defined(SUPPORT_GPU_SKINNING)
+            if (IsMeshSkinnable(model, m))
             {
-                mesh.animVertices[vCounter] = 0;
-                mesh.animVertices[vCounter + 1] = 0;
-                mesh.animVertices[vCounter + 2] = 0;
-
-                if (mesh.animNormals != NULL)
+                if (gpuSkinning)
                 {
-                    mesh.animNormals[vCounter] = 0;
-                    mesh.animNormals[vCounter + 1] = 0;
-                    mesh.animNormals[vCounter + 2] = 0;
+                    UpdateMeshBones(&model.meshes[m], model, anim, frame);
+                    continue;
                 }
 
-                // Iterates over 4 bones per vertex
-                for (int j = 0; j < 4; j++, boneCounter++)
+                // Mesh drawn with GPU skinning, only CPU vertex data is updated
+                upload = false;
+            }
+            else model.meshes[m].boneCount = 0;     // Mesh skinned on CPU, bone matrices not used on drawing
+#endif
+
+            // Bones transformations computed once per frame, shared by all meshes skinned on CPU
+            if (boneTransforms == NULL)
+            {
+                boneTransforms = (float *)RL_MALLOC(model.boneCount*(12 + 9)*sizeof(float));
+                boneRotations = boneTransforms + model.boneCount*12;
+
+                for (int i = 0; i < model.boneCount; i++)
                 {
-                    boneWeight = mesh.boneWeights[boneCounter];
-
-                    // Early stop when no transformation will be applied
-                    if (boneWeight == 0.0f) continue;
-
-                    boneId = mesh.boneIds[boneCounter];
-                    //int boneIdParent = model.bones[boneId].parent;
-                    inTranslation = model.bindPose[boneId].translation;
-                    inRotation = model.bindPose[boneId].rotation;
-                    //inScale = model.bindPose[boneId].scale;
-                    outTranslation = anim.framePoses[frame][boneId].translation;
-                    outRotation = anim.framePoses[frame][boneId].rotation;
-                    outScale = anim.framePoses[frame][boneId].scale;
-
-                    // Vertices processing
-                    // NOTE: We use meshes.vertices (default vertex position) to calculate meshes.animVertices (animated vertex position)
-                    animVertex = (Vector3){ mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
-                    animVertex = Vector3Subtract(animVertex, inTranslation);
-                    animVertex = Vector3Multiply(animVertex, outScale);
-                    animVertex = Vector3RotateByQuaternion(animVertex, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-                    animVertex = Vector3Add(animVertex, outTranslation);
-                    //animVertex = Vector3Transform(animVertex, model.transform);
-                    mesh.animVertices[vCounter] += animVertex.x*boneWeight;
-                    mesh.animVertices[vCounter + 1] += animVertex.y*boneWeight;
-                    mesh.animVertices[vCounter + 2] += animVertex.z*boneWeight;
-                    updated = true;
-
-                    // Normals processing
-                    // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
-                    if (mesh.normals != NULL)
-                    {
-                        animNormal = (Vector3){ mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
-                        animNormal = Vector3RotateByQuaternion(animNormal, QuaternionMultiply(outRotation, QuaternionInvert(inRotation)));
-                        mesh.animNormals[vCounter] += animNormal.x*boneWeight;
-                        mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
-                        mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
-                    }
+                    Matrix matBone = GetBoneMatrix(model.bindPose[i], anim.framePoses[frame][i]);
+                    Matrix matRotation = QuaternionToMatrix(QuaternionMultiply(anim.framePoses[frame][i].rotation, QuaternionInvert(model.bindPose[i].rotation)));
+
+                    float *transform = boneTransforms + i*12;
+                    transform[0] = matBone.m0; transform[1] = matBone.m4; transform[2] = matBone.m8; transform[3] = matBone.m12;
+                    transform[4] = matBone.m1; transform[5] = matBone.m5; transform[6] = matBone.m9; transform[7] = matBone.m13;
+                    transform[8] = matBone.m2; transform[9] = matBone.m6; transform[10] = matBone.m10; transform[11] = matBone.m14;
+
+                    // NOTE: Normals are only rotated, bone scale is not applied
+                    float *rotation = boneRotations + i*9;
+                    rotation[0] = matRotation.m0; rotation[1] = matRotation.m4; rotation[2] = matRotation.m8;
+                    rotation[3] = matRotation.m1; rotation[4] = matRotation.m5; rotation[5] = matRotation.m9;
+                    rotation[6] = matRotation.m2; rotation[7] = matRotation.m6; rotation[8] = matRotation.m10;
                 }
             }
 
+            MeshSkinningJob job = { 0 };
+            job.vertices = mesh.vertices;
+            job.normals = ((mesh.normals != NULL) && (mesh.animNormals != NULL))? mesh.normals : NULL;
+            job.boneIds = mesh.boneIds;
+            job.boneWeights = mesh.boneWeights;
+            job.boneTransforms = boneTransforms;
+            job.boneRotations = boneRotations;
+            job.animVertices = mesh.animVertices;
+            job.animNormals = mesh.animNormals;
+            job.vertexCount = mesh.vertexCount;
+
+            // Vertex blocks are skinned by worker pool threads
+            // NOTE: Small meshes are not worth sharing with worker pool threads
+            int workerCount = mesh.vertexCount/SKINNING_VERTICES_PER_WORKER;
+            int maxWorkerCount = GetWorkerCount();
+            if (workerCount > maxWorkerCount) workerCount = maxWorkerCount;
+
+            RunWorkers(SkinMeshWork, &job, workerCount);
+
             // Upload new vertex data to GPU for model drawing
-            // NOTE: Only update data when values changed
-            if (updated)
+            if (upload)
             {
                 rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0); // Update vertex position
-                rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);  // Update vertex normals
+                if (job.normals != NULL) rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);  // Update vertex normals
             }
         }
+
+        RL_FREE(boneTransforms);
     }
 }
 
@@ -3270,38 +3882,225 @@ Mesh GenMeshCubicmap(Image cubicmap, Vector3 cubeSize)
 
     return mesh;
 }
-#endif      // SUPPORT_MESH_GENERATION
 
-// Compute mesh bounding box limits
-// NOTE: minVertex and maxVertex should be transformed by model transform matrix
-BoundingBox GetMeshBoundingBox(Mesh mesh)
+// Load terrain from heightmap image, terrain is split in chunks with levels of detail
+// NOTE: Terrain size and heights match GenMeshHeightmap() but chunks meshes are indexed and share
+// vertex between cells, normals are smooth and chunks could be culled and drawn with less detail
+Terrain LoadTerrain(Image heightmap, Vector3 size, int chunkSize, int lodCount)
 {
-    // Get min and max vertex to construct bounds (AABB)
-    Vector3 minVertex = { 0 };
-    Vector3 maxVertex = { 0 };
+    Terrain terrain = { 0 };
 
-    if (mesh.vertices != NULL)
+    int mapX = heightmap.width;
+    int mapZ = heightmap.height;
+
+    if ((mapX < 2) || (mapZ < 2))
     {
-        minVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
-        maxVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+        TRACELOG(LOG_WARNING, "TERRAIN: Heightmap size not valid to generate terrain");
+        return terrain;
+    }
 
-        for (int i = 1; i < mesh.vertexCount; i++)
+    // Chunk size is a power of two (level of detail halves cells by side), limited to 16bit indices
+    int cells = 4;
+    while ((cells*2 <= chunkSize) && (cells < 128)) cells *= 2;
+    chunkSize = cells;
+
+    int maxLodCount = 1;
+    while ((1 << maxLodCount) <= chunkSize) maxLodCount++;
+
+    if (lodCount < 1) lodCount = 1;
+    else if (lodCount > maxLodCount) lodCount = maxLodCount;
+
+    Vector3 scale = { size.x/(mapX - 1), size.y/255.0f, size.z/(mapZ - 1) };
+
+    // Heights and smooth normals (central differences) for every heightmap pixel
+    Color *pixels = LoadImageColors(heightmap);
+
+    float *heights = (float *)RL_MALLOC(mapX*mapZ*sizeof(float));
+    for (int i = 0; i < mapX*mapZ; i++) heights[i] = ((float)(pixels[i].r + pixels[i].g + pixels[i].b)/3.0f)*scale.y;
+
+    UnloadImageColors(pixels);
+
+    Vector3 *normals = (Vector3 *)RL_MALLOC(mapX*mapZ*sizeof(Vector3));
+    for (int z = 0; z < mapZ; z++)
+    {
+        for (int x = 0; x < mapX; x++)
         {
-            minVertex = Vector3Min(minVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
-            maxVertex = Vector3Max(maxVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
+            int x0 = (x > 0)? x - 1 : x;
+            int x1 = (x < mapX - 1)? x + 1 : x;
+            int z0 = (z > 0)? z - 1 : z;
+            int z1 = (z < mapZ - 1)? z + 1 : z;
+
+            float dx = (heights[z*mapX + x1] - heights[z*mapX + x0])/((x1 - x0)*scale.x);
+            float dz = (heights[z1*mapX + x] - heights[z0*mapX + x])/((z1 - z0)*scale.z);
+
+            normals[z*mapX + x] = Vector3Normalize((Vector3){ -dx, 1.0f, -dz });
         }
     }
 
-    // Create the bounding box
-    BoundingBox box = { 0 };
-    box.min = minVertex;
-    box.max = maxVertex;
+    terrain.chunkCountX = (mapX - 1 + chunkSize - 1)/chunkSize;
+    terrain.chunkCountZ = (mapZ - 1 + chunkSize - 1)/chunkSize;
+    terrain.lodCount = lodCount;
+    terrain.chunks = (Mesh *)RL_CALLOC(terrain.chunkCountX*terrain.chunkCountZ*lodCount, sizeof(Mesh));
+    terrain.bounds = (BoundingBox *)RL_CALLOC(terrain.chunkCountX*terrain.chunkCountZ, sizeof(BoundingBox));
+    terrain.lodDistance = chunkSize*fmaxf(scale.x, scale.z)*TERRAIN_LOD_DISTANCE;
+    terrain.material = LoadMaterialDefault();
 
-    return box;
-}
+    for (int cz = 0; cz < terrain.chunkCountZ; cz++)
+    {
+        for (int cx = 0; cx < terrain.chunkCountX; cx++)
+        {
+            int chunk = cz*terrain.chunkCountX + cx;
+            int startX = cx*chunkSize;
+            int startZ = cz*chunkSize;
+
+            // Skirt depth covers maximum border height error of any level of detail, borders are shared
+            // by neighbour chunks so both chunks skirts cover the crack between their levels of detail
+            float borderError = 0.0f;
+            for (int lod = 1; lod < lodCount; lod++)
+            {
+                int step = 1 << lod;
 
-// Compute mesh tangents
-// NOTE: To calculate mesh tangents and binormals we need mesh vertex positions and texture coordinates
+                for (int side = 0; side < 4; side++)
+                {
+                    for (int k = 0; k <= chunkSize; k++)
+                    {
+                        int k0 = (k/step)*step;
+                        int k1 = (k0 + step <= chunkSize)? k0 + step : k0;
+                        float t = (k1 > k0)? (float)(k - k0)/(k1 - k0) : 0.0f;
+
+                        // Border positions (x, z) for fine and coarse samples
+                        int fixed = ((side%2) == 0)? 0 : chunkSize;
+                        int sample[3] = { k, k0, k1 };
+                        float h[3] = { 0 };
+
+                        for (int i = 0; i < 3; i++)
+                        {
+                            int x = (side < 2)? startX + sample[i] : startX + fixed;
+                            int z = (side < 2)? startZ + fixed : startZ + sample[i];
+                            if (x > mapX - 1) x = mapX - 1;
+                            if (z > mapZ - 1) z = mapZ - 1;
+                            h[i] = heights[z*mapX + x];
+                        }
+
+                        borderError = fmaxf(borderError, fabsf(h[0] - (h[1] + (h[2] - h[1])*t)));
+                    }
+                }
+            }
+
+            float skirtDepth = 2.0f*borderError + scale.y;
+
+            for (int lod = 0; lod < lodCount; lod++)
+            {
+                Mesh mesh = GenTerrainChunkMesh(heights, normals, mapX, mapZ, scale, startX, startZ, chunkSize, 1 << lod, skirtDepth);
+                UploadMesh(&mesh, false);
+
+                terrain.chunks[chunk*lodCount + lod] = mesh;
+            }
+
+            terrain.bounds[chunk] = GetMeshBoundingBox(terrain.chunks[chunk*lodCount]);
+        }
+    }
+
+    RL_FREE(normals);
+    RL_FREE(heights);
+
+    TRACELOG(LOG_INFO, "TERRAIN: Terrain generated successfully (%ix%i chunks, %i cells by chunk, %i levels of detail)", terrain.chunkCountX, terrain.chunkCountZ, chunkSize, lodCount);
+
+    return terrain;
+}
+
+// Unload terrain chunks meshes and material maps
+// NOTE: Material shader and textures are not unloaded, the user is responsible for freeing them
+void UnloadTerrain(Terrain terrain)
+{
+    for (int i = 0; i < terrain.chunkCountX*terrain.chunkCountZ*terrain.lodCount; i++) UnloadMesh(terrain.chunks[i]);
+
+    RL_FREE(terrain.chunks);
+    RL_FREE(terrain.bounds);
+    RL_FREE(terrain.material.maps);
+}
+
+// Draw terrain chunks, chunks outside view frustum are culled
+// NOTE: Chunk level of detail is selected by its distance to camera, full detail until terrain.lodDistance,
+// every doubling of distance selects next level of detail
+void DrawTerrain(Terrain terrain, Vector3 position, Color tint)
+{
+    if (terrain.chunks == NULL) return;
+
+    Matrix matModel = MatrixTranslate(position.x, position.y, position.z);
+
+    // Frustum planes and camera position in terrain local space
+    Matrix matLocalView = MatrixMultiply(MatrixMultiply(matModel, rlGetMatrixTransform()), rlGetMatrixModelview());
+    Matrix matViewLocal = MatrixInvert(matLocalView);
+    Vector3 viewPosition = { matViewLocal.m12, matViewLocal.m13, matViewLocal.m14 };
+
+    Vector4 frustum[6] = { 0 };
+    GetFrustumPlanes(MatrixMultiply(matLocalView, rlGetMatrixProjection()), frustum);
+
+    // NOTE: Stereo rendering uses a different frustum by eye, culling is not applied
+    bool culling = !rlIsStereoRenderEnabled();
+
+    Color color = terrain.material.maps[MATERIAL_MAP_DIFFUSE].color;
+
+    Color colorTint = WHITE;
+    colorTint.r = (unsigned char)((((float)color.r/255.0f)*((float)tint.r/255.0f))*255.0f);
+    colorTint.g = (unsigned char)((((float)color.g/255.0f)*((float)tint.g/255.0f))*255.0f);
+    colorTint.b = (unsigned char)((((float)color.b/255.0f)*((float)tint.b/255.0f))*255.0f);
+    colorTint.a = (unsigned char)((((float)color.a/255.0f)*((float)tint.a/255.0f))*255.0f);
+
+    terrain.material.maps[MATERIAL_MAP_DIFFUSE].color = colorTint;
+
+    for (int i = 0; i < terrain.chunkCountX*terrain.chunkCountZ; i++)
+    {
+        BoundingBox bounds = terrain.bounds[i];
+        Vector3 center = Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f);
+        Vector3 extent = Vector3Scale(Vector3Subtract(bounds.max, bounds.min), 0.5f);
+
+        if (culling && !IsBoxInFrustum(center, extent, frustum)) continue;
+
+        // Distance from camera to closest chunk point
+        float distance = Vector3Distance(viewPosition, Vector3Clamp(viewPosition, bounds.min, bounds.max));
+
+        int lod = 0;
+        for (float lodDistance = terrain.lodDistance; (distance > lodDistance) && (lod < terrain.lodCount - 1); lodDistance *= 2.0f) lod++;
+
+        DrawMesh(terrain.chunks[i*terrain.lodCount + lod], terrain.material, matModel);
+    }
+
+    terrain.material.maps[MATERIAL_MAP_DIFFUSE].color = color;
+}
+#endif      // SUPPORT_MESH_GENERATION
+
+// Compute mesh bounding box limits
+// NOTE: minVertex and maxVertex should be transformed by model transform matrix
+BoundingBox GetMeshBoundingBox(Mesh mesh)
+{
+    // Get min and max vertex to construct bounds (AABB)
+    Vector3 minVertex = { 0 };
+    Vector3 maxVertex = { 0 };
+
+    if (mesh.vertices != NULL)
+    {
+        minVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+        maxVertex = (Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+
+        for (int i = 1; i < mesh.vertexCount; i++)
+        {
+            minVertex = Vector3Min(minVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
+            maxVertex = Vector3Max(maxVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
+        }
+    }
+
+    // Create the bounding box
+    BoundingBox box = { 0 };
+    box.min = minVertex;
+    box.max = maxVertex;
+
+    return box;
+}
+
+// Compute mesh tangents
+// NOTE: To calculate mesh tangents and binormals we need mesh vertex positions and texture coordinates
 // Implementation based on: https://answers.unity.com/questions/7789/calculating-tangents-vector4.html
 void GenMeshTangents(Mesh *mesh)
 {
@@ -3408,505 +4207,2448 @@ void GenMeshTangents(Mesh *mesh)
     TRACELOG(LOG_INFO, "MESH: Tangents data computed and uploaded for provided mesh");
 }
 
-// Draw a model (with texture if set)
-void DrawModel(Model model, Vector3 position, float scale, Color tint)
+// Compute mesh bounding volume hierarchy, used by GetRayCollisionMesh()
+// NOTE: Hierarchy is built with surface area heuristic (SAH) from mesh.vertices,
+// it must be generated again if mesh vertex positions are modified
+void GenMeshBvh(Mesh *mesh)
 {
-    Vector3 vScale = { scale, scale, scale };
-    Vector3 rotationAxis = { 0.0f, 1.0f, 0.0f };
-
-    DrawModelEx(model, position, rotationAxis, 0.0f, vScale, tint);
-}
+    if ((mesh->vertices == NULL) || (mesh->triangleCount <= 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Vertices required to compute bounding volume hierarchy");
+        return;
+    }
 
-// Draw a model with extended parameters
-void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
-{
-    // Calculate transformation matrix from function parameters
-    // Get transform matrix (rotation -> scale -> translation)
-    Matrix matScale = MatrixScale(scale.x, scale.y, scale.z);
-    Matrix matRotation = MatrixRotate(rotationAxis, rotationAngle*DEG2RAD);
-    Matrix matTranslation = MatrixTranslate(position.x, position.y, position.z);
+    if (mesh->bvh != NULL)
+    {
+        RL_FREE(mesh->bvh->nodes);
+        RL_FREE(mesh->bvh->triangles);
+        RL_FREE(mesh->bvh);
+    }
 
-    Matrix matTransform = MatrixMultiply(MatrixMultiply(matScale, matRotation), matTranslation);
+    int triangleCount = mesh->triangleCount;
+    const Vector3 *vertices = (const Vector3 *)mesh->vertices;
 
-    // Combine model transformation matrix (model.transform) with matrix generated by function parameters (matTransform)
-    model.transform = MatrixMultiply(model.transform, matTransform);
+    MeshBvhBuilder builder = { 0 };
+    builder.vertices = (Vector3 *)RL_MALLOC(triangleCount*3*sizeof(Vector3));
+    builder.centroids = (Vector3 *)RL_MALLOC(triangleCount*sizeof(Vector3));
+    builder.bounds = (BoundingBox *)RL_MALLOC(triangleCount*sizeof(BoundingBox));
+    builder.order = (int *)RL_MALLOC(triangleCount*sizeof(int));
 
-    for (int i = 0; i < model.meshCount; i++)
+    for (int i = 0; i < triangleCount; i++)
     {
-        Color color = model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color;
+        Vector3 *triangle = builder.vertices + i*3;
 
-        Color colorTint = WHITE;
-        colorTint.r = (unsigned char)((((float)color.r/255.0f)*((float)tint.r/255.0f))*255.0f);
-        colorTint.g = (unsigned char)((((float)color.g/255.0f)*((float)tint.g/255.0f))*255.0f);
-        colorTint.b = (unsigned char)((((float)color.b/255.0f)*((float)tint.b/255.0f))*255.0f);
-        colorTint.a = (unsigned char)((((float)color.a/255.0f)*((float)tint.a/255.0f))*255.0f);
+        for (int k = 0; k < 3; k++) triangle[k] = vertices[(mesh->indices != NULL)? mesh->indices[i*3 + k] : i*3 + k];
 
-        model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color = colorTint;
-        DrawMesh(model.meshes[i], model.materials[model.meshMaterial[i]], model.transform);
-        model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color = color;
+        builder.bounds[i].min = Vector3Min(Vector3Min(triangle[0], triangle[1]), triangle[2]);
+        builder.bounds[i].max = Vector3Max(Vector3Max(triangle[0], triangle[1]), triangle[2]);
+        builder.centroids[i] = Vector3Scale(Vector3Add(builder.bounds[i].min, builder.bounds[i].max), 0.5f);
+        builder.order[i] = i;
     }
-}
 
-// Draw a model wires (with texture if set)
-void DrawModelWires(Model model, Vector3 position, float scale, Color tint)
-{
-    rlEnableWireMode();
+    // NOTE: A binary tree with n leaf nodes has (2*n - 1) nodes, at most one triangle by leaf
+    mesh->bvh = (rMeshBvh *)RL_CALLOC(1, sizeof(rMeshBvh));
+    mesh->bvh->nodes = (MeshBvhNode *)RL_MALLOC((2*triangleCount - 1)*sizeof(MeshBvhNode));
+    mesh->bvh->triangleCount = triangleCount;
+    builder.bvh = mesh->bvh;
 
-    DrawModel(model, position, scale, tint);
+    BuildMeshBvhNode(&builder, 0, triangleCount, 0);
 
-    rlDisableWireMode();
-}
+    mesh->bvh->nodes = (MeshBvhNode *)RL_REALLOC(mesh->bvh->nodes, mesh->bvh->nodeCount*sizeof(MeshBvhNode));
 
-// Draw a model wires (with texture if set) with extended parameters
-void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
-{
-    rlEnableWireMode();
+    // Store triangles in leaf order, leaf triangles are contiguous in memory
+    mesh->bvh->triangles = (Vector3 *)RL_MALLOC(triangleCount*3*sizeof(Vector3));
+    for (int i = 0; i < triangleCount; i++)
+    {
+        for (int k = 0; k < 3; k++) mesh->bvh->triangles[i*3 + k] = builder.vertices[builder.order[i]*3 + k];
+    }
 
-    DrawModelEx(model, position, rotationAxis, rotationAngle, scale, tint);
+    RL_FREE(builder.vertices);
+    RL_FREE(builder.centroids);
+    RL_FREE(builder.bounds);
+    RL_FREE(builder.order);
 
-    rlDisableWireMode();
+    TRACELOG(LOG_INFO, "MESH: Bounding volume hierarchy generated: %i triangles, %i nodes", triangleCount, mesh->bvh->nodeCount);
 }
 
-// Draw a billboard
-void DrawBillboard(Camera camera, Texture2D texture, Vector3 position, float size, Color tint)
+// Optimize mesh for GPU drawing, must be called before UploadMesh()
+// NOTE: Optimization steps:
+//  - Duplicated vertices are merged (all vertex attributes must match) and mesh is indexed
+//  - Triangles are reordered for post-transform vertex cache (Tom Forsyth linear-speed algorithm)
+//  - Triangles clusters are reordered to reduce overdraw, outward facing clusters drawn first
+//  - Vertices are reordered by first use, improving vertex fetch locality
+// WARNING: Meshes with more than 65535 unique vertices can not be indexed (unsigned short indices)
+void OptimizeMesh(Mesh *mesh)
 {
-    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+    if ((mesh->vertices == NULL) || (mesh->vertexCount <= 0) || (mesh->triangleCount <= 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Vertices required to optimize mesh");
+        return;
+    }
 
-    DrawBillboardRec(camera, texture, source, position, (Vector2){ size, size }, tint);
-}
+    if (mesh->vaoId > 0)
+    {
+        TRACELOG(LOG_WARNING, "MESH: [ID %i] Mesh already uploaded to GPU, optimization must be done before UploadMesh()", mesh->vaoId);
+        return;
+    }
 
-// Draw a billboard (part of a texture defined by a rectangle)
-void DrawBillboardRec(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector2 size, Color tint)
-{
-    // NOTE: Billboard locked on axis-Y
-    Vector3 up = { 0.0f, 1.0f, 0.0f };
+    void *streams[MESH_STREAM_COUNT] = { 0 };
+    int streamSizes[MESH_STREAM_COUNT] = { 0 };
+    GetMeshStreams(*mesh, streams, streamSizes);
 
-    DrawBillboardPro(camera, texture, source, position, up, size, Vector2Zero(), 0.0f, tint);
-}
+    int vertexSize = 0;
+    for (int k = 0; k < MESH_STREAM_COUNT; k++) if (streams[k] != NULL) vertexSize += streamSizes[k];
 
-void DrawBillboardPro(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector3 up, Vector2 size, Vector2 origin, float rotation, Color tint)
-{
-    // NOTE: Billboard size will maintain source rectangle aspect ratio, size will represent billboard width
-    Vector2 sizeRatio = { size.x*fabsf((float)source.width/source.height), size.y };
+    int indexCount = mesh->triangleCount*3;
+    unsigned int *indices = (unsigned int *)RL_MALLOC(indexCount*sizeof(unsigned int));
+    for (int i = 0; i < indexCount; i++) indices[i] = (mesh->indices != NULL)? mesh->indices[i] : (unsigned int)i;
 
-    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+#if defined(SUPPORT_TRACELOG_DEBUG)
+    double startTime = GetTime();
+    int sourceVertexCount = mesh->vertexCount;
+    float sourceAcmr = GetMeshACMR(indices, indexCount, mesh->vertexCount);
+#endif
 
-    Vector3 right = { matView.m0, matView.m4, matView.m8 };
-    //Vector3 up = { matView.m1, matView.m5, matView.m9 };
+    // Merge duplicated vertices, vertex attributes packed together for comparison
+    // NOTE: Hash table with open addressing, size is a power of two at least twice the vertex count
+    unsigned char *packed = (unsigned char *)RL_MALLOC(mesh->vertexCount*vertexSize);
+    for (int v = 0; v < mesh->vertexCount; v++)
+    {
+        unsigned char *vertex = packed + v*vertexSize;
+        for (int k = 0; k < MESH_STREAM_COUNT; k++)
+        {
+            if (streams[k] != NULL)
+            {
+                memcpy(vertex, (unsigned char *)streams[k] + v*streamSizes[k], streamSizes[k]);
+                vertex += streamSizes[k];
+            }
+        }
+    }
 
-    Vector3 rightScaled = Vector3Scale(right, sizeRatio.x/2);
-    Vector3 upScaled = Vector3Scale(up, sizeRatio.y/2);
+    int tableSize = 1;
+    while (tableSize < 2*mesh->vertexCount) tableSize *= 2;
 
-    Vector3 p1 = Vector3Add(rightScaled, upScaled);
-    Vector3 p2 = Vector3Subtract(rightScaled, upScaled);
+    int *table = (int *)RL_MALLOC(tableSize*sizeof(int));
+    for (int i = 0; i < tableSize; i++) table[i] = -1;
 
-    Vector3 topLeft = Vector3Scale(p2, -1);
-    Vector3 topRight = p1;
-    Vector3 bottomRight = p2;
-    Vector3 bottomLeft = Vector3Scale(p1, -1);
+    unsigned int *remap = (unsigned int *)RL_MALLOC(mesh->vertexCount*sizeof(unsigned int));
+    int *uniqueSource = (int *)RL_MALLOC(mesh->vertexCount*sizeof(int));     // Source vertex by unique vertex
+    int uniqueCount = 0;
 
-    if (rotation != 0.0f)
+    for (int v = 0; v < mesh->vertexCount; v++)
     {
-        float sinRotation = sinf(rotation*DEG2RAD);
-        float cosRotation = cosf(rotation*DEG2RAD);
+        const unsigned char *vertex = packed + v*vertexSize;
 
-        // NOTE: (-1, 1) is the range where origin.x, origin.y is inside the texture
-        float rotateAboutX = sizeRatio.x*origin.x/2;
-        float rotateAboutY = sizeRatio.y*origin.y/2;
+        unsigned int hash = 2166136261u;
+        for (int b = 0; b < vertexSize; b++) hash = (hash ^ vertex[b])*16777619u;
 
-        float xtvalue, ytvalue;
-        float rotatedX, rotatedY;
+        unsigned int slot = hash & (tableSize - 1);
+        while ((table[slot] != -1) && (memcmp(packed + uniqueSource[table[slot]]*vertexSize, vertex, vertexSize) != 0)) slot = (slot + 1) & (tableSize - 1);
 
-        xtvalue = Vector3DotProduct(right, topLeft) - rotateAboutX; // Project points to x and y coordinates on the billboard plane
-        ytvalue = Vector3DotProduct(up, topLeft) - rotateAboutY;
-        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX; // Rotate about the point origin
-        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
-        topLeft = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX)); // Translate back to cartesian coordinates
+        if (table[slot] == -1)
+        {
+            table[slot] = uniqueCount;
+            uniqueSource[uniqueCount++] = v;
+        }
 
-        xtvalue = Vector3DotProduct(right, topRight) - rotateAboutX;
-        ytvalue = Vector3DotProduct(up, topRight) - rotateAboutY;
-        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX;
-        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
-        topRight = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX));
+        remap[v] = table[slot];
+    }
 
-        xtvalue = Vector3DotProduct(right, bottomRight) - rotateAboutX;
-        ytvalue = Vector3DotProduct(up, bottomRight) - rotateAboutY;
-        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX;
-        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
-        bottomRight = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX));
+    RL_FREE(table);
+    RL_FREE(packed);
 
-        xtvalue = Vector3DotProduct(right, bottomLeft)-rotateAboutX;
-        ytvalue = Vector3DotProduct(up, bottomLeft)-rotateAboutY;
-        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX;
-        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
-        bottomLeft = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX));
+    if (uniqueCount > 65535)
+    {
+        TRACELOG(LOG_WARNING, "MESH: Mesh can not be optimized, %i unique vertices exceed indices range", uniqueCount);
+        RL_FREE(indices);
+        RL_FREE(remap);
+        RL_FREE(uniqueSource);
+        return;
     }
 
-    // Translate points to the draw center (position)
-    topLeft = Vector3Add(topLeft, position);
-    topRight = Vector3Add(topRight, position);
-    bottomRight = Vector3Add(bottomRight, position);
-    bottomLeft = Vector3Add(bottomLeft, position);
+    for (int i = 0; i < indexCount; i++) indices[i] = remap[indices[i]];
 
-    rlSetTexture(texture.id);
+    // Reorder triangles for vertex cache and overdraw
+    Vector3 *positions = (Vector3 *)RL_MALLOC(uniqueCount*sizeof(Vector3));
+    for (int i = 0; i < uniqueCount; i++) memcpy(&positions[i], mesh->vertices + uniqueSource[i]*3, sizeof(Vector3));
 
-    rlBegin(RL_QUADS);
-        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+    OptimizeMeshVertexCache(indices, indexCount, uniqueCount);
+    OptimizeMeshOverdraw(indices, indexCount, positions, uniqueCount);
 
-        if (sizeRatio.x * sizeRatio.y >= 0.0f)
-        {
-            // Bottom-left corner for texture and quad
-            rlTexCoord2f((float)source.x/texture.width, (float)source.y/texture.height);
-            rlVertex3f(topLeft.x, topLeft.y, topLeft.z);
+    RL_FREE(positions);
 
-            // Top-left corner for texture and quad
-            rlTexCoord2f((float)source.x/texture.width, (float)(source.y + source.height)/texture.height);
-            rlVertex3f(bottomLeft.x, bottomLeft.y, bottomLeft.z);
+    // Reorder vertices by first use, unused vertices are removed
+    for (int i = 0; i < uniqueCount; i++) remap[i] = 0xffffffff;
 
-            // Top-right corner for texture and quad
-            rlTexCoord2f((float)(source.x + source.width)/texture.width, (float)(source.y + source.height)/texture.height);
-            rlVertex3f(bottomRight.x, bottomRight.y, bottomRight.z);
+    int vertexCount = 0;
+    for (int i = 0; i < indexCount; i++)
+    {
+        if (remap[indices[i]] == 0xffffffff) remap[indices[i]] = vertexCount++;
+        indices[i] = remap[indices[i]];
+    }
 
-            // Bottom-right corner for texture and quad
-            rlTexCoord2f((float)(source.x + source.width)/texture.width, (float)source.y/texture.height);
-            rlVertex3f(topRight.x, topRight.y, topRight.z);
-        }
-        else
-        {
-            // Reverse vertex order if the size has only one negative dimension
-            rlTexCoord2f((float)(source.x + source.width)/texture.width, (float)source.y/texture.height);
-            rlVertex3f(topRight.x, topRight.y, topRight.z);
+    int *source = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    for (int i = 0; i < uniqueCount; i++) if (remap[i] != 0xffffffff) source[remap[i]] = uniqueSource[i];
 
-            rlTexCoord2f((float)(source.x + source.width)/texture.width, (float)(source.y + source.height)/texture.height);
-            rlVertex3f(bottomRight.x, bottomRight.y, bottomRight.z);
+    void *optStreams[MESH_STREAM_COUNT] = { 0 };
+    for (int k = 0; k < MESH_STREAM_COUNT; k++)
+    {
+        if (streams[k] == NULL) continue;
 
-            rlTexCoord2f((float)source.x/texture.width, (float)(source.y + source.height)/texture.height);
-            rlVertex3f(bottomLeft.x, bottomLeft.y, bottomLeft.z);
+        optStreams[k] = RL_MALLOC(vertexCount*streamSizes[k]);
+        for (int v = 0; v < vertexCount; v++) memcpy((unsigned char *)optStreams[k] + v*streamSizes[k], (unsigned char *)streams[k] + source[v]*streamSizes[k], streamSizes[k]);
+    }
 
-            rlTexCoord2f((float)source.x/texture.width, (float)source.y/texture.height);
-            rlVertex3f(topLeft.x, topLeft.y, topLeft.z);
-        }
+    // NOTE: Vertex data pointer identifies cached bounding box, it must be removed before freeing data
+    UnloadMeshBoundingBoxCached(*mesh);
 
-    rlEnd();
+    for (int k = 0; k < MESH_STREAM_COUNT; k++) RL_FREE(streams[k]);
+    SetMeshStreams(mesh, optStreams);
 
-    rlSetTexture(0);
-}
+    RL_FREE(mesh->indices);
+    mesh->indices = (unsigned short *)RL_MALLOC(indexCount*sizeof(unsigned short));
+    for (int i = 0; i < indexCount; i++) mesh->indices[i] = (unsigned short)indices[i];
 
-// Draw a bounding box with wires
-void DrawBoundingBox(BoundingBox box, Color color)
-{
-    Vector3 size = { 0 };
+    mesh->vertexCount = vertexCount;
 
-    size.x = fabsf(box.max.x - box.min.x);
-    size.y = fabsf(box.max.y - box.min.y);
-    size.z = fabsf(box.max.z - box.min.z);
+    // Triangles order changed, bounding volume hierarchy must be generated again
+    if (mesh->bvh != NULL) GenMeshBvh(mesh);
 
-    Vector3 center = { box.min.x + size.x/2.0f, box.min.y + size.y/2.0f, box.min.z + size.z/2.0f };
+#if defined(SUPPORT_TRACELOG_DEBUG)
+    TRACELOGD("MESH: Mesh optimized in %.2f ms: %i -> %i vertices, ACMR %.3f -> %.3f (cache size %i)", (GetTime() - startTime)*1000.0,
+        sourceVertexCount, vertexCount, sourceAcmr, GetMeshACMR(indices, indexCount, vertexCount), MESH_VERTEX_CACHE_SIZE);
+#endif
 
-    DrawCubeWires(center, size.x, size.y, size.z, color);
+    RL_FREE(source);
+    RL_FREE(indices);
+    RL_FREE(remap);
+    RL_FREE(uniqueSource);
 }
 
-// Check collision between two spheres
-bool CheckCollisionSpheres(Vector3 center1, float radius1, Vector3 center2, float radius2)
+// Generate simplified mesh (quadric error metric), ratio of triangles kept [0.0f..1.0f]
+// NOTE: Edges are collapsed into one of their vertex (keeping vertex attributes), in order of quadric error,
+// vertices on mesh borders and attributes seams (texcoords, colors) are kept to avoid holes and distortions
+Mesh GenMeshSimplified(Mesh mesh, float ratio)
 {
-    bool collision = false;
+    Mesh result = { 0 };
 
-    // Simple way to check for collision, just checking distance between two points
-    // Unfortunately, sqrtf() is a costly operation, so we avoid it with following solution
-    /*
-    float dx = center1.x - center2.x;      // X distance between centers
-    float dy = center1.y - center2.y;      // Y distance between centers
-    float dz = center1.z - center2.z;      // Z distance between centers
+    if ((mesh.vertices == NULL) || (mesh.triangleCount <= 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Vertices required to simplify mesh");
+        return result;
+    }
+
+    int triangleCount = mesh.triangleCount;
+    int targetCount = (int)(triangleCount*ratio);
+    const Vector3 *vertices = (const Vector3 *)mesh.vertices;
+
+    // Triangles corners: position id and source vertex (wedge)
+    unsigned int *corners = (unsigned int *)RL_MALLOC(triangleCount*3*sizeof(unsigned int));
+    unsigned int *wedges = (unsigned int *)RL_MALLOC(triangleCount*3*sizeof(unsigned int));
+    for (int i = 0; i < triangleCount*3; i++) wedges[i] = (mesh.indices != NULL)? mesh.indices[i] : (unsigned int)i;
+
+    // Weld vertices by position, hash table with open addressing
+    int tableSize = 1;
+    while (tableSize < 2*mesh.vertexCount) tableSize *= 2;
+
+    int *table = (int *)RL_MALLOC(tableSize*sizeof(int));
+    for (int i = 0; i < tableSize; i++) table[i] = -1;
+
+    unsigned int *positionIds = (unsigned int *)RL_MALLOC(mesh.vertexCount*sizeof(unsigned int));
+    unsigned int *positionFirst = (unsigned int *)RL_MALLOC(mesh.vertexCount*sizeof(unsigned int));     // First vertex by position
+    int positionCount = 0;
+
+    for (int v = 0; v < mesh.vertexCount; v++)
+    {
+        const unsigned char *bytes = (const unsigned char *)&vertices[v];
+
+        unsigned int hash = 2166136261u;
+        for (int b = 0; b < (int)sizeof(Vector3); b++) hash = (hash ^ bytes[b])*16777619u;
+
+        unsigned int slot = hash & (tableSize - 1);
+        while ((table[slot] != -1) && (memcmp(&vertices[positionFirst[table[slot]]], &vertices[v], sizeof(Vector3)) != 0)) slot = (slot + 1) & (tableSize - 1);
+
+        if (table[slot] == -1)
+        {
+            table[slot] = positionCount;
+            positionFirst[positionCount++] = v;
+        }
+
+        positionIds[v] = table[slot];
+    }
+
+    RL_FREE(table);
+
+    for (int i = 0; i < triangleCount*3; i++) corners[i] = positionIds[wedges[i]];
+
+    // Position wedges list (vertices sharing position)
+    int *wedgeOffsets = (int *)RL_CALLOC(positionCount + 1, sizeof(int));
+    for (int v = 0; v < mesh.vertexCount; v++) wedgeOffsets[positionIds[v] + 1]++;
+    for (int p = 0; p < positionCount; p++) wedgeOffsets[p + 1] += wedgeOffsets[p];
+
+    unsigned int *wedgeList = (unsigned int *)RL_MALLOC(mesh.vertexCount*sizeof(unsigned int));
+    int *fill = (int *)RL_MALLOC(positionCount*sizeof(int));
+    memcpy(fill, wedgeOffsets, positionCount*sizeof(int));
+    for (int v = 0; v < mesh.vertexCount; v++) wedgeList[fill[positionIds[v]]++] = v;
+    RL_FREE(fill);
+
+    // Lock attributes seams: positions with vertices of different texcoords or colors
+    // NOTE: Different normals are not considered seams, simplified mesh could take normals from any vertex
+    bool *locked = (bool *)RL_CALLOC(positionCount, sizeof(bool));
+    for (int v = 0; v < mesh.vertexCount; v++)
+    {
+        unsigned int first = positionFirst[positionIds[v]];
+
+        if (((mesh.texcoords != NULL) && (memcmp(mesh.texcoords + v*2, mesh.texcoords + first*2, 2*sizeof(float)) != 0)) ||
+            ((mesh.texcoords2 != NULL) && (memcmp(mesh.texcoords2 + v*2, mesh.texcoords2 + first*2, 2*sizeof(float)) != 0)) ||
+            ((mesh.colors != NULL) && (memcmp(mesh.colors + v*4, mesh.colors + first*4, 4) != 0))) locked[positionIds[v]] = true;
+    }
+
+    // Lock borders and non-manifold edges: edges not shared by exactly two triangles
+    unsigned long long *edges = (unsigned long long *)RL_MALLOC(triangleCount*3*sizeof(unsigned long long));
+    for (int t = 0; t < triangleCount; t++)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            unsigned int a = corners[t*3 + k];
+            unsigned int b = corners[t*3 + (k + 1)%3];
+            edges[t*3 + k] = (a < b)? (((unsigned long long)a << 32) | b) : (((unsigned long long)b << 32) | a);
+        }
+    }
+
+    qsort(edges, triangleCount*3, sizeof(unsigned long long), CompareMeshEdges);
+
+    for (int i = 0, count = 1; i < triangleCount*3; i++, count++)
+    {
+        if ((i == (triangleCount*3 - 1)) || (edges[i + 1] != edges[i]))
+        {
+            if (count != 2)
+            {
+                locked[edges[i] >> 32] = true;
+                locked[edges[i] & 0xffffffff] = true;
+            }
+
+            count = 0;
+        }
+    }
+
+    RL_FREE(edges);
+
+    // Positions quadrics, planes of adjacent triangles weighted by triangle area
+    MeshQuadric *quadrics = (MeshQuadric *)RL_CALLOC(positionCount, sizeof(MeshQuadric));
+    for (int t = 0; t < triangleCount; t++)
+    {
+        Vector3 p0 = vertices[positionFirst[corners[t*3]]];
+        Vector3 p1 = vertices[positionFirst[corners[t*3 + 1]]];
+        Vector3 p2 = vertices[positionFirst[corners[t*3 + 2]]];
+
+        Vector3 normal = Vector3CrossProduct(Vector3Subtract(p1, p0), Vector3Subtract(p2, p0));
+        float length = Vector3Length(normal);
+        if (length == 0.0f) continue;
+
+        normal = Vector3Scale(normal, 1.0f/length);
+        double a = normal.x, b = normal.y, c = normal.z, d = -Vector3DotProduct(normal, p0);
+        double w = length*0.5;
+
+        MeshQuadric q = { w*a*a, w*a*b, w*a*c, w*a*d, w*b*b, w*b*c, w*b*d, w*c*c, w*c*d, w*d*d };
+        for (int k = 0; k < 3; k++) AddMeshQuadric(&quadrics[corners[t*3 + k]], &q);
+    }
+
+    // Collapse edges in passes, collapses in a pass do not share vertices neighborhood
+    unsigned int *collapses = (unsigned int *)RL_MALLOC(positionCount*sizeof(unsigned int));
+    bool *touched = (bool *)RL_MALLOC(positionCount*sizeof(bool));
+    int *triangleOffsets = (int *)RL_MALLOC((positionCount + 1)*sizeof(int));
+    int *adjacency = (int *)RL_MALLOC(triangleCount*3*sizeof(int));
+    MeshCollapse *candidates = (MeshCollapse *)RL_MALLOC(triangleCount*6*sizeof(MeshCollapse));
+
+    while (triangleCount > targetCount)
+    {
+        // Position triangles adjacency
+        memset(triangleOffsets, 0, (positionCount + 1)*sizeof(int));
+        for (int i = 0; i < triangleCount*3; i++) triangleOffsets[corners[i] + 1]++;
+        for (int p = 0; p < positionCount; p++) triangleOffsets[p + 1] += triangleOffsets[p];
+
+        fill = (int *)RL_MALLOC(positionCount*sizeof(int));
+        memcpy(fill, triangleOffsets, positionCount*sizeof(int));
+        for (int i = 0; i < triangleCount*3; i++) adjacency[fill[corners[i]]++] = i/3;
+        RL_FREE(fill);
+
+        // Collapse candidates, every edge collapsed in both directions (if vertex not locked)
+        int candidateCount = 0;
+        for (int t = 0; t < triangleCount; t++)
+        {
+            for (int k = 0; k < 3; k++)
+            {
+                unsigned int a = corners[t*3 + k];
+                unsigned int b = corners[t*3 + (k + 1)%3];
+
+                MeshQuadric q = quadrics[a];
+                AddMeshQuadric(&q, &quadrics[b]);
+
+                if (!locked[a]) candidates[candidateCount++] = (MeshCollapse){ GetMeshQuadricError(&q, vertices[positionFirst[b]]), a, b };
+                if (!locked[b]) candidates[candidateCount++] = (MeshCollapse){ GetMeshQuadricError(&q, vertices[positionFirst[a]]), b, a };
+            }
+        }
+
+        qsort(candidates, candidateCount, sizeof(MeshCollapse), CompareMeshCollapses);
+
+        for (int p = 0; p < positionCount; p++)
+        {
+            collapses[p] = p;
+            touched[p] = false;
+        }
+
+        int removedCount = 0;
+        int collapseCount = 0;
+
+        for (int c = 0; (c < candidateCount) && ((triangleCount - removedCount) > targetCount); c++)
+        {
+            unsigned int from = candidates[c].from;
+            unsigned int to = candidates[c].to;
+
+            if (touched[from] || touched[to]) continue;
+
+            // Check triangles normals are not flipped by collapse
+            bool valid = true;
+            int removed = 0;
+            Vector3 target = vertices[positionFirst[to]];
+
+            for (int a = triangleOffsets[from]; valid && (a < triangleOffsets[from + 1]); a++)
+            {
+                const unsigned int *triangle = corners + adjacency[a]*3;
+
+                if ((triangle[0] == to) || (triangle[1] == to) || (triangle[2] == to))
+                {
+                    removed++;
+                    continue;
+                }
+
+                Vector3 p[3] = { 0 };
+                for (int k = 0; k < 3; k++) p[k] = vertices[positionFirst[triangle[k]]];
+
+                Vector3 normal = Vector3CrossProduct(Vector3Subtract(p[1], p[0]), Vector3Subtract(p[2], p[0]));
+                for (int k = 0; k < 3; k++) if (triangle[k] == from) p[k] = target;
+                Vector3 collapsedNormal = Vector3CrossProduct(Vector3Subtract(p[1], p[0]), Vector3Subtract(p[2], p[0]));
+
+                valid = (Vector3DotProduct(normal, collapsedNormal) > 0.25f*Vector3Length(normal)*Vector3Length(collapsedNormal));
+            }
+
+            if (!valid) continue;
+
+            collapses[from] = to;
+            AddMeshQuadric(&quadrics[to], &quadrics[from]);
+            removedCount += removed;
+            collapseCount++;
+
+            // Vertices around collapsed vertex are not collapsed again in this pass
+            for (int a = triangleOffsets[from]; a < triangleOffsets[from + 1]; a++)
+            {
+                for (int k = 0; k < 3; k++) touched[corners[adjacency[a]*3 + k]] = true;
+            }
+        }
+
+        if (collapseCount == 0) break;
+
+        // Apply collapses, corners take the collapse target vertex closest in attributes
+        int newCount = 0;
+        for (int t = 0; t < triangleCount; t++)
+        {
+            unsigned int triangle[3] = { 0 };
+            unsigned int triangleWedges[3] = { 0 };
+
+            for (int k = 0; k < 3; k++)
+            {
+                unsigned int position = corners[t*3 + k];
+                unsigned int wedge = wedges[t*3 + k];
+
+                if (collapses[position] != position)
+                {
+                    position = collapses[position];
+
+                    float bestDistance = -1.0f;
+                    for (int w = wedgeOffsets[position]; w < wedgeOffsets[position + 1]; w++)
+                    {
+                        unsigned int candidate = wedgeList[w];
+                        float distance = 0.0f;
+
+                        if (mesh.texcoords != NULL) distance += Vector2DistanceSqr(*(Vector2 *)(mesh.texcoords + candidate*2), *(Vector2 *)(mesh.texcoords + wedge*2));
+                        if (mesh.normals != NULL) distance += Vector3DistanceSqr(*(Vector3 *)(mesh.normals + candidate*3), *(Vector3 *)(mesh.normals + wedge*3));
+
+                        if ((bestDistance < 0.0f) || (distance < bestDistance))
+                        {
+                            bestDistance = distance;
+                            triangleWedges[k] = candidate;
+                        }
+                    }
+                }
+                else triangleWedges[k] = wedge;
+
+                triangle[k] = position;
+            }
+
+            // Degenerated triangles are removed
+            if ((triangle[0] == triangle[1]) || (triangle[1] == triangle[2]) || (triangle[0] == triangle[2])) continue;
+
+            memcpy(corners + newCount*3, triangle, 3*sizeof(unsigned int));
+            memcpy(wedges + newCount*3, triangleWedges, 3*sizeof(unsigned int));
+            newCount++;
+        }
+
+        triangleCount = newCount;
+    }
+
+    RL_FREE(candidates);
+    RL_FREE(adjacency);
+    RL_FREE(triangleOffsets);
+    RL_FREE(touched);
+    RL_FREE(collapses);
+    RL_FREE(quadrics);
+    RL_FREE(locked);
+    RL_FREE(wedgeList);
+    RL_FREE(wedgeOffsets);
+    RL_FREE(positionFirst);
+    RL_FREE(positionIds);
+    RL_FREE(corners);
+
+    // Generate simplified mesh, only used vertices are kept
+    unsigned int *remap = (unsigned int *)RL_MALLOC(mesh.vertexCount*sizeof(unsigned int));
+    for (int v = 0; v < mesh.vertexCount; v++) remap[v] = 0xffffffff;
+
+    int *source = (int *)RL_MALLOC(triangleCount*3*sizeof(int));
+    int vertexCount = 0;
+
+    for (int i = 0; i < triangleCount*3; i++)
+    {
+        if (remap[wedges[i]] == 0xffffffff)
+        {
+            source[vertexCount] = wedges[i];
+            remap[wedges[i]] = vertexCount++;
+        }
+    }
+
+    if ((vertexCount > 65535) || (triangleCount == 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Mesh can not be simplified (%i vertices, %i triangles)", vertexCount, triangleCount);
+    }
+    else
+    {
+        void *streams[MESH_STREAM_COUNT] = { 0 };
+        int streamSizes[MESH_STREAM_COUNT] = { 0 };
+        GetMeshStreams(mesh, streams, streamSizes);
+
+        void *resultStreams[MESH_STREAM_COUNT] = { 0 };
+        for (int k = 0; k < MESH_STREAM_COUNT; k++)
+        {
+            if (streams[k] == NULL) continue;
+
+            resultStreams[k] = RL_MALLOC(vertexCount*streamSizes[k]);
+            for (int v = 0; v < vertexCount; v++) memcpy((unsigned char *)resultStreams[k] + v*streamSizes[k], (unsigned char *)streams[k] + source[v]*streamSizes[k], streamSizes[k]);
+        }
+
+        SetMeshStreams(&result, resultStreams);
+
+        result.vertexCount = vertexCount;
+        result.triangleCount = triangleCount;
+        result.indices = (unsigned short *)RL_MALLOC(triangleCount*3*sizeof(unsigned short));
+        for (int i = 0; i < triangleCount*3; i++) result.indices[i] = (unsigned short)remap[wedges[i]];
+
+        TRACELOGD("MESH: Mesh simplified: %i -> %i triangles, %i -> %i vertices", mesh.triangleCount, triangleCount, mesh.vertexCount, vertexCount);
+
+        // Upload vertex data to GPU (static mesh)
+        UploadMesh(&result, false);
+    }
+
+    RL_FREE(source);
+    RL_FREE(remap);
+    RL_FREE(wedges);
+
+    return result;
+}
+
+// Draw a model (with texture if set)
+void DrawModel(Model model, Vector3 position, float scale, Color tint)
+{
+    Vector3 vScale = { scale, scale, scale };
+    Vector3 rotationAxis = { 0.0f, 1.0f, 0.0f };
+
+    DrawModelEx(model, position, rotationAxis, 0.0f, vScale, tint);
+}
+
+// Draw a model with extended parameters
+void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
+{
+    // Calculate transformation matrix from function parameters
+    // Get transform matrix (rotation -> scale -> translation)
+    Matrix matScale = MatrixScale(scale.x, scale.y, scale.z);
+    Matrix matRotation = MatrixRotate(rotationAxis, rotationAngle*DEG2RAD);
+    Matrix matTranslation = MatrixTranslate(position.x, position.y, position.z);
+
+    Matrix matTransform = MatrixMultiply(MatrixMultiply(matScale, matRotation), matTranslation);
+
+    // Combine model transformation matrix (model.transform) with matrix generated by function parameters (matTransform)
+    model.transform = MatrixMultiply(model.transform, matTransform);
+
+    // Select level of detail (if available), same level is used for all meshes
+    int lod = (model.lodCount > 0)? GetModelLod(model, model.transform) : 0;
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        // Use closest generated level of detail, mesh full detail if none
+        Mesh mesh = model.meshes[i];
+        for (int l = lod; l > 0; l--)
+        {
+            if (model.lodMeshes[(l - 1)*model.meshCount + i].vertexCount > 0)
+            {
+                mesh = model.lodMeshes[(l - 1)*model.meshCount + i];
+                break;
+            }
+        }
+
+        Color color = model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color;
+
+        Color colorTint = WHITE;
+        colorTint.r = (unsigned char)((((float)color.r/255.0f)*((float)tint.r/255.0f))*255.0f);
+        colorTint.g = (unsigned char)((((float)color.g/255.0f)*((float)tint.g/255.0f))*255.0f);
+        colorTint.b = (unsigned char)((((float)color.b/255.0f)*((float)tint.b/255.0f))*255.0f);
+        colorTint.a = (unsigned char)((((float)color.a/255.0f)*((float)tint.a/255.0f))*255.0f);
+
+        model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color = colorTint;
+        DrawMesh(mesh, model.materials[model.meshMaterial[i]], model.transform);
+        model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_DIFFUSE].color = color;
+    }
+}
+
+// Draw a model wires (with texture if set)
+void DrawModelWires(Model model, Vector3 position, float scale, Color tint)
+{
+    if (meshQueue.active) meshQueue.wires = true;
+    else rlEnableWireMode();
+
+    DrawModel(model, position, scale, tint);
+
+    if (meshQueue.active) meshQueue.wires = false;
+    else rlDisableWireMode();
+}
+
+// Draw a model wires (with texture if set) with extended parameters
+void DrawModelWiresEx(Model model, Vector3 position, Vector3 rotationAxis, float rotationAngle, Vector3 scale, Color tint)
+{
+    if (meshQueue.active) meshQueue.wires = true;
+    else rlEnableWireMode();
+
+    DrawModelEx(model, position, rotationAxis, rotationAngle, scale, tint);
+
+    if (meshQueue.active) meshQueue.wires = false;
+    else rlDisableWireMode();
+}
+
+// Begin queuing meshes drawing
+// NOTE: DrawMesh() calls are queued until EndMeshQueue(), meshes outside current camera frustum
+// (BeginMode3D()) are discarded and remaining meshes are drawn sorted by shader, texture and mesh,
+// sorting does not keep drawing order, queue should be used for opaque meshes
+// NOTE: Repeated meshes (same mesh, material and tint) using default shader are drawn instanced
+void BeginMeshQueue(void)
+{
+    meshQueue.active = true;
+    meshQueue.wires = false;
+    meshQueue.count = 0;
+    meshQueue.culledCount = 0;
+    meshQueue.instancedCount = 0;
+    meshQueue.drawCount = 0;
+    meshQueue.culling = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: Stereo rendering uses a different frustum by eye, culling is not applied
+    if (!rlIsStereoRenderEnabled())
+    {
+        GetFrustumPlanes(MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection()), meshQueue.frustum);
+        meshQueue.culling = true;
+    }
+#endif
+}
+
+// End queuing meshes drawing and draw queued meshes
+// NOTE: Must be called with same camera than BeginMeshQueue(), rlgl transform (rlPushMatrix()) is applied
+// to queued meshes transforms at DrawMesh() time, so current rlgl transform is not applied again
+void EndMeshQueue(void)
+{
+    if (!meshQueue.active) return;
+
+    meshQueue.active = false;
+
+    if (meshQueue.count > 0)
+    {
+        // Sort queued meshes by shader, diffuse texture and mesh to minimize state changes
+        MeshQueueKey *keys = (MeshQueueKey *)RL_MALLOC(meshQueue.count*sizeof(MeshQueueKey));
+
+        for (int i = 0; i < meshQueue.count; i++)
+        {
+            keys[i].shader = meshQueue.entries[i].material.shader.id;
+            keys[i].texture = meshQueue.entries[i].material.maps[MATERIAL_MAP_DIFFUSE].texture.id;
+            keys[i].mesh = meshQueue.entries[i].mesh.vaoId;
+            keys[i].maps = meshQueue.entries[i].material.maps;
+            keys[i].color = ((unsigned int)meshQueue.entries[i].color.r << 24) | ((unsigned int)meshQueue.entries[i].color.g << 16) |
+                            ((unsigned int)meshQueue.entries[i].color.b << 8) | (unsigned int)meshQueue.entries[i].color.a;
+            keys[i].wires = meshQueue.entries[i].wires;
+            keys[i].index = i;
+        }
+
+        qsort(keys, meshQueue.count, sizeof(MeshQueueKey), CompareMeshQueueKeys);
+
+        Matrix *transforms = NULL;      // Instances transforms, only allocated if required
+
+        // Queued transforms already include rlgl transform at queuing time
+        rlPushMatrix();
+        rlLoadIdentity();
+
+        for (int i = 0; i < meshQueue.count; )
+        {
+            MeshQueueEntry *entry = &meshQueue.entries[keys[i].index];
+
+            // Count following entries with same mesh, material and tint, drawn with a single instanced draw
+            int instances = 1;
+            if (IsMeshQueueEntryInstanceable(entry))
+            {
+                while (((i + instances) < meshQueue.count) && (keys[i + instances].mesh == keys[i].mesh) &&
+                       (keys[i + instances].shader == keys[i].shader) && (keys[i + instances].maps == keys[i].maps) &&
+                       (keys[i + instances].color == keys[i].color) && (keys[i + instances].wires == keys[i].wires)) instances++;
+            }
+
+            // Restore material diffuse color at queuing time, material maps could be shared with other entries
+            Color color = entry->material.maps[MATERIAL_MAP_DIFFUSE].color;
+            entry->material.maps[MATERIAL_MAP_DIFFUSE].color = entry->color;
+
+            if (entry->wires) rlEnableWireMode();
+
+            if (instances >= MESH_QUEUE_MIN_INSTANCES)
+            {
+                if (transforms == NULL) transforms = (Matrix *)RL_MALLOC(meshQueue.count*sizeof(Matrix));
+
+                for (int k = 0; k < instances; k++) transforms[k] = meshQueue.entries[keys[i + k].index].transform;
+
+                DrawMeshInstanced(entry->mesh, entry->material, transforms, instances);
+                meshQueue.instancedCount += instances;
+                meshQueue.drawCount++;
+            }
+            else
+            {
+                // NOTE: Not enough equal meshes to be instanced, all of them are drawn one by one
+                for (int k = 0; k < instances; k++)
+                {
+                    MeshQueueEntry *instance = &meshQueue.entries[keys[i + k].index];
+                    DrawMesh(instance->mesh, instance->material, instance->transform);
+                }
+
+                meshQueue.drawCount += instances;
+            }
+
+            if (entry->wires) rlDisableWireMode();
+
+            entry->material.maps[MATERIAL_MAP_DIFFUSE].color = color;
+
+            i += instances;
+        }
+
+        rlPopMatrix();
+
+        RL_FREE(transforms);
+        RL_FREE(keys);
+    }
+
+    TRACELOGD("MODEL: Mesh queue: %i meshes drawn (%i instanced) in %i draws, %i meshes culled",
+        meshQueue.count, meshQueue.instancedCount, meshQueue.drawCount, meshQueue.culledCount);
+
+    meshQueue.count = 0;
+}
+
+// Draw a billboard
+void DrawBillboard(Camera camera, Texture2D texture, Vector3 position, float size, Color tint)
+{
+    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+
+    DrawBillboardRec(camera, texture, source, position, (Vector2){ size, size }, tint);
+}
+
+// Draw a billboard (part of a texture defined by a rectangle)
+void DrawBillboardRec(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector2 size, Color tint)
+{
+    // NOTE: Billboard locked on axis-Y
+    Vector3 up = { 0.0f, 1.0f, 0.0f };
+
+    DrawBillboardPro(camera, texture, source, position, up, size, Vector2Zero(), 0.0f, tint);
+}
+
+void DrawBillboardPro(Camera camera, Texture2D texture, Rectangle source, Vector3 position, Vector3 up, Vector2 size, Vector2 origin, float rotation, Color tint)
+{
+    // NOTE: Billboard size will maintain source rectangle aspect ratio, size will represent billboard width
+    Vector2 sizeRatio = { size.x*fabsf((float)source.width/source.height), size.y };
+
+    Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+
+    Vector3 right = { matView.m0, matView.m4, matView.m8 };
+    //Vector3 up = { matView.m1, matView.m5, matView.m9 };
+
+    Vector3 rightScaled = Vector3Scale(right, sizeRatio.x/2);
+    Vector3 upScaled = Vector3Scale(up, sizeRatio.y/2);
+
+    Vector3 p1 = Vector3Add(rightScaled, upScaled);
+    Vector3 p2 = Vector3Subtract(rightScaled, upScaled);
+
+    Vector3 topLeft = Vector3Scale(p2, -1);
+    Vector3 topRight = p1;
+    Vector3 bottomRight = p2;
+    Vector3 bottomLeft = Vector3Scale(p1, -1);
+
+    if (rotation != 0.0f)
+    {
+        float sinRotation = sinf(rotation*DEG2RAD);
+        float cosRotation = cosf(rotation*DEG2RAD);
+
+        // NOTE: (-1, 1) is the range where origin.x, origin.y is inside the texture
+        float rotateAboutX = sizeRatio.x*origin.x/2;
+        float rotateAboutY = sizeRatio.y*origin.y/2;
+
+        float xtvalue, ytvalue;
+        float rotatedX, rotatedY;
+
+        xtvalue = Vector3DotProduct(right, topLeft) - rotateAboutX; // Project points to x and y coordinates on the billboard plane
+        ytvalue = Vector3DotProduct(up, topLeft) - rotateAboutY;
+        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX; // Rotate about the point origin
+        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
+        topLeft = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX)); // Translate back to cartesian coordinates
+
+        xtvalue = Vector3DotProduct(right, topRight) - rotateAboutX;
+        ytvalue = Vector3DotProduct(up, topRight) - rotateAboutY;
+        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX;
+        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
+        topRight = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX));
+
+        xtvalue = Vector3DotProduct(right, bottomRight) - rotateAboutX;
+        ytvalue = Vector3DotProduct(up, bottomRight) - rotateAboutY;
+        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX;
+        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
+        bottomRight = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX));
+
+        xtvalue = Vector3DotProduct(right, bottomLeft)-rotateAboutX;
+        ytvalue = Vector3DotProduct(up, bottomLeft)-rotateAboutY;
+        rotatedX = xtvalue*cosRotation - ytvalue*sinRotation + rotateAboutX;
+        rotatedY = xtvalue*sinRotation + ytvalue*cosRotation + rotateAboutY;
+        bottomLeft = Vector3Add(Vector3Scale(up, rotatedY), Vector3Scale(right, rotatedX));
+    }
+
+    // Translate points to the draw center (position)
+    topLeft = Vector3Add(topLeft, position);
+    topRight = Vector3Add(topRight, position);
+    bottomRight = Vector3Add(bottomRight, position);
+    bottomLeft = Vector3Add(bottomLeft, position);
+
+    rlSetTexture(texture.id);
+
+    rlBegin(RL_QUADS);
+        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+
+        if (sizeRatio.x * sizeRatio.y >= 0.0f)
+        {
+            // Bottom-left corner for texture and quad
+            rlTexCoord2f((float)source.x/texture.width, (float)source.y/texture.height);
+            rlVertex3f(topLeft.x, topLeft.y, topLeft.z);
+
+            // Top-left corner for texture and quad
+            rlTexCoord2f((float)source.x/texture.width, (float)(source.y + source.height)/texture.height);
+            rlVertex3f(bottomLeft.x, bottomLeft.y, bottomLeft.z);
+
+            // Top-right corner for texture and quad
+            rlTexCoord2f((float)(source.x + source.width)/texture.width, (float)(source.y + source.height)/texture.height);
+            rlVertex3f(bottomRight.x, bottomRight.y, bottomRight.z);
+
+            // Bottom-right corner for texture and quad
+            rlTexCoord2f((float)(source.x + source.width)/texture.width, (float)source.y/texture.height);
+            rlVertex3f(topRight.x, topRight.y, topRight.z);
+        }
+        else
+        {
+            // Reverse vertex order if the size has only one negative dimension
+            rlTexCoord2f((float)(source.x + source.width)/texture.width, (float)source.y/texture.height);
+            rlVertex3f(topRight.x, topRight.y, topRight.z);
+
+            rlTexCoord2f((float)(source.x + source.width)/texture.width, (float)(source.y + source.height)/texture.height);
+            rlVertex3f(bottomRight.x, bottomRight.y, bottomRight.z);
+
+            rlTexCoord2f((float)source.x/texture.width, (float)(source.y + source.height)/texture.height);
+            rlVertex3f(bottomLeft.x, bottomLeft.y, bottomLeft.z);
+
+            rlTexCoord2f((float)source.x/texture.width, (float)source.y/texture.height);
+            rlVertex3f(topLeft.x, topLeft.y, topLeft.z);
+        }
+
+    rlEnd();
+
+    rlSetTexture(0);
+}
+
+// Draw a bounding box with wires
+void DrawBoundingBox(BoundingBox box, Color color)
+{
+    Vector3 size = { 0 };
+
+    size.x = fabsf(box.max.x - box.min.x);
+    size.y = fabsf(box.max.y - box.min.y);
+    size.z = fabsf(box.max.z - box.min.z);
+
+    Vector3 center = { box.min.x + size.x/2.0f, box.min.y + size.y/2.0f, box.min.z + size.z/2.0f };
+
+    DrawCubeWires(center, size.x, size.y, size.z, color);
+}
+
+// Check collision between two spheres
+bool CheckCollisionSpheres(Vector3 center1, float radius1, Vector3 center2, float radius2)
+{
+    bool collision = false;
+
+    // Simple way to check for collision, just checking distance between two points
+    // Unfortunately, sqrtf() is a costly operation, so we avoid it with following solution
+    /*
+    float dx = center1.x - center2.x;      // X distance between centers
+    float dy = center1.y - center2.y;      // Y distance between centers
+    float dz = center1.z - center2.z;      // Z distance between centers
+
+    float distance = sqrtf(dx*dx + dy*dy + dz*dz);  // Distance between centers
+
+    if (distance <= (radius1 + radius2)) collision = true;
+    */
+
+    // Check for distances squared to avoid sqrtf()
+    if (Vector3DotProduct(Vector3Subtract(center2, center1), Vector3Subtract(center2, center1)) <= (radius1 + radius2)*(radius1 + radius2)) collision = true;
+
+    return collision;
+}
+
+// Check collision between two boxes
+// NOTE: Boxes are defined by two points minimum and maximum
+bool CheckCollisionBoxes(BoundingBox box1, BoundingBox box2)
+{
+    bool collision = true;
+
+    if ((box1.max.x >= box2.min.x) && (box1.min.x <= box2.max.x))
+    {
+        if ((box1.max.y < box2.min.y) || (box1.min.y > box2.max.y)) collision = false;
+        if ((box1.max.z < box2.min.z) || (box1.min.z > box2.max.z)) collision = false;
+    }
+    else collision = false;
+
+    return collision;
+}
+
+// Check collision between box and sphere
+bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius)
+{
+    bool collision = false;
+
+    float dmin = 0;
+
+    if (center.x < box.min.x) dmin += powf(center.x - box.min.x, 2);
+    else if (center.x > box.max.x) dmin += powf(center.x - box.max.x, 2);
+
+    if (center.y < box.min.y) dmin += powf(center.y - box.min.y, 2);
+    else if (center.y > box.max.y) dmin += powf(center.y - box.max.y, 2);
+
+    if (center.z < box.min.z) dmin += powf(center.z - box.min.z, 2);
+    else if (center.z > box.max.z) dmin += powf(center.z - box.max.z, 2);
+
+    if (dmin <= (radius*radius)) collision = true;
+
+    return collision;
+}
+
+// Get collision info between ray and sphere
+RayCollision GetRayCollisionSphere(Ray ray, Vector3 center, float radius)
+{
+    RayCollision collision = { 0 };
+
+    Vector3 raySpherePos = Vector3Subtract(center, ray.position);
+    float vector = Vector3DotProduct(raySpherePos, ray.direction);
+    float distance = Vector3Length(raySpherePos);
+    float d = radius*radius - (distance*distance - vector*vector);
+
+    collision.hit = d >= 0.0f;
+
+    // Check if ray origin is inside the sphere to calculate the correct collision point
+    if (distance < radius)
+    {
+        collision.distance = vector + sqrtf(d);
+
+        // Calculate collision point
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+
+        // Calculate collision normal (pointing outwards)
+        collision.normal = Vector3Negate(Vector3Normalize(Vector3Subtract(collision.point, center)));
+    }
+    else
+    {
+        collision.distance = vector - sqrtf(d);
+
+        // Calculate collision point
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+
+        // Calculate collision normal (pointing inwards)
+        collision.normal = Vector3Normalize(Vector3Subtract(collision.point, center));
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and box
+RayCollision GetRayCollisionBox(Ray ray, BoundingBox box)
+{
+    RayCollision collision = { 0 };
+
+    // Note: If ray.position is inside the box, the distance is negative (as if the ray was reversed)
+    // Reversing ray.direction will give use the correct result.
+    bool insideBox = (ray.position.x > box.min.x) && (ray.position.x < box.max.x) &&
+                     (ray.position.y > box.min.y) && (ray.position.y < box.max.y) &&
+                     (ray.position.z > box.min.z) && (ray.position.z < box.max.z);
+
+    if (insideBox) ray.direction = Vector3Negate(ray.direction);
+
+    float t[11] = { 0 };
+
+    t[8] = 1.0f/ray.direction.x;
+    t[9] = 1.0f/ray.direction.y;
+    t[10] = 1.0f/ray.direction.z;
+
+    t[0] = (box.min.x - ray.position.x)*t[8];
+    t[1] = (box.max.x - ray.position.x)*t[8];
+    t[2] = (box.min.y - ray.position.y)*t[9];
+    t[3] = (box.max.y - ray.position.y)*t[9];
+    t[4] = (box.min.z - ray.position.z)*t[10];
+    t[5] = (box.max.z - ray.position.z)*t[10];
+    t[6] = (float)fmax(fmax(fmin(t[0], t[1]), fmin(t[2], t[3])), fmin(t[4], t[5]));
+    t[7] = (float)fmin(fmin(fmax(t[0], t[1]), fmax(t[2], t[3])), fmax(t[4], t[5]));
+
+    collision.hit = !((t[7] < 0) || (t[6] > t[7]));
+    collision.distance = t[6];
+    collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+
+    // Get box center point
+    collision.normal = Vector3Lerp(box.min, box.max, 0.5f);
+    // Get vector center point->hit point
+    collision.normal = Vector3Subtract(collision.point, collision.normal);
+    // Scale vector to unit cube
+    // NOTE: We use an additional .01 to fix numerical errors
+    collision.normal = Vector3Scale(collision.normal, 2.01f);
+    collision.normal = Vector3Divide(collision.normal, Vector3Subtract(box.max, box.min));
+    // The relevant elements of the vector are now slightly larger than 1.0f (or smaller than -1.0f)
+    // and the others are somewhere between -1.0 and 1.0 casting to int is exactly our wanted normal!
+    collision.normal.x = (float)((int)collision.normal.x);
+    collision.normal.y = (float)((int)collision.normal.y);
+    collision.normal.z = (float)((int)collision.normal.z);
+
+    collision.normal = Vector3Normalize(collision.normal);
+
+    if (insideBox)
+    {
+        // Reset ray.direction
+        ray.direction = Vector3Negate(ray.direction);
+        // Fix result
+        collision.distance *= -1.0f;
+        collision.normal = Vector3Negate(collision.normal);
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and mesh
+// NOTE: If mesh bounding volume hierarchy is available (GenMeshBvh()), ray is transformed into mesh space
+// and only triangles in hierarchy nodes crossed by the ray are tested
+RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
+{
+    RayCollision collision = { 0 };
+
+    // Check if mesh bounding volume hierarchy available and transform can be inverted
+    if ((mesh.bvh != NULL) && (MatrixDeterminant(transform) != 0.0f))
+    {
+        // Transform ray into mesh space, direction is not normalized to keep ray distance
+        Matrix invTransform = MatrixInvert(transform);
+        Ray meshRay = { 0 };
+        meshRay.position = Vector3Transform(ray.position, invTransform);
+        meshRay.direction.x = invTransform.m0*ray.direction.x + invTransform.m4*ray.direction.y + invTransform.m8*ray.direction.z;
+        meshRay.direction.y = invTransform.m1*ray.direction.x + invTransform.m5*ray.direction.y + invTransform.m9*ray.direction.z;
+        meshRay.direction.z = invTransform.m2*ray.direction.x + invTransform.m6*ray.direction.y + invTransform.m10*ray.direction.z;
+
+        int triangle = -1;
+        float distance = GetRayCollisionMeshBvh(meshRay, mesh.bvh, &triangle);
+
+        if (triangle >= 0)
+        {
+            // Hit normal is computed from the transformed triangle, hit point from the provided ray
+            Vector3 a = Vector3Transform(mesh.bvh->triangles[triangle*3], transform);
+            Vector3 b = Vector3Transform(mesh.bvh->triangles[triangle*3 + 1], transform);
+            Vector3 c = Vector3Transform(mesh.bvh->triangles[triangle*3 + 2], transform);
+
+            collision.hit = true;
+            collision.distance = distance;
+            collision.normal = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(b, a), Vector3Subtract(c, a)));
+            collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, distance));
+        }
+    }
+    else if (mesh.vertices != NULL)     // Check if mesh vertex data on CPU for testing
+    {
+        int triangleCount = mesh.triangleCount;
+
+        // Mesh vertices are transformed once, shared vertices are not transformed by every triangle
+        Vector3 *vertdata = (Vector3 *)RL_MALLOC(mesh.vertexCount*sizeof(Vector3));
+        Vector3TransformArray(vertdata, (Vector3 *)mesh.vertices, mesh.vertexCount, transform);
+
+        // Test against all triangles in mesh
+        for (int i = 0; i < triangleCount; i++)
+        {
+            Vector3 a, b, c;
+
+            if (mesh.indices)
+            {
+                a = vertdata[mesh.indices[i*3 + 0]];
+                b = vertdata[mesh.indices[i*3 + 1]];
+                c = vertdata[mesh.indices[i*3 + 2]];
+            }
+            else
+            {
+                a = vertdata[i*3 + 0];
+                b = vertdata[i*3 + 1];
+                c = vertdata[i*3 + 2];
+            }
+
+            RayCollision triHitInfo = GetRayCollisionTriangle(ray, a, b, c);
+
+            if (triHitInfo.hit)
+            {
+                // Save the closest hit triangle
+                if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
+            }
+        }
+
+        RL_FREE(vertdata);
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and triangle
+// NOTE: The points are expected to be in counter-clockwise winding
+// NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
+RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3)
+{
+    #define EPSILON 0.000001f        // A small number
+
+    RayCollision collision = { 0 };
+    Vector3 edge1 = { 0 };
+    Vector3 edge2 = { 0 };
+    Vector3 p, q, tv;
+    float det, invDet, u, v, t;
+
+    // Find vectors for two edges sharing V1
+    edge1 = Vector3Subtract(p2, p1);
+    edge2 = Vector3Subtract(p3, p1);
+
+    // Begin calculating determinant - also used to calculate u parameter
+    p = Vector3CrossProduct(ray.direction, edge2);
+
+    // If determinant is near zero, ray lies in plane of triangle or ray is parallel to plane of triangle
+    det = Vector3DotProduct(edge1, p);
+
+    // Avoid culling!
+    if ((det > -EPSILON) && (det < EPSILON)) return collision;
+
+    invDet = 1.0f/det;
+
+    // Calculate distance from V1 to ray origin
+    tv = Vector3Subtract(ray.position, p1);
+
+    // Calculate u parameter and test bound
+    u = Vector3DotProduct(tv, p)*invDet;
+
+    // The intersection lies outside the triangle
+    if ((u < 0.0f) || (u > 1.0f)) return collision;
+
+    // Prepare to test v parameter
+    q = Vector3CrossProduct(tv, edge1);
+
+    // Calculate V parameter and test bound
+    v = Vector3DotProduct(ray.direction, q)*invDet;
+
+    // The intersection lies outside the triangle
+    if ((v < 0.0f) || ((u + v) > 1.0f)) return collision;
+
+    t = Vector3DotProduct(edge2, q)*invDet;
+
+    if (t > EPSILON)
+    {
+        // Ray hit, get hit point and normal
+        collision.hit = true;
+        collision.distance = t;
+        collision.normal = Vector3Normalize(Vector3CrossProduct(edge1, edge2));
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, t));
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and quad
+// NOTE: The points are expected to be in counter-clockwise winding
+RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4)
+{
+    RayCollision collision = { 0 };
+
+    collision = GetRayCollisionTriangle(ray, p1, p2, p4);
+
+    if (!collision.hit) collision = GetRayCollisionTriangle(ray, p2, p3, p4);
+
+    return collision;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_GPU_SKINNING)
+// Check if model mesh can be skinned on GPU
+// NOTE: Mesh requires bone vertex buffers and model bones must fit in shader bone matrices array,
+// material shader must be default shader (replaced by skinning shader on drawing) or provide skinning locations
+static bool IsMeshSkinnable(Model model, int meshIndex)
+{
+    Mesh mesh = model.meshes[meshIndex];
+
+    if ((mesh.vboId == NULL) || (mesh.vboId[7] == 0) || (mesh.vboId[8] == 0)) return false;
+    if ((model.boneCount <= 0) || (model.boneCount > RL_MAX_SHADER_BONES)) return false;
+
+    Shader shader = { 0 };
+    if ((model.materials != NULL) && (model.meshMaterial != NULL)) shader = model.materials[model.meshMaterial[meshIndex]].shader;
+
+    // NOTE: Skinning shader bone matrices array is limited by vertex uniforms available
+    if (shader.id == rlGetShaderIdDefault()) return (model.boneCount <= rlGetShaderBonesSkinning());
+
+    return ((shader.locs != NULL) &&
+            (shader.locs[SHADER_LOC_BONE_MATRICES] != -1) &&
+            (shader.locs[SHADER_LOC_VERTEX_BONEIDS] != -1));
+}
+
+// Update mesh bone matrices for a given animation frame
+// NOTE: Bone matrix replicates CPU skinning transformation: (vertex - bindTranslation)*scale, rotated by
+// (rotation*inverse(bindRotation)), plus translation
+static void UpdateMeshBones(Mesh *mesh, Model model, ModelAnimation anim, int frame)
+{
+    if (mesh->boneMatrices == NULL) mesh->boneMatrices = (Matrix *)RL_CALLOC(RL_MAX_SHADER_BONES, sizeof(Matrix));
+
+    // Mesh previously skinned on CPU (or never animated), GPU buffers must contain bind pose data
+    if ((mesh->boneCount == 0) && (mesh->animVertices != NULL))
+    {
+        rlUpdateVertexBuffer(mesh->vboId[0], mesh->vertices, mesh->vertexCount*3*sizeof(float), 0);
+        if ((mesh->normals != NULL) && (mesh->vboId[2] != 0)) rlUpdateVertexBuffer(mesh->vboId[2], mesh->normals, mesh->vertexCount*3*sizeof(float), 0);
+    }
+
+    mesh->boneCount = model.boneCount;
+
+    for (int i = 0; i < model.boneCount; i++)
+    {
+        mesh->boneMatrices[i] = GetBoneMatrix(model.bindPose[i], anim.framePoses[frame][i]);
+    }
+}
+#endif
+
+// Get bone transformation matrix from bind pose to frame pose
+// NOTE: Vertex is transformed as: (vertex - bindTranslation)*scale, rotated by (rotation*inverse(bindRotation)), plus translation
+static Matrix GetBoneMatrix(Transform bindPose, Transform framePose)
+{
+    Matrix matBone = MatrixTranslate(-bindPose.translation.x, -bindPose.translation.y, -bindPose.translation.z);
+    matBone = MatrixMultiply(matBone, MatrixScale(framePose.scale.x, framePose.scale.y, framePose.scale.z));
+    matBone = MatrixMultiply(matBone, QuaternionToMatrix(QuaternionMultiply(framePose.rotation, QuaternionInvert(bindPose.rotation))));
+    matBone = MatrixMultiply(matBone, MatrixTranslate(framePose.translation.x, framePose.translation.y, framePose.translation.z));
+
+    return matBone;
+}
+
+// Get mesh bounding box, computed once by mesh
+// NOTE: Meshes are identified by vertex data pointer and count, bounding box is not updated if vertex data changes
+static BoundingBox GetMeshBoundingBoxCached(Mesh mesh)
+{
+    unsigned int set = (unsigned int)(((size_t)mesh.vertices >> 4)*2654435761u)%MESH_BOUNDS_CACHE_SETS;
+    MeshBoundsEntry *entries = meshBoundsCache[set];
+
+    for (int i = 0; i < 4; i++)
+    {
+        if ((entries[i].vertices == mesh.vertices) && (entries[i].vertexCount == mesh.vertexCount)) return entries[i].bounds;
+    }
+
+    // Not found, oldest entry of set is replaced (entries are moved to keep most recent first)
+    for (int i = 3; i > 0; i--) entries[i] = entries[i - 1];
+
+    entries[0].vertices = mesh.vertices;
+    entries[0].vertexCount = mesh.vertexCount;
+    entries[0].bounds = GetMeshBoundingBox(mesh);
+
+    return entries[0].bounds;
+}
+
+// Remove mesh bounding box from cache
+static void UnloadMeshBoundingBoxCached(Mesh mesh)
+{
+    if (mesh.vertices == NULL) return;
+
+    unsigned int set = (unsigned int)(((size_t)mesh.vertices >> 4)*2654435761u)%MESH_BOUNDS_CACHE_SETS;
+
+    for (int i = 0; i < 4; i++)
+    {
+        if (meshBoundsCache[set][i].vertices == mesh.vertices) meshBoundsCache[set][i] = (MeshBoundsEntry){ 0 };
+    }
+}
+
+// Check if mesh bounding box is inside mesh queue frustum
+// NOTE: Meshes without vertex data on CPU are considered visible
+static bool IsMeshVisible(Mesh mesh, Matrix transform)
+{
+    if ((mesh.vertices == NULL) || (mesh.vertexCount <= 0)) return true;
+
+    BoundingBox bounds = GetMeshBoundingBoxCached(mesh);
+
+    // Transform bounding box center and extents to world space, getting the enclosing axis-aligned box
+    Vector3 center = Vector3Transform(Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f), transform);
+    Vector3 extent = Vector3Scale(Vector3Subtract(bounds.max, bounds.min), 0.5f);
+    Vector3 worldExtent = {
+        fabsf(transform.m0)*extent.x + fabsf(transform.m4)*extent.y + fabsf(transform.m8)*extent.z,
+        fabsf(transform.m1)*extent.x + fabsf(transform.m5)*extent.y + fabsf(transform.m9)*extent.z,
+        fabsf(transform.m2)*extent.x + fabsf(transform.m6)*extent.y + fabsf(transform.m10)*extent.z
+    };
+
+    return IsBoxInFrustum(center, worldExtent, meshQueue.frustum);
+}
+
+// Get frustum planes from (view-)projection matrix (Gribb-Hartmann method)
+// NOTE: Planes are defined as (normal, distance), points inside frustum give positive values,
+// planes are defined in the space transformed by the matrix (i.e. world space for view-projection)
+static void GetFrustumPlanes(Matrix matrix, Vector4 *planes)
+{
+    Vector4 row[4] = {
+        { matrix.m0, matrix.m4, matrix.m8, matrix.m12 },
+        { matrix.m1, matrix.m5, matrix.m9, matrix.m13 },
+        { matrix.m2, matrix.m6, matrix.m10, matrix.m14 },
+        { matrix.m3, matrix.m7, matrix.m11, matrix.m15 }
+    };
+
+    for (int i = 0; i < 3; i++)
+    {
+        planes[i*2] = (Vector4){ row[3].x + row[i].x, row[3].y + row[i].y, row[3].z + row[i].z, row[3].w + row[i].w };
+        planes[i*2 + 1] = (Vector4){ row[3].x - row[i].x, row[3].y - row[i].y, row[3].z - row[i].z, row[3].w - row[i].w };
+    }
+}
+
+// Check if box (center and half extents) is inside frustum planes
+static bool IsBoxInFrustum(Vector3 center, Vector3 extent, const Vector4 *planes)
+{
+    for (int i = 0; i < 6; i++)
+    {
+        Vector4 plane = planes[i];
+
+        // Box is outside if its farthest point along plane normal is outside
+        float distance = plane.x*center.x + plane.y*center.y + plane.z*center.z + plane.w;
+        float radius = fabsf(plane.x)*extent.x + fabsf(plane.y)*extent.y + fabsf(plane.z)*extent.z;
+
+        if ((distance + radius) < 0.0f) return false;
+    }
+
+    return true;
+}
+
+// Generate terrain chunk mesh for one level of detail
+// NOTE: Chunk grid vertices sample heightmap every step pixels (clamped to heightmap limits),
+// grid border is extended with a skirt (skirtDepth down) to hide cracks with neighbour chunks levels of detail
+static Mesh GenTerrainChunkMesh(const float *heights, const Vector3 *normals, int mapX, int mapZ, Vector3 scale, int startX, int startZ, int chunkSize, int step, float skirtDepth)
+{
+    Mesh mesh = { 0 };
+
+    int n = chunkSize/step + 1;         // Grid vertices by side
+    int ringCount = 4*(n - 1);          // Grid border vertices
+
+    mesh.vertexCount = n*n + ringCount;
+    mesh.triangleCount = (n - 1)*(n - 1)*2 + ringCount*2;
+
+    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.indices = (unsigned short *)RL_MALLOC(mesh.triangleCount*3*sizeof(unsigned short));
+
+    // Grid vertices
+    for (int j = 0; j < n; j++)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            int x = (startX + i*step < mapX - 1)? startX + i*step : mapX - 1;
+            int z = (startZ + j*step < mapZ - 1)? startZ + j*step : mapZ - 1;
+            int v = j*n + i;
+
+            mesh.vertices[v*3] = (float)x*scale.x;
+            mesh.vertices[v*3 + 1] = heights[z*mapX + x];
+            mesh.vertices[v*3 + 2] = (float)z*scale.z;
+
+            mesh.texcoords[v*2] = (float)x/(mapX - 1);
+            mesh.texcoords[v*2 + 1] = (float)z/(mapZ - 1);
+
+            mesh.normals[v*3] = normals[z*mapX + x].x;
+            mesh.normals[v*3 + 1] = normals[z*mapX + x].y;
+            mesh.normals[v*3 + 2] = normals[z*mapX + x].z;
+        }
+    }
+
+    int index = 0;
+
+    // Grid triangles, same winding as GenMeshHeightmap()
+    for (int j = 0; j < n - 1; j++)
+    {
+        for (int i = 0; i < n - 1; i++)
+        {
+            unsigned short a = (unsigned short)(j*n + i);
+            unsigned short b = (unsigned short)((j + 1)*n + i);
+            unsigned short c = (unsigned short)(j*n + i + 1);
+            unsigned short d = (unsigned short)((j + 1)*n + i + 1);
+
+            mesh.indices[index++] = a;
+            mesh.indices[index++] = b;
+            mesh.indices[index++] = c;
+
+            mesh.indices[index++] = c;
+            mesh.indices[index++] = b;
+            mesh.indices[index++] = d;
+        }
+    }
+
+    // Skirt vertices, grid border traversed with terrain outside on its left (seen from above),
+    // skirt triangles face outside the chunk
+    for (int k = 0; k < ringCount; k++)
+    {
+        int side = k/(n - 1);
+        int offset = k%(n - 1);
+        int ring = 0;
+
+        if (side == 0) ring = offset;                                   // Side z min, x increasing
+        else if (side == 1) ring = offset*n + (n - 1);                  // Side x max, z increasing
+        else if (side == 2) ring = (n - 1)*n + (n - 1 - offset);        // Side z max, x decreasing
+        else ring = (n - 1 - offset)*n;                                 // Side x min, z decreasing
+
+        int v = n*n + k;
+
+        memcpy(mesh.vertices + v*3, mesh.vertices + ring*3, 3*sizeof(float));
+        memcpy(mesh.texcoords + v*2, mesh.texcoords + ring*2, 2*sizeof(float));
+        memcpy(mesh.normals + v*3, mesh.normals + ring*3, 3*sizeof(float));
+        mesh.vertices[v*3 + 1] -= skirtDepth;
+
+        int nextK = (k + 1)%ringCount;
+        int nextSide = nextK/(n - 1);
+        int nextOffset = nextK%(n - 1);
+        int nextRing = 0;
+
+        if (nextSide == 0) nextRing = nextOffset;
+        else if (nextSide == 1) nextRing = nextOffset*n + (n - 1);
+        else if (nextSide == 2) nextRing = (n - 1)*n + (n - 1 - nextOffset);
+        else nextRing = (n - 1 - nextOffset)*n;
+
+        mesh.indices[index++] = (unsigned short)ring;
+        mesh.indices[index++] = (unsigned short)nextRing;
+        mesh.indices[index++] = (unsigned short)v;
+
+        mesh.indices[index++] = (unsigned short)nextRing;
+        mesh.indices[index++] = (unsigned short)(n*n + nextK);
+        mesh.indices[index++] = (unsigned short)v;
+    }
+
+    return mesh;
+}
+
+// Compare mesh queue keys, for qsort()
+static int CompareMeshQueueKeys(const void *a, const void *b)
+{
+    const MeshQueueKey *keyA = (const MeshQueueKey *)a;
+    const MeshQueueKey *keyB = (const MeshQueueKey *)b;
+
+    if (keyA->shader != keyB->shader) return (keyA->shader < keyB->shader)? -1 : 1;
+    if (keyA->texture != keyB->texture) return (keyA->texture < keyB->texture)? -1 : 1;
+    if (keyA->mesh != keyB->mesh) return (keyA->mesh < keyB->mesh)? -1 : 1;
+    if (keyA->maps != keyB->maps) return (keyA->maps < keyB->maps)? -1 : 1;
+    if (keyA->color != keyB->color) return (keyA->color < keyB->color)? -1 : 1;
+    if (keyA->wires != keyB->wires) return keyA->wires? 1 : -1;
+
+    return keyA->index - keyB->index;
+}
+
+// Check if queued mesh can be drawn instanced
+// NOTE: Only meshes using default shader are instanced (with default instancing shader),
+// custom shaders can not be assumed to provide the instance transform attribute
+static bool IsMeshQueueEntryInstanceable(const MeshQueueEntry *entry)
+{
+    if ((entry->mesh.vaoId == 0) || (entry->mesh.boneMatrices != NULL)) return false;
+    if (entry->material.shader.id != rlGetShaderIdDefault()) return false;
+
+    return (rlGetShaderIdInstancing() > 0);
+}
+
+// Get mesh vertex data streams and vertex size by stream
+// NOTE: Streams order must match SetMeshStreams()
+static void GetMeshStreams(Mesh mesh, void **streams, int *streamSizes)
+{
+    void *meshStreams[MESH_STREAM_COUNT] = { mesh.vertices, mesh.texcoords, mesh.texcoords2, mesh.normals, mesh.tangents,
+                                             mesh.colors, mesh.animVertices, mesh.animNormals, mesh.boneIds, mesh.boneWeights };
+    const int meshStreamSizes[MESH_STREAM_COUNT] = { 3*sizeof(float), 2*sizeof(float), 2*sizeof(float), 3*sizeof(float), 4*sizeof(float),
+                                                     4*sizeof(unsigned char), 3*sizeof(float), 3*sizeof(float), 4*sizeof(unsigned char), 4*sizeof(float) };
+
+    for (int k = 0; k < MESH_STREAM_COUNT; k++)
+    {
+        streams[k] = meshStreams[k];
+        streamSizes[k] = meshStreamSizes[k];
+    }
+}
+
+// Set mesh vertex data streams
+static void SetMeshStreams(Mesh *mesh, void **streams)
+{
+    mesh->vertices = (float *)streams[0];
+    mesh->texcoords = (float *)streams[1];
+    mesh->texcoords2 = (float *)streams[2];
+    mesh->normals = (float *)streams[3];
+    mesh->tangents = (float *)streams[4];
+    mesh->colors = (unsigned char *)streams[5];
+    mesh->animVertices = (float *)streams[6];
+    mesh->animNormals = (float *)streams[7];
+    mesh->boneIds = (unsigned char *)streams[8];
+    mesh->boneWeights = (float *)streams[9];
+}
+
+#if defined(SUPPORT_TRACELOG_DEBUG)
+// Get mesh average cache miss ratio (ACMR), vertex shader invocations by triangle
+// NOTE: A FIFO post-transform cache of MESH_VERTEX_CACHE_SIZE entries is simulated, lower is better (0.5 is ideal)
+static float GetMeshACMR(const unsigned int *indices, int indexCount, int vertexCount)
+{
+    if (indexCount < 3) return 0.0f;
+
+    unsigned int *cacheTime = (unsigned int *)RL_CALLOC(vertexCount, sizeof(unsigned int));
+    unsigned int time = MESH_VERTEX_CACHE_SIZE + 1;
+    int missCount = 0;
+
+    for (int i = 0; i < indexCount; i++)
+    {
+        // Vertex in cache if inserted in the last MESH_VERTEX_CACHE_SIZE misses
+        if ((time - cacheTime[indices[i]]) > MESH_VERTEX_CACHE_SIZE)
+        {
+            cacheTime[indices[i]] = time++;
+            missCount++;
+        }
+    }
+
+    RL_FREE(cacheTime);
+
+    return (float)missCount/(indexCount/3);
+}
+#endif
+
+// Reorder triangles for post-transform vertex cache (Tom Forsyth linear-speed vertex cache optimization)
+// NOTE: Triangles are added one by one, best scored triangle is selected from triangles using vertices in a simulated
+// LRU cache, vertex score favors recently used vertices and vertices with few remaining triangles
+static void OptimizeMeshVertexCache(unsigned int *indices, int indexCount, int vertexCount)
+{
+    #define CACHE_SCORE_SIZE (MESH_VERTEX_CACHE_SIZE + 3)
+
+    int triangleCount = indexCount/3;
+
+    // Vertex score tables by cache position and by remaining triangles (valence)
+    float cacheScores[CACHE_SCORE_SIZE] = { 0 };
+    for (int i = 0; i < CACHE_SCORE_SIZE; i++)
+    {
+        if (i < 3) cacheScores[i] = 0.75f;      // Vertices used by last triangle get a fixed score (not to be reused immediately)
+        else if (i < MESH_VERTEX_CACHE_SIZE) cacheScores[i] = powf(1.0f - (float)(i - 3)/(MESH_VERTEX_CACHE_SIZE - 3), 1.5f);
+    }
+
+    float valenceScores[32] = { 0 };
+    for (int i = 1; i < 32; i++) valenceScores[i] = 2.0f/sqrtf((float)i);
+
+    // Vertex triangles adjacency
+    int *triangleOffsets = (int *)RL_CALLOC(vertexCount + 1, sizeof(int));
+    int *remaining = (int *)RL_CALLOC(vertexCount, sizeof(int));
+    for (int i = 0; i < indexCount; i++) remaining[indices[i]]++;
+    for (int v = 0; v < vertexCount; v++) triangleOffsets[v + 1] = triangleOffsets[v] + remaining[v];
+
+    int *adjacency = (int *)RL_MALLOC(indexCount*sizeof(int));
+    int *fill = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    memcpy(fill, triangleOffsets, vertexCount*sizeof(int));
+    for (int i = 0; i < indexCount; i++) adjacency[fill[indices[i]]++] = i/3;
+    RL_FREE(fill);
+
+    int *cachePosition = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    float *vertexScores = (float *)RL_MALLOC(vertexCount*sizeof(float));
+    for (int v = 0; v < vertexCount; v++)
+    {
+        cachePosition[v] = -1;
+        vertexScores[v] = (remaining[v] > 0)? valenceScores[(remaining[v] < 32)? remaining[v] : 31] : 0.0f;
+    }
+
+    float *triangleScores = (float *)RL_MALLOC(triangleCount*sizeof(float));
+    bool *triangleAdded = (bool *)RL_CALLOC(triangleCount, sizeof(bool));
+    for (int t = 0; t < triangleCount; t++) triangleScores[t] = vertexScores[indices[t*3]] + vertexScores[indices[t*3 + 1]] + vertexScores[indices[t*3 + 2]];
+
+    unsigned int *output = (unsigned int *)RL_MALLOC(indexCount*sizeof(unsigned int));
+    unsigned int cache[CACHE_SCORE_SIZE] = { 0 };
+    int cacheCount = 0;
+    int nextTriangle = 0;       // Next triangle checked if cache provides no candidate
+
+    for (int added = 0; added < triangleCount; added++)
+    {
+        // Select best triangle using cached vertices
+        int best = -1;
+        float bestScore = -1.0f;
+
+        for (int c = 0; c < cacheCount; c++)
+        {
+            unsigned int v = cache[c];
+            for (int a = triangleOffsets[v]; a < triangleOffsets[v] + remaining[v]; a++)
+            {
+                int t = adjacency[a];
+                if (triangleScores[t] > bestScore)
+                {
+                    best = t;
+                    bestScore = triangleScores[t];
+                }
+            }
+        }
+
+        if (best == -1)
+        {
+            while (triangleAdded[nextTriangle]) nextTriangle++;
+            best = nextTriangle;
+        }
+
+        triangleAdded[best] = true;
+
+        // Add triangle to output and update cache (LRU), triangle vertices moved to front
+        unsigned int newCache[CACHE_SCORE_SIZE] = { 0 };
+        int newCacheCount = 0;
+
+        for (int k = 0; k < 3; k++)
+        {
+            unsigned int v = indices[best*3 + k];
+            output[added*3 + k] = v;
+            newCache[newCacheCount++] = v;
+
+            // Remove triangle from vertex active triangles
+            for (int a = triangleOffsets[v]; a < triangleOffsets[v] + remaining[v]; a++)
+            {
+                if (adjacency[a] == best)
+                {
+                    adjacency[a] = adjacency[triangleOffsets[v] + remaining[v] - 1];
+                    remaining[v]--;
+                    break;
+                }
+            }
+        }
+
+        for (int c = 0; c < cacheCount; c++)
+        {
+            unsigned int v = cache[c];
+            if ((v != newCache[0]) && (v != newCache[1]) && (v != newCache[2])) newCache[newCacheCount++] = v;
+        }
+
+        // Update scores of vertices in cache (and vertices just evicted), then triangles using them
+        for (int c = 0; c < newCacheCount; c++)
+        {
+            unsigned int v = newCache[c];
+            cachePosition[v] = (c < MESH_VERTEX_CACHE_SIZE)? c : -1;
+
+            float score = 0.0f;
+            if (remaining[v] > 0)
+            {
+                if (cachePosition[v] >= 0) score += cacheScores[cachePosition[v]];
+                score += valenceScores[(remaining[v] < 32)? remaining[v] : 31];
+            }
+            vertexScores[v] = score;
+        }
+
+        for (int c = 0; c < newCacheCount; c++)
+        {
+            unsigned int v = newCache[c];
+            for (int a = triangleOffsets[v]; a < triangleOffsets[v] + remaining[v]; a++)
+            {
+                int t = adjacency[a];
+                triangleScores[t] = vertexScores[indices[t*3]] + vertexScores[indices[t*3 + 1]] + vertexScores[indices[t*3 + 2]];
+            }
+        }
+
+        cacheCount = (newCacheCount < MESH_VERTEX_CACHE_SIZE)? newCacheCount : MESH_VERTEX_CACHE_SIZE;
+        memcpy(cache, newCache, cacheCount*sizeof(unsigned int));
+    }
+
+    memcpy(indices, output, indexCount*sizeof(unsigned int));
+
+    RL_FREE(output);
+    RL_FREE(triangleAdded);
+    RL_FREE(triangleScores);
+    RL_FREE(vertexScores);
+    RL_FREE(cachePosition);
+    RL_FREE(adjacency);
+    RL_FREE(remaining);
+    RL_FREE(triangleOffsets);
+
+    #undef CACHE_SCORE_SIZE
+}
+
+// Reorder triangles clusters to reduce overdraw
+// NOTE: Triangles are split in clusters where vertex cache is completely missed (keeping cache efficiency),
+// clusters facing outwards from mesh center are drawn first, as they are more likely to occlude other clusters
+static void OptimizeMeshOverdraw(unsigned int *indices, int indexCount, const Vector3 *positions, int vertexCount)
+{
+    int triangleCount = indexCount/3;
+    if (triangleCount < 2) return;
+
+    // Split triangles in clusters, simulating a FIFO vertex cache
+    int *clusters = (int *)RL_MALLOC((triangleCount + 1)*sizeof(int));     // Cluster first triangle
+    int clusterCount = 0;
+
+    unsigned int *cacheTime = (unsigned int *)RL_CALLOC(vertexCount, sizeof(unsigned int));
+    unsigned int time = MESH_VERTEX_CACHE_SIZE + 1;
+
+    for (int t = 0; t < triangleCount; t++)
+    {
+        int misses = 0;
+        for (int k = 0; k < 3; k++)
+        {
+            unsigned int v = indices[t*3 + k];
+            if ((time - cacheTime[v]) > MESH_VERTEX_CACHE_SIZE)
+            {
+                cacheTime[v] = time++;
+                misses++;
+            }
+        }
+
+        if ((t == 0) || (misses == 3)) clusters[clusterCount++] = t;
+    }
+
+    clusters[clusterCount] = triangleCount;
+    RL_FREE(cacheTime);
+
+    if (clusterCount < 2)
+    {
+        RL_FREE(clusters);
+        return;
+    }
+
+    // Mesh center, area weighted triangles centroid
+    Vector3 meshCenter = { 0 };
+    float meshArea = 0.0f;
+
+    // Cluster sorting key: clusters normal (area weighted) projected on direction from mesh center
+    Vector3 *clusterCentroids = (Vector3 *)RL_MALLOC(clusterCount*sizeof(Vector3));
+    Vector3 *clusterNormals = (Vector3 *)RL_MALLOC(clusterCount*sizeof(Vector3));
+
+    for (int c = 0; c < clusterCount; c++)
+    {
+        Vector3 centroid = { 0 };
+        Vector3 normal = { 0 };
+        float area = 0.0f;
+
+        for (int t = clusters[c]; t < clusters[c + 1]; t++)
+        {
+            Vector3 p0 = positions[indices[t*3]];
+            Vector3 p1 = positions[indices[t*3 + 1]];
+            Vector3 p2 = positions[indices[t*3 + 2]];
+
+            Vector3 cross = Vector3CrossProduct(Vector3Subtract(p1, p0), Vector3Subtract(p2, p0));
+            float triangleArea = Vector3Length(cross);
+
+            centroid = Vector3Add(centroid, Vector3Scale(Vector3Add(Vector3Add(p0, p1), p2), triangleArea/3.0f));
+            normal = Vector3Add(normal, cross);
+            area += triangleArea;
+        }
+
+        meshCenter = Vector3Add(meshCenter, centroid);
+        meshArea += area;
+
+        clusterCentroids[c] = (area > 0.0f)? Vector3Scale(centroid, 1.0f/area) : positions[indices[clusters[c]*3]];
+        clusterNormals[c] = Vector3Normalize(normal);
+    }
+
+    if (meshArea > 0.0f) meshCenter = Vector3Scale(meshCenter, 1.0f/meshArea);
+
+    // NOTE: Clusters sorted by key (descending) with insertion order kept for equal keys
+    int *order = (int *)RL_MALLOC(clusterCount*sizeof(int));
+    float *sortKeys = (float *)RL_MALLOC(clusterCount*sizeof(float));
+
+    for (int c = 0; c < clusterCount; c++)
+    {
+        sortKeys[c] = Vector3DotProduct(Vector3Subtract(clusterCentroids[c], meshCenter), clusterNormals[c]);
+        order[c] = c;
+    }
+
+    // Insertion sort on clusters, clusters count is usually small compared to triangles
+    for (int i = 1; i < clusterCount; i++)
+    {
+        int index = order[i];
+        int j = i - 1;
+
+        while ((j >= 0) && (sortKeys[order[j]] < sortKeys[index]))
+        {
+            order[j + 1] = order[j];
+            j--;
+        }
+
+        order[j + 1] = index;
+    }
+
+    unsigned int *output = (unsigned int *)RL_MALLOC(indexCount*sizeof(unsigned int));
+    int outputCount = 0;
+
+    for (int i = 0; i < clusterCount; i++)
+    {
+        int c = order[i];
+        int count = (clusters[c + 1] - clusters[c])*3;
+        memcpy(output + outputCount, indices + clusters[c]*3, count*sizeof(unsigned int));
+        outputCount += count;
+    }
+
+    memcpy(indices, output, indexCount*sizeof(unsigned int));
+
+    RL_FREE(output);
+    RL_FREE(sortKeys);
+    RL_FREE(order);
+    RL_FREE(clusterNormals);
+    RL_FREE(clusterCentroids);
+    RL_FREE(clusters);
+}
+
+// Add quadrics
+static void AddMeshQuadric(MeshQuadric *q, const MeshQuadric *add)
+{
+    q->xx += add->xx; q->xy += add->xy; q->xz += add->xz; q->xw += add->xw;
+    q->yy += add->yy; q->yz += add->yz; q->yw += add->yw;
+    q->zz += add->zz; q->zw += add->zw;
+    q->ww += add->ww;
+}
+
+// Get quadric error at position: p^T*Q*p
+static float GetMeshQuadricError(const MeshQuadric *q, Vector3 p)
+{
+    double x = p.x, y = p.y, z = p.z;
+
+    double error = q->xx*x*x + 2.0*q->xy*x*y + 2.0*q->xz*x*z + 2.0*q->xw*x +
+                   q->yy*y*y + 2.0*q->yz*y*z + 2.0*q->yw*y +
+                   q->zz*z*z + 2.0*q->zw*z + q->ww;
+
+    return (error > 0.0)? (float)error : 0.0f;
+}
+
+// Compare mesh collapses by cost, for qsort()
+static int CompareMeshCollapses(const void *a, const void *b)
+{
+    const MeshCollapse *collapseA = (const MeshCollapse *)a;
+    const MeshCollapse *collapseB = (const MeshCollapse *)b;
+
+    if (collapseA->cost != collapseB->cost) return (collapseA->cost < collapseB->cost)? -1 : 1;
+    if (collapseA->from != collapseB->from) return (collapseA->from < collapseB->from)? -1 : 1;
+
+    return (collapseA->to < collapseB->to)? -1 : (collapseA->to > collapseB->to);
+}
+
+// Compare mesh edges (64bit keys), for qsort()
+static int CompareMeshEdges(const void *a, const void *b)
+{
+    unsigned long long edgeA = *(const unsigned long long *)a;
+    unsigned long long edgeB = *(const unsigned long long *)b;
+
+    return (edgeA < edgeB)? -1 : (edgeA > edgeB);
+}
+
+// Get model level of detail by projected bounding sphere size
+// NOTE: Level 0 (full detail) while model diameter is bigger than MODEL_LOD_SCREEN_SIZE of screen height,
+// next levels are selected every time projected diameter halves
+static int GetModelLod(Model model, Matrix transform)
+{
+    // Model bounding sphere (local space), from meshes cached bounding boxes
+    BoundingBox bounds = GetMeshBoundingBoxCached(model.meshes[0]);
+    for (int i = 1; i < model.meshCount; i++)
+    {
+        BoundingBox meshBounds = GetMeshBoundingBoxCached(model.meshes[i]);
+        bounds.min = Vector3Min(bounds.min, meshBounds.min);
+        bounds.max = Vector3Max(bounds.max, meshBounds.max);
+    }
 
-    float distance = sqrtf(dx*dx + dy*dy + dz*dz);  // Distance between centers
+    Vector3 center = Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f);
+    float radius = Vector3Distance(bounds.max, center);
 
-    if (distance <= (radius1 + radius2)) collision = true;
-    */
+    // Sphere radius scaled by biggest transform axis scale, center in view space
+    Matrix matModel = MatrixMultiply(transform, rlGetMatrixTransform());
+    float scaleX = Vector3Length((Vector3){ matModel.m0, matModel.m1, matModel.m2 });
+    float scaleY = Vector3Length((Vector3){ matModel.m4, matModel.m5, matModel.m6 });
+    float scaleZ = Vector3Length((Vector3){ matModel.m8, matModel.m9, matModel.m10 });
+    radius *= fmaxf(scaleX, fmaxf(scaleY, scaleZ));
 
-    // Check for distances squared to avoid sqrtf()
-    if (Vector3DotProduct(Vector3Subtract(center2, center1), Vector3Subtract(center2, center1)) <= (radius1 + radius2)*(radius1 + radius2)) collision = true;
+    Vector3 viewCenter = Vector3Transform(center, MatrixMultiply(matModel, rlGetMatrixModelview()));
+    Matrix matProjection = rlGetMatrixProjection();
 
-    return collision;
+    // Projected diameter (screen height ratio), perspective projection divides by distance
+    float size = 2.0f*radius*matProjection.m5*0.5f;
+    if (matProjection.m15 == 0.0f)
+    {
+        float distance = -viewCenter.z;
+        if (distance <= radius) return 0;
+        size /= distance;
+    }
+
+    if ((size <= 0.0f) || (radius <= 0.0f)) return 0;
+
+    int lod = 0;
+    for (float levelSize = MODEL_LOD_SCREEN_SIZE; (size < levelSize) && (lod < model.lodCount); levelSize *= 0.5f) lod++;
+
+    return lod;
 }
 
-// Check collision between two boxes
-// NOTE: Boxes are defined by two points minimum and maximum
-bool CheckCollisionBoxes(BoundingBox box1, BoundingBox box2)
+// Build mesh bounding volume hierarchy node, returns node index
+// NOTE: Node split is chosen by surface area heuristic, evaluated on centroid bins along every axis
+static int BuildMeshBvhNode(MeshBvhBuilder *builder, int first, int count, int depth)
 {
-    bool collision = true;
+    rMeshBvh *bvh = builder->bvh;
+    int nodeIndex = bvh->nodeCount++;
+    MeshBvhNode *node = &bvh->nodes[nodeIndex];
 
-    if ((box1.max.x >= box2.min.x) && (box1.min.x <= box2.max.x))
+    // Compute node bounds and triangles centroid bounds
+    BoundingBox bounds = builder->bounds[builder->order[first]];
+    BoundingBox centroidBounds = { builder->centroids[builder->order[first]], builder->centroids[builder->order[first]] };
+
+    for (int i = first + 1; i < first + count; i++)
     {
-        if ((box1.max.y < box2.min.y) || (box1.min.y > box2.max.y)) collision = false;
-        if ((box1.max.z < box2.min.z) || (box1.min.z > box2.max.z)) collision = false;
+        int triangle = builder->order[i];
+        bounds.min = Vector3Min(bounds.min, builder->bounds[triangle].min);
+        bounds.max = Vector3Max(bounds.max, builder->bounds[triangle].max);
+        centroidBounds.min = Vector3Min(centroidBounds.min, builder->centroids[triangle]);
+        centroidBounds.max = Vector3Max(centroidBounds.max, builder->centroids[triangle]);
     }
-    else collision = false;
 
-    return collision;
-}
+    node->min = bounds.min;
+    node->max = bounds.max;
+    node->index = first;
+    node->triangleCount = count;
 
-// Check collision between box and sphere
-bool CheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radius)
-{
-    bool collision = false;
+    if ((count <= 1) || (depth >= MESH_BVH_MAX_DEPTH)) return nodeIndex;
 
-    float dmin = 0;
+    // Find best split (axis and bin) by surface area heuristic
+    // NOTE: Cost is relative to node surface area: traversal (1) + triangles tests weighted by child surface area
+    #define BOX_HALF_AREA(b) ((b.max.x - b.min.x)*(b.max.y - b.min.y) + (b.max.y - b.min.y)*(b.max.z - b.min.z) + (b.max.z - b.min.z)*(b.max.x - b.min.x))
 
-    if (center.x < box.min.x) dmin += powf(center.x - box.min.x, 2);
-    else if (center.x > box.max.x) dmin += powf(center.x - box.max.x, 2);
+    float bestCost = (float)count;
+    int bestAxis = -1;
+    int bestBin = 0;
+    float nodeArea = BOX_HALF_AREA(bounds);
 
-    if (center.y < box.min.y) dmin += powf(center.y - box.min.y, 2);
-    else if (center.y > box.max.y) dmin += powf(center.y - box.max.y, 2);
+    for (int axis = 0; axis < 3; axis++)
+    {
+        float axisMin = ((float *)&centroidBounds.min)[axis];
+        float axisMax = ((float *)&centroidBounds.max)[axis];
+        if (axisMax <= axisMin) continue;
 
-    if (center.z < box.min.z) dmin += powf(center.z - box.min.z, 2);
-    else if (center.z > box.max.z) dmin += powf(center.z - box.max.z, 2);
+        BoundingBox binBounds[MESH_BVH_SAH_BINS] = { 0 };
+        int binCount[MESH_BVH_SAH_BINS] = { 0 };
+        float binScale = MESH_BVH_SAH_BINS/(axisMax - axisMin);
 
-    if (dmin <= (radius*radius)) collision = true;
+        for (int i = first; i < first + count; i++)
+        {
+            int triangle = builder->order[i];
+            int bin = (int)((((float *)&builder->centroids[triangle])[axis] - axisMin)*binScale);
+            if (bin >= MESH_BVH_SAH_BINS) bin = MESH_BVH_SAH_BINS - 1;
 
-    return collision;
-}
+            if (binCount[bin] == 0) binBounds[bin] = builder->bounds[triangle];
+            else
+            {
+                binBounds[bin].min = Vector3Min(binBounds[bin].min, builder->bounds[triangle].min);
+                binBounds[bin].max = Vector3Max(binBounds[bin].max, builder->bounds[triangle].max);
+            }
+            binCount[bin]++;
+        }
 
-// Get collision info between ray and sphere
-RayCollision GetRayCollisionSphere(Ray ray, Vector3 center, float radius)
-{
-    RayCollision collision = { 0 };
+        // Sweep bins from right to left to get right side area and count of every split plane
+        float rightArea[MESH_BVH_SAH_BINS] = { 0 };
+        int rightCount[MESH_BVH_SAH_BINS] = { 0 };
+        BoundingBox sweep = { 0 };
+        int sweepCount = 0;
 
-    Vector3 raySpherePos = Vector3Subtract(center, ray.position);
-    float vector = Vector3DotProduct(raySpherePos, ray.direction);
-    float distance = Vector3Length(raySpherePos);
-    float d = radius*radius - (distance*distance - vector*vector);
+        for (int bin = MESH_BVH_SAH_BINS - 1; bin > 0; bin--)
+        {
+            if (binCount[bin] > 0)
+            {
+                if (sweepCount == 0) sweep = binBounds[bin];
+                else
+                {
+                    sweep.min = Vector3Min(sweep.min, binBounds[bin].min);
+                    sweep.max = Vector3Max(sweep.max, binBounds[bin].max);
+                }
+                sweepCount += binCount[bin];
+            }
 
-    collision.hit = d >= 0.0f;
+            rightArea[bin] = (sweepCount > 0)? BOX_HALF_AREA(sweep) : 0.0f;
+            rightCount[bin] = sweepCount;
+        }
 
-    // Check if ray origin is inside the sphere to calculate the correct collision point
-    if (distance < radius)
-    {
-        collision.distance = vector + sqrtf(d);
+        // Sweep bins from left to right, split plane is placed before bin
+        sweepCount = 0;
 
-        // Calculate collision point
-        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+        for (int bin = 1; bin < MESH_BVH_SAH_BINS; bin++)
+        {
+            if (binCount[bin - 1] > 0)
+            {
+                if (sweepCount == 0) sweep = binBounds[bin - 1];
+                else
+                {
+                    sweep.min = Vector3Min(sweep.min, binBounds[bin - 1].min);
+                    sweep.max = Vector3Max(sweep.max, binBounds[bin - 1].max);
+                }
+                sweepCount += binCount[bin - 1];
+            }
 
-        // Calculate collision normal (pointing outwards)
-        collision.normal = Vector3Negate(Vector3Normalize(Vector3Subtract(collision.point, center)));
+            if ((sweepCount == 0) || (rightCount[bin] == 0)) continue;
+
+            float cost = 1.0f + (BOX_HALF_AREA(sweep)*sweepCount + rightArea[bin]*rightCount[bin])/nodeArea;
+
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestAxis = axis;
+                bestBin = bin;
+            }
+        }
     }
-    else
+
+    // Keep node as leaf if split is not cheaper than testing all triangles
+    if (bestAxis == -1)
     {
-        collision.distance = vector - sqrtf(d);
+        // Large leaf nodes are split by median when triangles are not separable (i.e. same centroid)
+        if (count <= MESH_BVH_LEAF_TRIANGLES) return nodeIndex;
+    }
+    else if ((count <= MESH_BVH_LEAF_TRIANGLES) && (bestCost >= (float)count)) return nodeIndex;
 
-        // Calculate collision point
-        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+    // Partition triangles order by split plane
+    int middle = first + count/2;
 
-        // Calculate collision normal (pointing inwards)
-        collision.normal = Vector3Normalize(Vector3Subtract(collision.point, center));
+    if (bestAxis != -1)
+    {
+        float axisMin = ((float *)&centroidBounds.min)[bestAxis];
+        float binScale = MESH_BVH_SAH_BINS/(((float *)&centroidBounds.max)[bestAxis] - axisMin);
+        int left = first;
+        int right = first + count - 1;
+
+        while (left <= right)
+        {
+            int bin = (int)((((float *)&builder->centroids[builder->order[left]])[bestAxis] - axisMin)*binScale);
+            if (bin >= MESH_BVH_SAH_BINS) bin = MESH_BVH_SAH_BINS - 1;
+
+            if (bin < bestBin) left++;
+            else
+            {
+                int temp = builder->order[left];
+                builder->order[left] = builder->order[right];
+                builder->order[right] = temp;
+                right--;
+            }
+        }
+
+        middle = left;
     }
 
-    return collision;
+    node->triangleCount = 0;
+    BuildMeshBvhNode(builder, first, middle - first, depth + 1);
+    int rightIndex = BuildMeshBvhNode(builder, middle, first + count - middle, depth + 1);
+
+    // NOTE: Node pointer could not be used after children build
+    bvh->nodes[nodeIndex].index = rightIndex;
+
+    return nodeIndex;
 }
 
-// Get collision info between ray and box
-RayCollision GetRayCollisionBox(Ray ray, BoundingBox box)
+// Get closest ray hit distance in mesh bounding volume hierarchy (-1 if no hit)
+// NOTE: Nodes are traversed closest child first, farther nodes are skipped once a closer hit is found
+static float GetRayCollisionMeshBvh(Ray ray, const rMeshBvh *bvh, int *triangle)
 {
-    RayCollision collision = { 0 };
+    #define EPSILON 0.000001f        // A small number
 
-    // Note: If ray.position is inside the box, the distance is negative (as if the ray was reversed)
-    // Reversing ray.direction will give use the correct result.
-    bool insideBox = (ray.position.x > box.min.x) && (ray.position.x < box.max.x) &&
-                     (ray.position.y > box.min.y) && (ray.position.y < box.max.y) &&
-                     (ray.position.z > box.min.z) && (ray.position.z < box.max.z);
+    float closest = -1.0f;
+    *triangle = -1;
 
-    if (insideBox) ray.direction = Vector3Negate(ray.direction);
+    Vector3 invDir = { 1.0f/ray.direction.x, 1.0f/ray.direction.y, 1.0f/ray.direction.z };
 
-    float t[11] = { 0 };
+    int stack[MESH_BVH_MAX_DEPTH + 2] = { 0 };
+    int stackCount = 0;
+    stack[stackCount++] = 0;
 
-    t[8] = 1.0f/ray.direction.x;
-    t[9] = 1.0f/ray.direction.y;
-    t[10] = 1.0f/ray.direction.z;
+    while (stackCount > 0)
+    {
+        const MeshBvhNode *node = &bvh->nodes[stack[--stackCount]];
 
-    t[0] = (box.min.x - ray.position.x)*t[8];
-    t[1] = (box.max.x - ray.position.x)*t[8];
-    t[2] = (box.min.y - ray.position.y)*t[9];
-    t[3] = (box.max.y - ray.position.y)*t[9];
-    t[4] = (box.min.z - ray.position.z)*t[10];
-    t[5] = (box.max.z - ray.position.z)*t[10];
-    t[6] = (float)fmax(fmax(fmin(t[0], t[1]), fmin(t[2], t[3])), fmin(t[4], t[5]));
-    t[7] = (float)fmin(fmin(fmax(t[0], t[1]), fmax(t[2], t[3])), fmax(t[4], t[5]));
+        if (node->triangleCount > 0)
+        {
+            // Test leaf triangles (Möller-Trumbore, same as GetRayCollisionTriangle())
+            for (int i = node->index; i < node->index + node->triangleCount; i++)
+            {
+                const Vector3 *p = &bvh->triangles[i*3];
+                Vector3 edge1 = Vector3Subtract(p[1], p[0]);
+                Vector3 edge2 = Vector3Subtract(p[2], p[0]);
+                Vector3 pv = Vector3CrossProduct(ray.direction, edge2);
+                float det = Vector3DotProduct(edge1, pv);
 
-    collision.hit = !((t[7] < 0) || (t[6] > t[7]));
-    collision.distance = t[6];
-    collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+                if ((det > -EPSILON) && (det < EPSILON)) continue;
 
-    // Get box center point
-    collision.normal = Vector3Lerp(box.min, box.max, 0.5f);
-    // Get vector center point->hit point
-    collision.normal = Vector3Subtract(collision.point, collision.normal);
-    // Scale vector to unit cube
-    // NOTE: We use an additional .01 to fix numerical errors
-    collision.normal = Vector3Scale(collision.normal, 2.01f);
-    collision.normal = Vector3Divide(collision.normal, Vector3Subtract(box.max, box.min));
-    // The relevant elements of the vector are now slightly larger than 1.0f (or smaller than -1.0f)
-    // and the others are somewhere between -1.0 and 1.0 casting to int is exactly our wanted normal!
-    collision.normal.x = (float)((int)collision.normal.x);
-    collision.normal.y = (float)((int)collision.normal.y);
-    collision.normal.z = (float)((int)collision.normal.z);
+                float invDet = 1.0f/det;
+                Vector3 tv = Vector3Subtract(ray.position, p[0]);
+                float u = Vector3DotProduct(tv, pv)*invDet;
+                if ((u < 0.0f) || (u > 1.0f)) continue;
 
-    collision.normal = Vector3Normalize(collision.normal);
+                Vector3 qv = Vector3CrossProduct(tv, edge1);
+                float v = Vector3DotProduct(ray.direction, qv)*invDet;
+                if ((v < 0.0f) || ((u + v) > 1.0f)) continue;
 
-    if (insideBox)
-    {
-        // Reset ray.direction
-        ray.direction = Vector3Negate(ray.direction);
-        // Fix result
-        collision.distance *= -1.0f;
-        collision.normal = Vector3Negate(collision.normal);
+                float t = Vector3DotProduct(edge2, qv)*invDet;
+
+                if ((t > EPSILON) && ((closest < 0.0f) || (t < closest)))
+                {
+                    closest = t;
+                    *triangle = i;
+                }
+            }
+        }
+        else
+        {
+            // Test children bounds, push farther child first to visit closer child first
+            int children[2] = { (int)(node - bvh->nodes) + 1, node->index };
+            float distances[2] = { 0 };
+
+            for (int c = 0; c < 2; c++)
+            {
+                const MeshBvhNode *child = &bvh->nodes[children[c]];
+
+                float tx1 = (child->min.x - ray.position.x)*invDir.x;
+                float tx2 = (child->max.x - ray.position.x)*invDir.x;
+                float tmin = fminf(tx1, tx2);
+                float tmax = fmaxf(tx1, tx2);
+                float ty1 = (child->min.y - ray.position.y)*invDir.y;
+                float ty2 = (child->max.y - ray.position.y)*invDir.y;
+                tmin = fmaxf(tmin, fminf(ty1, ty2));
+                tmax = fminf(tmax, fmaxf(ty1, ty2));
+                float tz1 = (child->min.z - ray.position.z)*invDir.z;
+                float tz2 = (child->max.z - ray.position.z)*invDir.z;
+                tmin = fmaxf(tmin, fminf(tz1, tz2));
+                tmax = fminf(tmax, fmaxf(tz1, tz2));
+
+                // NOTE: Exit distance is slightly enlarged to avoid missing rays grazing bounds edges by rounding errors
+                tmax *= 1.0000004f;
+
+                // Child is skipped if missed, behind the ray or farther than closest hit
+                if ((tmax < tmin) || (tmax < 0.0f) || ((closest >= 0.0f) && (tmin > closest))) distances[c] = -1.0f;
+                else distances[c] = (tmin > 0.0f)? tmin : 0.0f;
+            }
+
+            if ((distances[0] >= 0.0f) && (distances[1] >= 0.0f))
+            {
+                int nearChild = (distances[0] <= distances[1])? 0 : 1;
+                stack[stackCount++] = children[1 - nearChild];
+                stack[stackCount++] = children[nearChild];
+            }
+            else if (distances[0] >= 0.0f) stack[stackCount++] = children[0];
+            else if (distances[1] >= 0.0f) stack[stackCount++] = children[1];
+        }
     }
 
-    return collision;
+    return closest;
 }
 
-// Get collision info between ray and mesh
-RayCollision GetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
+// Skin mesh vertex blocks assigned to one worker
+// NOTE: Bones transforms are blended by vertex weights into structure-of-arrays blocks,
+// so the vertex transformation loops run over contiguous data and can be vectorized by the compiler
+static void SkinMeshWork(void *data, int worker, int workerCount)
 {
-    RayCollision collision = { 0 };
+    MeshSkinningJob *job = (MeshSkinningJob *)data;
 
-    // Check if mesh vertex data on CPU for testing
-    if (mesh.vertices != NULL)
+    float blendTransform[12][SKINNING_BLOCK_SIZE];  // Blended position transform by vertex (3x4)
+    float blendRotation[9][SKINNING_BLOCK_SIZE];    // Blended normal rotation by vertex (3x3)
+
+    int blockCount = (job->vertexCount + SKINNING_BLOCK_SIZE - 1)/SKINNING_BLOCK_SIZE;
+    int firstBlock = blockCount*worker/workerCount;
+    int lastBlock = blockCount*(worker + 1)/workerCount;
+
+    for (int block = firstBlock; block < lastBlock; block++)
     {
-        int triangleCount = mesh.triangleCount;
+        int first = block*SKINNING_BLOCK_SIZE;
+        int count = job->vertexCount - first;
+        if (count > SKINNING_BLOCK_SIZE) count = SKINNING_BLOCK_SIZE;
 
-        // Test against all triangles in mesh
-        for (int i = 0; i < triangleCount; i++)
+        // Blend bones transforms by vertex weights, up to 4 bones influence by vertex
+        // NOTE: Bones with no weight are replaced by bone 0, their ids could be out of bounds
+        for (int i = 0; i < count; i++)
         {
-            Vector3 a, b, c;
-            Vector3* vertdata = (Vector3*)mesh.vertices;
+            const unsigned char *boneIds = job->boneIds + (first + i)*4;
+            const float *boneWeights = job->boneWeights + (first + i)*4;
+            int ids[4] = { 0 };
+            for (int j = 0; j < 4; j++) ids[j] = (boneWeights[j] != 0.0f)? boneIds[j] : 0;
 
-            if (mesh.indices)
-            {
-                a = vertdata[mesh.indices[i*3 + 0]];
-                b = vertdata[mesh.indices[i*3 + 1]];
-                c = vertdata[mesh.indices[i*3 + 2]];
-            }
-            else
+            const float *t0 = job->boneTransforms + ids[0]*12;
+            const float *t1 = job->boneTransforms + ids[1]*12;
+            const float *t2 = job->boneTransforms + ids[2]*12;
+            const float *t3 = job->boneTransforms + ids[3]*12;
+
+            for (int c = 0; c < 12; c++) blendTransform[c][i] = t0[c]*boneWeights[0] + t1[c]*boneWeights[1] + t2[c]*boneWeights[2] + t3[c]*boneWeights[3];
+
+            if (job->normals != NULL)
             {
-                a = vertdata[i*3 + 0];
-                b = vertdata[i*3 + 1];
-                c = vertdata[i*3 + 2];
+                const float *r0 = job->boneRotations + ids[0]*9;
+                const float *r1 = job->boneRotations + ids[1]*9;
+                const float *r2 = job->boneRotations + ids[2]*9;
+                const float *r3 = job->boneRotations + ids[3]*9;
+
+                for (int c = 0; c < 9; c++) blendRotation[c][i] = r0[c]*boneWeights[0] + r1[c]*boneWeights[1] + r2[c]*boneWeights[2] + r3[c]*boneWeights[3];
             }
+        }
 
-            a = Vector3Transform(a, transform);
-            b = Vector3Transform(b, transform);
-            c = Vector3Transform(c, transform);
+        // Transform vertex positions
+        const float *vertices = job->vertices + first*3;
+        float *animVertices = job->animVertices + first*3;
 
-            RayCollision triHitInfo = GetRayCollisionTriangle(ray, a, b, c);
+        for (int i = 0; i < count; i++)
+        {
+            float x = vertices[i*3];
+            float y = vertices[i*3 + 1];
+            float z = vertices[i*3 + 2];
 
-            if (triHitInfo.hit)
+            animVertices[i*3] = blendTransform[0][i]*x + blendTransform[1][i]*y + blendTransform[2][i]*z + blendTransform[3][i];
+            animVertices[i*3 + 1] = blendTransform[4][i]*x + blendTransform[5][i]*y + blendTransform[6][i]*z + blendTransform[7][i];
+            animVertices[i*3 + 2] = blendTransform[8][i]*x + blendTransform[9][i]*y + blendTransform[10][i]*z + blendTransform[11][i];
+        }
+
+        // Transform vertex normals
+        if (job->normals != NULL)
+        {
+            const float *normals = job->normals + first*3;
+            float *animNormals = job->animNormals + first*3;
+
+            for (int i = 0; i < count; i++)
             {
-                // Save the closest hit triangle
-                if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
+                float x = normals[i*3];
+                float y = normals[i*3 + 1];
+                float z = normals[i*3 + 2];
+
+                animNormals[i*3] = blendRotation[0][i]*x + blendRotation[1][i]*y + blendRotation[2][i]*z;
+                animNormals[i*3 + 1] = blendRotation[3][i]*x + blendRotation[4][i]*y + blendRotation[5][i]*z;
+                animNormals[i*3 + 2] = blendRotation[6][i]*x + blendRotation[7][i]*y + blendRotation[8][i]*z;
             }
         }
     }
+}
 
-    return collision;
+#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
+// Build pose from parent joints
+// NOTE: Required for animations loading (required by IQM and GLTF)
+static void BuildPoseFromParentJoints(BoneInfo *bones, int boneCount, Transform *transforms)
+{
+    for (int i = 0; i < boneCount; i++)
+    {
+        if (bones[i].parent >= 0)
+        {
+            if (bones[i].parent > i)
+            {
+                TRACELOG(LOG_WARNING, "Assumes bones are toplogically sorted, but bone %d has parent %d. Skipping.", i, bones[i].parent);
+                continue;
+            }
+            transforms[i].rotation = QuaternionMultiply(transforms[bones[i].parent].rotation, transforms[i].rotation);
+            transforms[i].translation = Vector3RotateByQuaternion(transforms[i].translation, transforms[bones[i].parent].rotation);
+            transforms[i].translation = Vector3Add(transforms[i].translation, transforms[bones[i].parent].translation);
+            transforms[i].scale = Vector3Multiply(transforms[i].scale, transforms[bones[i].parent].scale);
+        }
+    }
+}
+#endif
+
+// Get model file format loader (NULL if not supported)
+static ModelFileLoader GetModelFileLoader(const char *fileName)
+{
+    ModelFileLoader loader = NULL;
+
+#if defined(SUPPORT_FILEFORMAT_OBJ)
+    if (IsFileExtension(fileName, ".obj")) loader = LoadOBJ;
+#endif
+#if defined(SUPPORT_FILEFORMAT_IQM)
+    if (IsFileExtension(fileName, ".iqm")) loader = LoadIQM;
+#endif
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+    if (IsFileExtension(fileName, ".gltf") || IsFileExtension(fileName, ".glb")) loader = LoadGLTF;
+#endif
+#if defined(SUPPORT_FILEFORMAT_VOX)
+    if (IsFileExtension(fileName, ".vox")) loader = LoadVOX;
+#endif
+#if defined(SUPPORT_FILEFORMAT_M3D)
+    if (IsFileExtension(fileName, ".m3d")) loader = LoadM3D;
+#endif
+#if defined(SUPPORT_FILEFORMAT_RMSH)
+    if (IsFileExtension(fileName, ".rmsh")) loader = LoadRMSH;
+#endif
+
+    return loader;
+}
+
+// Load model data from file (CPU only, no GPU upload for meshes)
+// NOTE: Loader is selected by caller, IsFileExtension() is not safe to be used from worker threads
+static Model LoadModelData(const char *fileName, ModelFileLoader loader)
+{
+    Model model = { 0 };
+
+    if (loader != NULL) model = loader(fileName);
+
+    // Make sure model transform is set to identity matrix!
+    model.transform = MatrixIdentity();
+
+    if ((model.meshCount == 0) || (model.meshes == NULL)) TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load model mesh(es) data", fileName);
+
+    if (model.materialCount == 0)
+    {
+        TRACELOG(LOG_WARNING, "MATERIAL: [%s] Failed to load model material data, default to white material", fileName);
+
+        model.materialCount = 1;
+        model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+        model.materials[0] = LoadMaterialDefault();
+
+        if (model.meshMaterial == NULL) model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+    }
+
+    return model;
 }
 
-// Get collision info between ray and triangle
-// NOTE: The points are expected to be in counter-clockwise winding
-// NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
-RayCollision GetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3)
+// Parse model load file, textures are decoded but not uploaded
+static void ParseModelLoad(ModelLoad *load)
 {
-    #define EPSILON 0.000001f        // A small number
-
-    RayCollision collision = { 0 };
-    Vector3 edge1 = { 0 };
-    Vector3 edge2 = { 0 };
-    Vector3 p, q, tv;
-    float det, invDet, u, v, t;
+    modelLoadCurrent = load;
+    Model model = LoadModelData(load->fileName, load->loader);
+    modelLoadCurrent = NULL;
+
+    LockWorkerData();
+    load->model = model;
+    load->state = MODEL_LOAD_UPLOADING;
+    UnlockWorkerData();
+}
 
-    // Find vectors for two edges sharing V1
-    edge1 = Vector3Subtract(p2, p1);
-    edge2 = Vector3Subtract(p3, p1);
+// Parse queued model loads until queue is empty (worker thread)
+static void ParseModelLoadsWork(void *data)
+{
+    (void)data;
 
-    // Begin calculating determinant - also used to calculate u parameter
-    p = Vector3CrossProduct(ray.direction, edge2);
+    while (true)
+    {
+        ModelLoad *load = NULL;
 
-    // If determinant is near zero, ray lies in plane of triangle or ray is parallel to plane of triangle
-    det = Vector3DotProduct(edge1, p);
+        LockWorkerData();
+        for (int i = 0; i < modelLoadCount; i++)
+        {
+            if ((modelLoads[i] != NULL) && (modelLoads[i]->state == MODEL_LOAD_QUEUED))
+            {
+                load = modelLoads[i];
+                load->state = MODEL_LOAD_PARSING;
+                break;
+            }
+        }
 
-    // Avoid culling!
-    if ((det > -EPSILON) && (det < EPSILON)) return collision;
+        // Worker finishes when queue is empty, checked under same lock used to queue loads
+        if (load == NULL) modelLoadWorkerCount--;
+        UnlockWorkerData();
 
-    invDet = 1.0f/det;
+        if (load == NULL) break;
 
-    // Calculate distance from V1 to ray origin
-    tv = Vector3Subtract(ray.position, p1);
+        ParseModelLoad(load);
+    }
+}
 
-    // Calculate u parameter and test bound
-    u = Vector3DotProduct(tv, p)*invDet;
+// Unload model load data, CPU and uploaded GPU data (render thread)
+static void UnloadModelLoadData(ModelLoad *load)
+{
+    // Deferred images not uploaded yet
+    int uploadedImages = (load->uploadCount > load->model.meshCount)? load->uploadCount - load->model.meshCount : 0;
+    for (int i = uploadedImages; (load->images != NULL) && (i < load->imageCount); i++) UnloadImage(load->images[i]);
+    RL_FREE(load->images);
 
-    // The intersection lies outside the triangle
-    if ((u < 0.0f) || (u > 1.0f)) return collision;
+    // Textures uploaded by UpdateModelLoads(), not shared with other models
+    for (int m = 0; m < load->model.materialCount; m++)
+    {
+        for (int k = 0; k < MAX_MATERIAL_MAPS; k++)
+        {
+            unsigned int id = load->model.materials[m].maps[k].texture.id;
+            if ((id > 0) && (id != rlGetTextureIdDefault())) rlUnloadTexture(id);
+        }
+    }
 
-    // Prepare to test v parameter
-    q = Vector3CrossProduct(tv, edge1);
+    UnloadModel(load->model);
 
-    // Calculate V parameter and test bound
-    v = Vector3DotProduct(ray.direction, q)*invDet;
+    RL_FREE(load->fileName);
+    RL_FREE(load);
+}
 
-    // The intersection lies outside the triangle
-    if ((v < 0.0f) || ((u + v) > 1.0f)) return collision;
+// Load model material texture from file (upload deferred on asynchronous loads)
+// NOTE: File name is relative to texPath directory (if not NULL)
+static Texture2D LoadModelTexture(const char *texPath, const char *fileName)
+{
+    Texture2D texture = { 0 };
 
-    t = Vector3DotProduct(edge2, q)*invDet;
+    char texFileName[MAX_FILEPATH_LENGTH] = { 0 };
+    if (texPath != NULL) snprintf(texFileName, MAX_FILEPATH_LENGTH, "%s/%s", texPath, fileName);
+    else strncpy(texFileName, fileName, MAX_FILEPATH_LENGTH - 1);
 
-    if (t > EPSILON)
+    if (modelLoadCurrent == NULL) texture = LoadTexture(texFileName);
+    else
     {
-        // Ray hit, get hit point and normal
-        collision.hit = true;
-        collision.distance = t;
-        collision.normal = Vector3Normalize(Vector3CrossProduct(edge1, edge2));
-        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, t));
+        Image image = LoadImage(texFileName);
+        texture = LoadModelTextureFromImage(image);
+        UnloadImage(image);
     }
 
-    return collision;
+    return texture;
 }
 
-// Get collision info between ray and quad
-// NOTE: The points are expected to be in counter-clockwise winding
-RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4)
+// Load model material texture from image (upload deferred on asynchronous loads)
+// NOTE: On asynchronous loads, a placeholder texture is returned (id 0), mipmaps identifies
+// the deferred image (-(index + 1)) until the texture is uploaded by UpdateModelLoads()
+static Texture2D LoadModelTextureFromImage(Image image)
 {
-    RayCollision collision = { 0 };
+    Texture2D texture = { 0 };
 
-    collision = GetRayCollisionTriangle(ray, p1, p2, p4);
+    if (modelLoadCurrent == NULL) texture = LoadTextureFromImage(image);
+    else if (image.data != NULL)
+    {
+        ModelLoad *load = modelLoadCurrent;
 
-    if (!collision.hit) collision = GetRayCollisionTriangle(ray, p2, p3, p4);
+        load->images = (Image *)RL_REALLOC(load->images, (load->imageCount + 1)*sizeof(Image));
+        load->images[load->imageCount] = ImageCopy(image);
+        load->imageCount++;
 
-    return collision;
+        texture = (Texture2D){ 0, image.width, image.height, -load->imageCount, image.format };
+    }
+
+    return texture;
 }
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
-#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
-// Build pose from parent joints
-// NOTE: Required for animations loading (required by IQM and GLTF)
-static void BuildPoseFromParentJoints(BoneInfo *bones, int boneCount, Transform *transforms)
+// Get model file directory path, reentrant version of GetDirectoryPath()
+// NOTE: Path is written to dirPath (MAX_FILEPATH_LENGTH), models could be loaded by worker threads
+static void GetModelDirectoryPath(const char *fileName, char *dirPath)
 {
-    for (int i = 0; i < boneCount; i++)
+    const char *lastSlash = NULL;
+    for (const char *c = fileName; *c != '\0'; c++) if ((*c == '/') || (*c == '\\')) lastSlash = c;
+
+    if (lastSlash == NULL) strcpy(dirPath, ".");
+    else if (lastSlash == fileName)
     {
-        if (bones[i].parent >= 0)
-        {
-            if (bones[i].parent > i)
-            {
-                TRACELOG(LOG_WARNING, "Assumes bones are toplogically sorted, but bone %d has parent %d. Skipping.", i, bones[i].parent);
-                continue;
-            }
-            transforms[i].rotation = QuaternionMultiply(transforms[bones[i].parent].rotation, transforms[i].rotation);
-            transforms[i].translation = Vector3RotateByQuaternion(transforms[i].translation, transforms[bones[i].parent].rotation);
-            transforms[i].translation = Vector3Add(transforms[i].translation, transforms[bones[i].parent].translation);
-            transforms[i].scale = Vector3Multiply(transforms[i].scale, transforms[bones[i].parent].scale);
-        }
+        // The last and only slash is the leading one: path is in a root directory
+        dirPath[0] = fileName[0];
+        dirPath[1] = '\0';
+    }
+    else
+    {
+        int length = (int)(lastSlash - fileName);
+        if (length > (MAX_FILEPATH_LENGTH - 1)) length = MAX_FILEPATH_LENGTH - 1;
+
+        memcpy(dirPath, fileName, length);
+        dirPath[length] = '\0';
     }
 }
-#endif
 
 #if defined(SUPPORT_FILEFORMAT_OBJ)
 // Load OBJ mesh data
@@ -3932,16 +6674,12 @@ static Model LoadOBJ(const char *fileName)
     {
         unsigned int dataSize = (unsigned int)strlen(fileText);
 
-        char currentDir[1024] = { 0 };
-        strcpy(currentDir, GetWorkingDirectory()); // Save current working directory
-        const char *workingDir = GetDirectoryPath(fileName); // Switch to OBJ directory for material path correctness
-        if (CHDIR(workingDir) != 0)
-        {
-            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", workingDir);
-        }
+        // NOTE: Materials file and textures paths are relative to OBJ directory
+        char objPath[MAX_FILEPATH_LENGTH] = { 0 };
+        GetModelDirectoryPath(fileName, objPath);
 
         unsigned int flags = TINYOBJ_FLAG_TRIANGULATE;
-        int ret = tinyobj_parse_obj(&attrib, &meshes, &meshCount, &materials, &materialCount, fileText, dataSize, flags);
+        int ret = tinyobj_parse_obj_with_base_dir(&attrib, &meshes, &meshCount, &materials, &materialCount, fileText, dataSize, objPath, flags);
 
         if (ret != TINYOBJ_SUCCESS) TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load OBJ data", fileName);
         else TRACELOG(LOG_INFO, "MODEL: [%s] OBJ data loaded successfully: %i meshes/%i materials", fileName, meshCount, materialCount);
@@ -4021,7 +6759,7 @@ static Model LoadOBJ(const char *fileName)
         }
 
         // Init model materials
-        if (materialCount > 0) ProcessMaterialsOBJ(model.materials, materials, materialCount);
+        if (materialCount > 0) ProcessMaterialsOBJ(model.materials, materials, materialCount, objPath);
         else model.materials[0] = LoadMaterialDefault(); // Set default material for the mesh
 
         tinyobj_attrib_free(&attrib);
@@ -4029,12 +6767,6 @@ static Model LoadOBJ(const char *fileName)
         tinyobj_materials_free(materials, materialCount);
 
         UnloadFileText(fileText);
-
-        // Restore current working directory
-        if (CHDIR(currentDir) != 0)
-        {
-            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", currentDir);
-        }
     }
 
     return model;
@@ -4681,7 +7413,10 @@ static Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texPat
         }
         else     // Check if image is provided as image path
         {
-            image = LoadImage(TextFormat("%s/%s", texPath, cgltfImage->uri));
+            char imagePath[MAX_FILEPATH_LENGTH] = { 0 };
+            snprintf(imagePath, MAX_FILEPATH_LENGTH, "%s/%s", texPath, cgltfImage->uri);
+
+            image = LoadImage(imagePath);
         }
     }
     else if (cgltfImage->buffer_view->buffer->data != NULL)    // Check if image is provided as data buffer
@@ -4703,7 +7438,7 @@ static Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texPat
             (strcmp(cgltfImage->mime_type, "image/png") == 0)) image = LoadImageFromMemory(".png", data, (int)cgltfImage->buffer_view->size);
         else if ((strcmp(cgltfImage->mime_type, "image\\/jpeg") == 0) ||
                  (strcmp(cgltfImage->mime_type, "image/jpeg") == 0)) image = LoadImageFromMemory(".jpg", data, (int)cgltfImage->buffer_view->size);
-        else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized", TextFormat("%s/%s", texPath, cgltfImage->uri));
+        else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized");
 
         RL_FREE(data);
     }
@@ -4831,10 +7566,12 @@ static Model LoadGLTF(const char *fileName)
 
         // Load materials data
         //----------------------------------------------------------------------------------------------------
+        char texPath[MAX_FILEPATH_LENGTH] = { 0 };
+        GetModelDirectoryPath(fileName, texPath);
+
         for (unsigned int i = 0, j = 1; i < data->materials_count; i++, j++)
         {
             model.materials[j] = LoadMaterialDefault();
-            const char *texPath = GetDirectoryPath(fileName);
 
             // Check glTF material flow: PBR metallic/roughness flow
             // NOTE: Alternatively, materials can follow PBR specular/glossiness flow
@@ -4846,7 +7583,7 @@ static Model LoadGLTF(const char *fileName)
                     Image imAlbedo = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.base_color_texture.texture->image, texPath);
                     if (imAlbedo.data != NULL)
                     {
-                        model.materials[j].maps[MATERIAL_MAP_ALBEDO].texture = LoadTextureFromImage(imAlbedo);
+                        model.materials[j].maps[MATERIAL_MAP_ALBEDO].texture = LoadModelTextureFromImage(imAlbedo);
                         UnloadImage(imAlbedo);
                     }
                 }
@@ -4862,7 +7599,7 @@ static Model LoadGLTF(const char *fileName)
                     Image imMetallicRoughness = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture->image, texPath);
                     if (imMetallicRoughness.data != NULL)
                     {
-                        model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadTextureFromImage(imMetallicRoughness);
+                        model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadModelTextureFromImage(imMetallicRoughness);
                         UnloadImage(imMetallicRoughness);
                     }
 
@@ -4880,7 +7617,7 @@ static Model LoadGLTF(const char *fileName)
                     Image imNormal = LoadImageFromCgltfImage(data->materials[i].normal_texture.texture->image, texPath);
                     if (imNormal.data != NULL)
                     {
-                        model.materials[j].maps[MATERIAL_MAP_NORMAL].texture = LoadTextureFromImage(imNormal);
+                        model.materials[j].maps[MATERIAL_MAP_NORMAL].texture = LoadModelTextureFromImage(imNormal);
                         UnloadImage(imNormal);
                     }
                 }
@@ -4891,7 +7628,7 @@ static Model LoadGLTF(const char *fileName)
                     Image imOcclusion = LoadImageFromCgltfImage(data->materials[i].occlusion_texture.texture->image, texPath);
                     if (imOcclusion.data != NULL)
                     {
-                        model.materials[j].maps[MATERIAL_MAP_OCCLUSION].texture = LoadTextureFromImage(imOcclusion);
+                        model.materials[j].maps[MATERIAL_MAP_OCCLUSION].texture = LoadModelTextureFromImage(imOcclusion);
                         UnloadImage(imOcclusion);
                     }
                 }
@@ -4902,7 +7639,7 @@ static Model LoadGLTF(const char *fileName)
                     Image imEmissive = LoadImageFromCgltfImage(data->materials[i].emissive_texture.texture->image, texPath);
                     if (imEmissive.data != NULL)
                     {
-                        model.materials[j].maps[MATERIAL_MAP_EMISSION].texture = LoadTextureFromImage(imEmissive);
+                        model.materials[j].maps[MATERIAL_MAP_EMISSION].texture = LoadModelTextureFromImage(imEmissive);
                         UnloadImage(imEmissive);
                     }
 
@@ -5792,12 +8529,12 @@ static Model LoadM3D(const char *fileName)
 
                             switch (prop->type)
                             {
-                                case m3dp_map_Kd: model.materials[i + 1].maps[MATERIAL_MAP_DIFFUSE].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Ks: model.materials[i + 1].maps[MATERIAL_MAP_SPECULAR].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Ke: model.materials[i + 1].maps[MATERIAL_MAP_EMISSION].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Km: model.materials[i + 1].maps[MATERIAL_MAP_NORMAL].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Ka: model.materials[i + 1].maps[MATERIAL_MAP_OCCLUSION].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Pm: model.materials[i + 1].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadTextureFromImage(image); break;
+                                case m3dp_map_Kd: model.materials[i + 1].maps[MATERIAL_MAP_DIFFUSE].texture = LoadModelTextureFromImage(image); break;
+                                case m3dp_map_Ks: model.materials[i + 1].maps[MATERIAL_MAP_SPECULAR].texture = LoadModelTextureFromImage(image); break;
+                                case m3dp_map_Ke: model.materials[i + 1].maps[MATERIAL_MAP_EMISSION].texture = LoadModelTextureFromImage(image); break;
+                                case m3dp_map_Km: model.materials[i + 1].maps[MATERIAL_MAP_NORMAL].texture = LoadModelTextureFromImage(image); break;
+                                case m3dp_map_Ka: model.materials[i + 1].maps[MATERIAL_MAP_OCCLUSION].texture = LoadModelTextureFromImage(image); break;
+                                case m3dp_map_Pm: model.materials[i + 1].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadModelTextureFromImage(image); break;
                                 default: break;
                             }
                         }
@@ -5981,4 +8718,359 @@ static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCou
 }
 #endif
 
+#if defined(SUPPORT_FILEFORMAT_RMSH)
+// Load RMSH mesh data
+// NOTE: Vertex streams are copied as they are into mesh data, no conversion required
+static Model LoadRMSH(const char *fileName)
+{
+    Model model = { 0 };
+
+    int fileSize = 0;
+    unsigned char *fileData = LoadFileData(fileName, &fileSize);
+
+    if (fileData == NULL) return model;
+
+#if defined(SUPPORT_TRACELOG_DEBUG)
+    double startTime = GetTime();
+#endif
+
+    const unsigned char *data = fileData;
+    int dataSize = fileSize;
+
+    RMSHHeader header = { 0 };
+    bool valid = ReadRMSHData(&data, &dataSize, &header, sizeof(RMSHHeader));
+
+    // NOTE: Counts are checked against available data, corrupted headers must not trigger huge allocations
+    if (!valid || (memcmp(header.id, "rMSH", 4) != 0) || (header.version != RMSH_FILE_VERSION) ||
+        (header.meshCount <= 0) || (header.meshCount > dataSize/(int)sizeof(RMSHMeshHeader)) ||
+        (header.materialCount < 0) || (header.materialCount > dataSize) || (header.materialMapCount < 0) || (header.materialMapCount > MAX_MATERIAL_MAPS*16) ||
+        ((long long)header.materialCount*header.materialMapCount*(long long)(sizeof(Color) + sizeof(float)) > dataSize) ||
+        (header.boneCount < 0) || (header.boneCount > dataSize/(int)(sizeof(BoneInfo) + sizeof(Transform))))
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] RMSH file not valid", fileName);
+        UnloadFileData(fileData);
+        return model;
+    }
+
+    // Load materials, default material with exported maps colors and values
+    if (header.materialCount > 0)
+    {
+        model.materialCount = header.materialCount;
+        model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+
+        for (int i = 0; valid && (i < model.materialCount); i++)
+        {
+            model.materials[i] = LoadMaterialDefault();
+
+            for (int m = 0; valid && (m < header.materialMapCount); m++)
+            {
+                Color color = { 0 };
+                float value = 0.0f;
+
+                valid = ReadRMSHData(&data, &dataSize, &color, sizeof(Color)) && ReadRMSHData(&data, &dataSize, &value, sizeof(float));
+
+                if (valid && (m < MAX_MATERIAL_MAPS))
+                {
+                    model.materials[i].maps[m].color = color;
+                    model.materials[i].maps[m].value = value;
+                }
+            }
+        }
+    }
+
+    // Load bones and bind pose
+    if (valid && (header.boneCount > 0))
+    {
+        model.boneCount = header.boneCount;
+        model.bones = (BoneInfo *)RL_MALLOC(model.boneCount*sizeof(BoneInfo));
+        model.bindPose = (Transform *)RL_MALLOC(model.boneCount*sizeof(Transform));
+
+        valid = ReadRMSHData(&data, &dataSize, model.bones, model.boneCount*sizeof(BoneInfo)) &&
+                ReadRMSHData(&data, &dataSize, model.bindPose, model.boneCount*sizeof(Transform));
+    }
+
+    // Load meshes
+    model.meshCount = header.meshCount;
+    model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
+    model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+
+    for (int i = 0; valid && (i < model.meshCount); i++)
+    {
+        Mesh *mesh = &model.meshes[i];
+        RMSHMeshHeader meshHeader = { 0 };
+
+        // NOTE: Every index requires at least one byte of data (packed indices), unindexed meshes
+        // require one vertex by index, so triangles count is bounded by available data
+        valid = ReadRMSHData(&data, &dataSize, &meshHeader, sizeof(RMSHMeshHeader)) &&
+                (meshHeader.vertexCount > 0) && (meshHeader.vertexCount <= dataSize/12) &&
+                (meshHeader.indexDataSize >= 0) && (meshHeader.indexDataSize <= dataSize) &&
+                (meshHeader.triangleCount >= 0) && (meshHeader.triangleCount <= dataSize/3) &&
+                (meshHeader.streams & RMSH_STREAM_VERTICES);
+
+        if (!valid) break;
+
+        if (meshHeader.streams & RMSH_STREAM_INDICES) valid = ((long long)meshHeader.indexDataSize == (long long)meshHeader.triangleCount*3*(long long)sizeof(unsigned short));
+        else if (meshHeader.streams & RMSH_STREAM_INDICES_PACKED) valid = (meshHeader.triangleCount*3 <= meshHeader.indexDataSize);
+        else valid = (meshHeader.triangleCount*3 <= meshHeader.vertexCount);
+
+        if (!valid) break;
+
+        int vertexCount = meshHeader.vertexCount;
+        mesh->vertexCount = vertexCount;
+        mesh->triangleCount = meshHeader.triangleCount;
+
+        if ((meshHeader.material >= 0) && (meshHeader.material < model.materialCount)) model.meshMaterial[i] = meshHeader.material;
+
+        #define RMSH_READ_STREAM(flag, type, components, dst) \
+            if (valid && (meshHeader.streams & flag)) \
+            { \
+                dst = (type *)RL_MALLOC(vertexCount*components*sizeof(type)); \
+                valid = ReadRMSHData(&data, &dataSize, dst, vertexCount*components*sizeof(type)); \
+            }
+
+        RMSH_READ_STREAM(RMSH_STREAM_VERTICES, float, 3, mesh->vertices)
+        RMSH_READ_STREAM(RMSH_STREAM_TEXCOORDS, float, 2, mesh->texcoords)
+        RMSH_READ_STREAM(RMSH_STREAM_TEXCOORDS2, float, 2, mesh->texcoords2)
+        RMSH_READ_STREAM(RMSH_STREAM_NORMALS, float, 3, mesh->normals)
+        RMSH_READ_STREAM(RMSH_STREAM_TANGENTS, float, 4, mesh->tangents)
+        RMSH_READ_STREAM(RMSH_STREAM_COLORS, unsigned char, 4, mesh->colors)
+        RMSH_READ_STREAM(RMSH_STREAM_BONEIDS, unsigned char, 4, mesh->boneIds)
+        RMSH_READ_STREAM(RMSH_STREAM_BONEWEIGHTS, float, 4, mesh->boneWeights)
+
+        #undef RMSH_READ_STREAM
+
+        int indexCount = mesh->triangleCount*3;
+
+        if (valid && (meshHeader.streams & RMSH_STREAM_INDICES))
+        {
+            mesh->indices = (unsigned short *)RL_MALLOC(indexCount*sizeof(unsigned short));
+            valid = ReadRMSHData(&data, &dataSize, mesh->indices, meshHeader.indexDataSize);
+        }
+        else if (valid && (meshHeader.streams & RMSH_STREAM_INDICES_PACKED))
+        {
+            // NOTE: Packed indices block is checked to be in file data before being unpacked
+            const unsigned char *packedIndices = data;
+
+            mesh->indices = (unsigned short *)RL_MALLOC(indexCount*sizeof(unsigned short));
+            valid = ReadRMSHData(&data, &dataSize, NULL, meshHeader.indexDataSize) &&
+                    UnpackMeshIndices(packedIndices, meshHeader.indexDataSize, mesh->indices, indexCount);
+        }
+
+        // Check indices are in vertices range, mesh data is uploaded to GPU directly
+        for (int k = 0; valid && (mesh->indices != NULL) && (k < indexCount); k++) valid = (mesh->indices[k] < vertexCount);
+
+        // Animated vertex data, required by CPU skinning
+        if (valid && (mesh->boneIds != NULL) && (mesh->boneWeights != NULL) && (model.boneCount > 0))
+        {
+            mesh->animVertices = (float *)RL_MALLOC(vertexCount*3*sizeof(float));
+            memcpy(mesh->animVertices, mesh->vertices, vertexCount*3*sizeof(float));
+
+            if (mesh->normals != NULL)
+            {
+                mesh->animNormals = (float *)RL_MALLOC(vertexCount*3*sizeof(float));
+                memcpy(mesh->animNormals, mesh->normals, vertexCount*3*sizeof(float));
+            }
+        }
+    }
+
+    UnloadFileData(fileData);
+
+    if (!valid)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] RMSH file data corrupted", fileName);
+        UnloadModel(model);
+        model = (Model){ 0 };
+    }
+    else TRACELOGD("MODEL: [%s] RMSH file loaded in %.2f ms (%i meshes)", fileName, (GetTime() - startTime)*1000.0, model.meshCount);
+
+    return model;
+}
+
+// Export RMSH mesh data
+// NOTE: Indices are delta encoded only if it reduces indices data size
+static bool ExportRMSH(Model model, const char *fileName)
+{
+    if ((model.meshCount <= 0) || (model.meshes == NULL)) return false;
+
+    RMSHHeader header = { .id = { 'r', 'M', 'S', 'H' }, .version = RMSH_FILE_VERSION, .meshCount = model.meshCount,
+                          .materialCount = (model.materials != NULL)? model.materialCount : 0, .materialMapCount = MAX_MATERIAL_MAPS,
+                          .boneCount = ((model.bones != NULL) && (model.bindPose != NULL))? model.boneCount : 0 };
+
+    #define RMSH_PADDED_SIZE(size) (((size) + 3) & ~3)
+
+    // Compute file data size, worst case for packed indices (3 bytes per index)
+    int fileSize = sizeof(RMSHHeader) + header.materialCount*header.materialMapCount*(sizeof(Color) + sizeof(float)) +
+                   header.boneCount*(sizeof(BoneInfo) + sizeof(Transform));
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        Mesh mesh = model.meshes[i];
+
+        if (mesh.vertices == NULL) return false;
+
+        fileSize += sizeof(RMSHMeshHeader) + mesh.vertexCount*(3*sizeof(float));
+        if (mesh.texcoords != NULL) fileSize += mesh.vertexCount*2*sizeof(float);
+        if (mesh.texcoords2 != NULL) fileSize += mesh.vertexCount*2*sizeof(float);
+        if (mesh.normals != NULL) fileSize += mesh.vertexCount*3*sizeof(float);
+        if (mesh.tangents != NULL) fileSize += mesh.vertexCount*4*sizeof(float);
+        if (mesh.colors != NULL) fileSize += mesh.vertexCount*4;
+        if (mesh.boneIds != NULL) fileSize += mesh.vertexCount*4;
+        if (mesh.boneWeights != NULL) fileSize += mesh.vertexCount*4*sizeof(float);
+        if (mesh.indices != NULL) fileSize += RMSH_PADDED_SIZE(mesh.triangleCount*3*3);
+    }
+
+    unsigned char *fileData = (unsigned char *)RL_CALLOC(fileSize, 1);
+    unsigned char *dataPtr = fileData;
+
+    memcpy(dataPtr, &header, sizeof(RMSHHeader));
+    dataPtr += sizeof(RMSHHeader);
+
+    for (int i = 0; i < header.materialCount; i++)
+    {
+        for (int m = 0; m < header.materialMapCount; m++)
+        {
+            memcpy(dataPtr, &model.materials[i].maps[m].color, sizeof(Color));
+            memcpy(dataPtr + sizeof(Color), &model.materials[i].maps[m].value, sizeof(float));
+            dataPtr += sizeof(Color) + sizeof(float);
+        }
+    }
+
+    if (header.boneCount > 0)
+    {
+        memcpy(dataPtr, model.bones, header.boneCount*sizeof(BoneInfo));
+        dataPtr += header.boneCount*sizeof(BoneInfo);
+        memcpy(dataPtr, model.bindPose, header.boneCount*sizeof(Transform));
+        dataPtr += header.boneCount*sizeof(Transform);
+    }
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        Mesh mesh = model.meshes[i];
+        RMSHMeshHeader meshHeader = { .vertexCount = mesh.vertexCount, .triangleCount = mesh.triangleCount, .streams = RMSH_STREAM_VERTICES };
+
+        if ((model.meshMaterial != NULL) && (header.materialCount > 0)) meshHeader.material = model.meshMaterial[i];
+
+        const void *streams[8] = { mesh.vertices, mesh.texcoords, mesh.texcoords2, mesh.normals, mesh.tangents, mesh.colors, mesh.boneIds, mesh.boneWeights };
+        const int streamSizes[8] = { 3*sizeof(float), 2*sizeof(float), 2*sizeof(float), 3*sizeof(float), 4*sizeof(float), 4, 4, 4*sizeof(float) };
+
+        for (int k = 0; k < 8; k++) if (streams[k] != NULL) meshHeader.streams |= (1u << k);
+
+        // Indices packed after mesh header, only if smaller than raw indices
+        unsigned char *indexData = NULL;
+        if (mesh.indices != NULL)
+        {
+            int indexCount = mesh.triangleCount*3;
+            indexData = (unsigned char *)RL_MALLOC(indexCount*3);
+            meshHeader.indexDataSize = PackMeshIndices(mesh.indices, indexCount, indexData);
+
+            if (meshHeader.indexDataSize < indexCount*(int)sizeof(unsigned short)) meshHeader.streams |= RMSH_STREAM_INDICES_PACKED;
+            else
+            {
+                meshHeader.streams |= RMSH_STREAM_INDICES;
+                meshHeader.indexDataSize = indexCount*sizeof(unsigned short);
+                memcpy(indexData, mesh.indices, meshHeader.indexDataSize);
+            }
+        }
+
+        memcpy(dataPtr, &meshHeader, sizeof(RMSHMeshHeader));
+        dataPtr += sizeof(RMSHMeshHeader);
+
+        for (int k = 0; k < 8; k++)
+        {
+            if (streams[k] != NULL)
+            {
+                memcpy(dataPtr, streams[k], mesh.vertexCount*streamSizes[k]);
+                dataPtr += mesh.vertexCount*streamSizes[k];
+            }
+        }
+
+        if (indexData != NULL)
+        {
+            memcpy(dataPtr, indexData, meshHeader.indexDataSize);
+            dataPtr += RMSH_PADDED_SIZE(meshHeader.indexDataSize);
+            RL_FREE(indexData);
+        }
+    }
+
+    #undef RMSH_PADDED_SIZE
+
+    bool success = SaveFileData(fileName, fileData, (int)(dataPtr - fileData));
+
+    RL_FREE(fileData);
+
+    return success;
+}
+
+// Read RMSH data block (padded to 4 bytes), returns false if not enough data available
+// NOTE: Data is just skipped if no destination provided
+static bool ReadRMSHData(const unsigned char **data, int *dataSize, void *dst, int size)
+{
+    int paddedSize = (size + 3) & ~3;
+
+    if ((size < 0) || (paddedSize > *dataSize)) return false;
+
+    if (dst != NULL) memcpy(dst, *data, size);
+    *data += paddedSize;
+    *dataSize -= paddedSize;
+
+    return true;
+}
+
+// Pack indices as zigzag delta variable length integers, returns packed data size
+// NOTE: Indices of meshes with good vertex locality are mostly packed in 1 byte,
+// packed buffer must be at least 3 bytes per index
+static int PackMeshIndices(const unsigned short *indices, int count, unsigned char *packed)
+{
+    int size = 0;
+    int previous = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        int delta = (int)indices[i] - previous;
+        unsigned int value = (delta >= 0)? ((unsigned int)delta << 1) : (((unsigned int)(-delta) << 1) - 1);
+        previous = indices[i];
+
+        while (value >= 0x80)
+        {
+            packed[size++] = (unsigned char)(value | 0x80);
+            value >>= 7;
+        }
+
+        packed[size++] = (unsigned char)value;
+    }
+
+    return size;
+}
+
+// Unpack indices packed by PackMeshIndices(), returns false if packed data is not valid
+static bool UnpackMeshIndices(const unsigned char *packed, int packedSize, unsigned short *indices, int count)
+{
+    int offset = 0;
+    int previous = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        unsigned int value = 0;
+        int shift = 0;
+
+        do
+        {
+            if ((offset >= packedSize) || (shift > 14)) return false;
+
+            value |= (unsigned int)(packed[offset] & 0x7f) << shift;
+            shift += 7;
+        } while (packed[offset++] & 0x80);
+
+        int delta = (value & 1)? -(int)((value + 1) >> 1) : (int)(value >> 1);
+        previous += delta;
+
+        if ((previous < 0) || (previous > 65535)) return false;
+
+        indices[i] = (unsigned short)previous;
+    }
+
+    return (offset == packedSize);
+}
+#endif
+
 #endif      // SUPPORT_MODULE_RMODELS
@@ -15,6 +15,10 @@
 *       white character of default font [rtext], this way, raylib text and shapes can be draw with
 *       a single draw call and it also allows users to configure it the same way with their own fonts.
 *
+*       Circles, full rings, rounded rectangles and thick lines can be drawn as single anti-aliased quads
+*       evaluated by an SDF shapes shader [rlgl] with SetShapesSdfMode(), no MSAA required. Shape quads
+*       use a dedicated texture, only batch draws using it are drawn with that shader.
+*
 *   CONFIGURATION:
 *       #define SUPPORT_MODULE_RSHAPES
 *           rshapes module is included in the build
@@ -22,6 +26,12 @@
 *       #define SUPPORT_QUADS_DRAW_MODE
 *           Use QUADS instead of TRIANGLES for drawing when possible. Lines-based shapes still use LINES
 *
+*       #define SHAPES_CIRCLE_TABLE_SLOTS
+*       #define SHAPES_CIRCLE_TABLE_MAX_DIVISIONS
+*           Circles, rings, ellipses and rounded rectangles get their points from cached unit circle
+*           tables (cosf/sinf precomputed per number of divisions), define the number of tables kept
+*           and the maximum divisions a table can store, bigger subdivisions are computed per point
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -58,6 +68,7 @@
 #include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), sqrtf(), fabsf()
 #include <float.h>      // Required for: FLT_EPSILON
 #include <stdlib.h>     // Required for: RL_FREE
+#include <string.h>     // Required for: memcpy()
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -70,12 +81,30 @@
 #ifndef SPLINE_SEGMENT_DIVISIONS
     #define SPLINE_SEGMENT_DIVISIONS      24      // Spline segment divisions
 #endif
+#ifndef SHAPES_CIRCLE_TABLE_SLOTS
+    #define SHAPES_CIRCLE_TABLE_SLOTS         16      // Unit circle tables cached (one per number of divisions)
+#endif
+#ifndef SHAPES_CIRCLE_TABLE_MAX_DIVISIONS
+    #define SHAPES_CIRCLE_TABLE_MAX_DIVISIONS 360     // Maximum circle divisions stored in a unit circle table
+#endif
+#ifndef SHAPES_SDF_EDGE_MARGIN
+    #define SHAPES_SDF_EDGE_MARGIN          1.0f    // SDF shapes quads extension to fit the anti-aliased edge (units)
+#endif
+#ifndef SHAPES_CIRCLE_DIVISIONS_SLOTS
+    #define SHAPES_CIRCLE_DIVISIONS_SLOTS     16      // Smooth circle divisions cached (one per radius)
+#endif
 
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// Not here...
+// Circle arc points source, unit circle points are read from a cached table when
+// the arc matches a full circle subdivision, otherwise they are computed per point
+typedef struct ShapesArc {
+    const Vector2 *table;       // Unit circle points of the arc (NULL if not available)
+    float startAngle;           // Arc start angle (degrees)
+    float stepLength;           // Arc angle between points (degrees)
+} ShapesArc;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -83,10 +112,26 @@
 Texture2D texShapes = { 1, 1, 1, 1, 7 };                // Texture used on shapes drawing (white pixel loaded by rlgl)
 Rectangle texShapesRec = { 0.0f, 0.0f, 1.0f, 1.0f };    // Texture source rectangle used on shapes drawing
 
+static Vector2 circleTables[SHAPES_CIRCLE_TABLE_SLOTS][SHAPES_CIRCLE_TABLE_MAX_DIVISIONS + 1] = { 0 };  // Unit circle points tables
+static int circleTablesDivisions[SHAPES_CIRCLE_TABLE_SLOTS] = { 0 };    // Divisions of every cached table (0 = empty slot)
+static int circleTablesNext = 0;                                        // Next table slot to replace when cache is full
+
+static float circleDivisionsRadius[SHAPES_CIRCLE_DIVISIONS_SLOTS] = { 0 };  // Radius of every cached smooth circle divisions
+static float circleDivisionsValue[SHAPES_CIRCLE_DIVISIONS_SLOTS] = { 0 };   // Smooth circle divisions cached (0 = empty slot)
+
+static bool shapesSdfMode = false;      // Shapes SDF mode enabled, see SetShapesSdfMode()
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static float EaseCubicInOut(float t, float b, float c, float d);    // Cubic easing
+static void DrawShapesQuad(Vector2 topLeft, Vector2 bottomLeft, Vector2 bottomRight, Vector2 topRight, const Color *colors); // Draw shapes texture quad (4 vertex colors)
+static float GetCircleDivisions(float radius);                      // Get number of divisions for a smooth full circle (cached per radius)
+static const Vector2 *GetCircleTable(int divisions);                // Get unit circle points table for a number of divisions (cached)
+static ShapesArc GetShapesArc(float startAngle, float stepLength, int segments); // Get unit circle points source for an arc
+static inline Vector2 GetShapesArcPoint(ShapesArc arc, int index);  // Get unit circle point of an arc
+static bool IsShapesSdfAvailable(void);                             // Check if shapes can be drawn as SDF quads (SDF mode enabled, default shader)
+static void DrawShapeQuadSdf(Vector2 center, Vector2 axis, Vector2 halfSize, int kind, float param, Color color); // Draw shape quad evaluated by SDF shapes shader
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -112,6 +157,14 @@ void SetShapesTexture(Texture2D texture, Rectangle source)
     }
 }
 
+// Set shapes SDF mode, circles, full rings, rounded rectangles and thick lines are drawn as single
+// anti-aliased quads evaluated by the SDF shapes shader, segments parameters are ignored
+// NOTE: Shapes are still tessellated if a user shader is enabled with BeginShaderMode()
+void SetShapesSdfMode(bool enabled)
+{
+    shapesSdfMode = enabled;
+}
+
 // Draw a pixel
 void DrawPixel(int posX, int posY, Color color)
 {
@@ -244,6 +297,14 @@ void DrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color)
 
     if ((length > 0) && (thick > 0))
     {
+        if (IsShapesSdfAvailable())
+        {
+            Vector2 center = { (startPos.x + endPos.x)/2.0f, (startPos.y + endPos.y)/2.0f };
+
+            DrawShapeQuadSdf(center, (Vector2){ delta.x/length, delta.y/length }, (Vector2){ length/2.0f, thick/2.0f }, 0, 0.0f, color);
+            return;
+        }
+
         float scale = thick/(2*length);
 
         Vector2 radius = { -scale*delta.y, scale*delta.x };
@@ -268,7 +329,8 @@ void DrawCircle(int centerX, int centerY, float radius, Color color)
 // NOTE: On OpenGL 3.3 and ES2 we use QUADS to avoid drawing order issues
 void DrawCircleV(Vector2 center, float radius, Color color)
 {
-    DrawCircleSector(center, radius, 0, 360, 36, color);
+    if ((radius > 0.0f) && IsShapesSdfAvailable()) DrawShapeQuadSdf(center, (Vector2){ 1.0f, 0.0f }, (Vector2){ radius, radius }, 0, 1.0f, color);
+    else DrawCircleSector(center, radius, 0, 360, 36, color);
 }
 
 // Draw a piece of a circle
@@ -289,15 +351,17 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
 
     if (segments < minSegments)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        // Calculate the number of segments based on the error rate (usually 0.5f)
+        segments = (int)((endAngle - startAngle)*GetCircleDivisions(radius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
 
     float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    ShapesArc arc = GetShapesArc(startAngle, stepLength, segments);
+
+    // NOTE: Every arc point is computed once, shared by consecutive segments
+    Vector2 p0 = GetShapesArcPoint(arc, 0);
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(texShapes.id);
@@ -307,36 +371,41 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
         // NOTE: Every QUAD actually represents two segments
         for (int i = 0; i < segments/2; i++)
         {
+            Vector2 p1 = GetShapesArcPoint(arc, 2*i + 1);
+            Vector2 p2 = GetShapesArcPoint(arc, 2*i + 2);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength*2.0f))*radius, center.y + sinf(DEG2RAD*(angle + stepLength*2.0f))*radius);
+            rlVertex2f(center.x + p2.x*radius, center.y + p2.y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + p1.x*radius, center.y + p1.y*radius);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + p0.x*radius, center.y + p0.y*radius);
 
-            angle += (stepLength*2.0f);
+            p0 = p2;
         }
 
         // NOTE: In case number of segments is odd, we add one last piece to the cake
         if ((segments%2) == 1)
         {
+            Vector2 p1 = GetShapesArcPoint(arc, segments);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + p1.x*radius, center.y + p1.y*radius);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + p0.x*radius, center.y + p0.y*radius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
             rlVertex2f(center.x, center.y);
@@ -349,13 +418,15 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle, float endA
     rlBegin(RL_TRIANGLES);
         for (int i = 0; i < segments; i++)
         {
+            Vector2 p1 = GetShapesArcPoint(arc, i + 1);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + p1.x*radius, center.y + p1.y*radius);
+            rlVertex2f(center.x + p0.x*radius, center.y + p0.y*radius);
 
-            angle += stepLength;
+            p0 = p1;
         }
     rlEnd();
 #endif
@@ -379,15 +450,15 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
 
     if (segments < minSegments)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        // Calculate the number of segments based on the error rate (usually 0.5f)
+        segments = (int)((endAngle - startAngle)*GetCircleDivisions(radius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
 
     float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    ShapesArc arc = GetShapesArc(startAngle, stepLength, segments);
+    Vector2 p0 = GetShapesArcPoint(arc, 0);
     bool showCapLines = true;
 
     rlBegin(RL_LINES);
@@ -395,24 +466,26 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + p0.x*radius, center.y + p0.y*radius);
         }
 
         for (int i = 0; i < segments; i++)
         {
+            Vector2 p1 = GetShapesArcPoint(arc, i + 1);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + p0.x*radius, center.y + p0.y*radius);
+            rlVertex2f(center.x + p1.x*radius, center.y + p1.y*radius);
 
-            angle += stepLength;
+            p0 = p1;
         }
 
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + p0.x*radius, center.y + p0.y*radius);
         }
     rlEnd();
 }
@@ -421,15 +494,17 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle, float
 // NOTE: Gradient goes from center (color1) to border (color2)
 void DrawCircleGradient(int centerX, int centerY, float radius, Color color1, Color color2)
 {
+    const Vector2 *points = GetCircleTable(36);
+
     rlBegin(RL_TRIANGLES);
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < 36; i++)
         {
             rlColor4ub(color1.r, color1.g, color1.b, color1.a);
             rlVertex2f((float)centerX, (float)centerY);
             rlColor4ub(color2.r, color2.g, color2.b, color2.a);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*(i + 10))*radius, (float)centerY + sinf(DEG2RAD*(i + 10))*radius);
+            rlVertex2f((float)centerX + points[i + 1].x*radius, (float)centerY + points[i + 1].y*radius);
             rlColor4ub(color2.r, color2.g, color2.b, color2.a);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*i)*radius, (float)centerY + sinf(DEG2RAD*i)*radius);
+            rlVertex2f((float)centerX + points[i].x*radius, (float)centerY + points[i].y*radius);
         }
     rlEnd();
 }
@@ -443,14 +518,16 @@ void DrawCircleLines(int centerX, int centerY, float radius, Color color)
 // Draw circle outline (Vector version)
 void DrawCircleLinesV(Vector2 center, float radius, Color color)
 {
+    const Vector2 *points = GetCircleTable(36);
+
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
 
-        // NOTE: Circle outline is drawn pixel by pixel every degree (0 to 360)
-        for (int i = 0; i < 360; i += 10)
+        // NOTE: Circle outline is drawn with a line every 10 degrees (0 to 360)
+        for (int i = 0; i < 36; i++)
         {
-            rlVertex2f(center.x + cosf(DEG2RAD*i)*radius, center.y + sinf(DEG2RAD*i)*radius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(i + 10))*radius, center.y + sinf(DEG2RAD*(i + 10))*radius);
+            rlVertex2f(center.x + points[i].x*radius, center.y + points[i].y*radius);
+            rlVertex2f(center.x + points[i + 1].x*radius, center.y + points[i + 1].y*radius);
         }
     rlEnd();
 }
@@ -458,13 +535,15 @@ void DrawCircleLinesV(Vector2 center, float radius, Color color)
 // Draw ellipse
 void DrawEllipse(int centerX, int centerY, float radiusH, float radiusV, Color color)
 {
+    const Vector2 *points = GetCircleTable(36);
+
     rlBegin(RL_TRIANGLES);
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < 36; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f((float)centerX, (float)centerY);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*(i + 10))*radiusH, (float)centerY + sinf(DEG2RAD*(i + 10))*radiusV);
-            rlVertex2f((float)centerX + cosf(DEG2RAD*i)*radiusH, (float)centerY + sinf(DEG2RAD*i)*radiusV);
+            rlVertex2f((float)centerX + points[i + 1].x*radiusH, (float)centerY + points[i + 1].y*radiusV);
+            rlVertex2f((float)centerX + points[i].x*radiusH, (float)centerY + points[i].y*radiusV);
         }
     rlEnd();
 }
@@ -472,12 +551,14 @@ void DrawEllipse(int centerX, int centerY, float radiusH, float radiusV, Color c
 // Draw ellipse outline
 void DrawEllipseLines(int centerX, int centerY, float radiusH, float radiusV, Color color)
 {
+    const Vector2 *points = GetCircleTable(36);
+
     rlBegin(RL_LINES);
-        for (int i = 0; i < 360; i += 10)
+        for (int i = 0; i < 36; i++)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(centerX + cosf(DEG2RAD*(i + 10))*radiusH, centerY + sinf(DEG2RAD*(i + 10))*radiusV);
-            rlVertex2f(centerX + cosf(DEG2RAD*i)*radiusH, centerY + sinf(DEG2RAD*i)*radiusV);
+            rlVertex2f(centerX + points[i + 1].x*radiusH, centerY + points[i + 1].y*radiusV);
+            rlVertex2f(centerX + points[i].x*radiusH, centerY + points[i].y*radiusV);
         }
     rlEnd();
 }
@@ -506,13 +587,19 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
         endAngle = tmp;
     }
 
+    // Full ring drawn as a single quad in SDF mode
+    if (((endAngle - startAngle) >= 360.0f) && (outerRadius > 0.0f) && IsShapesSdfAvailable())
+    {
+        DrawShapeQuadSdf(center, (Vector2){ 1.0f, 0.0f }, (Vector2){ outerRadius, outerRadius }, 1, fmaxf(innerRadius, 0.0f)/outerRadius, color);
+        return;
+    }
+
     int minSegments = (int)ceilf((endAngle - startAngle)/90);
 
     if (segments < minSegments)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        // Calculate the number of segments based on the error rate (usually 0.5f)
+        segments = (int)((endAngle - startAngle)*GetCircleDivisions(outerRadius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
@@ -525,7 +612,8 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
     }
 
     float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    ShapesArc arc = GetShapesArc(startAngle, stepLength, segments);
+    Vector2 p0 = GetShapesArcPoint(arc, 0);
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(texShapes.id);
@@ -533,21 +621,23 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
     rlBegin(RL_QUADS);
         for (int i = 0; i < segments; i++)
         {
+            Vector2 p1 = GetShapesArcPoint(arc, i + 1);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+            rlVertex2f(center.x + p0.x*outerRadius, center.y + p0.y*outerRadius);
 
             rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + p0.x*innerRadius, center.y + p0.y*innerRadius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
+            rlVertex2f(center.x + p1.x*innerRadius, center.y + p1.y*innerRadius);
 
             rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
+            rlVertex2f(center.x + p1.x*outerRadius, center.y + p1.y*outerRadius);
 
-            angle += stepLength;
+            p0 = p1;
         }
     rlEnd();
 
@@ -556,17 +646,19 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius, float startA
     rlBegin(RL_TRIANGLES);
         for (int i = 0; i < segments; i++)
         {
+            Vector2 p1 = GetShapesArcPoint(arc, i + 1);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+            rlVertex2f(center.x + p0.x*innerRadius, center.y + p0.y*innerRadius);
+            rlVertex2f(center.x + p1.x*innerRadius, center.y + p1.y*innerRadius);
+            rlVertex2f(center.x + p0.x*outerRadius, center.y + p0.y*outerRadius);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+            rlVertex2f(center.x + p1.x*innerRadius, center.y + p1.y*innerRadius);
+            rlVertex2f(center.x + p1.x*outerRadius, center.y + p1.y*outerRadius);
+            rlVertex2f(center.x + p0.x*outerRadius, center.y + p0.y*outerRadius);
 
-            angle += stepLength;
+            p0 = p1;
         }
     rlEnd();
 #endif
@@ -600,9 +692,8 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
 
     if (segments < minSegments)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*PI/th)/360);
+        // Calculate the number of segments based on the error rate (usually 0.5f)
+        segments = (int)((endAngle - startAngle)*GetCircleDivisions(outerRadius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
@@ -614,35 +705,38 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius, float s
     }
 
     float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    ShapesArc arc = GetShapesArc(startAngle, stepLength, segments);
+    Vector2 p0 = GetShapesArcPoint(arc, 0);
     bool showCapLines = true;
 
     rlBegin(RL_LINES);
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + p0.x*outerRadius, center.y + p0.y*outerRadius);
+            rlVertex2f(center.x + p0.x*innerRadius, center.y + p0.y*innerRadius);
         }
 
         for (int i = 0; i < segments; i++)
         {
+            Vector2 p1 = GetShapesArcPoint(arc, i + 1);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
+            rlVertex2f(center.x + p0.x*outerRadius, center.y + p0.y*outerRadius);
+            rlVertex2f(center.x + p1.x*outerRadius, center.y + p1.y*outerRadius);
 
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
+            rlVertex2f(center.x + p0.x*innerRadius, center.y + p0.y*innerRadius);
+            rlVertex2f(center.x + p1.x*innerRadius, center.y + p1.y*innerRadius);
 
-            angle += stepLength;
+            p0 = p1;
         }
 
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + p0.x*outerRadius, center.y + p0.y*outerRadius);
+            rlVertex2f(center.x + p0.x*innerRadius, center.y + p0.y*innerRadius);
         }
     rlEnd();
 }
@@ -707,28 +801,8 @@ void DrawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color
     }
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
-    rlSetTexture(texShapes.id);
-
-    rlBegin(RL_QUADS);
-
-        rlNormal3f(0.0f, 0.0f, 1.0f);
-        rlColor4ub(color.r, color.g, color.b, color.a);
-
-        rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-        rlVertex2f(topLeft.x, topLeft.y);
-
-        rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-        rlVertex2f(bottomLeft.x, bottomLeft.y);
-
-        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-        rlVertex2f(bottomRight.x, bottomRight.y);
-
-        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-        rlVertex2f(topRight.x, topRight.y);
-
-    rlEnd();
-
-    rlSetTexture(0);
+    Color colors[4] = { color, color, color, color };
+    DrawShapesQuad(topLeft, bottomLeft, bottomRight, topRight, colors);
 #else
     rlBegin(RL_TRIANGLES);
 
@@ -764,30 +838,10 @@ void DrawRectangleGradientH(int posX, int posY, int width, int height, Color col
 // NOTE: Colors refer to corners, starting at top-lef corner and counter-clockwise
 void DrawRectangleGradientEx(Rectangle rec, Color col1, Color col2, Color col3, Color col4)
 {
-    rlSetTexture(texShapes.id);
+    Color colors[4] = { col1, col2, col3, col4 };
 
-    rlBegin(RL_QUADS);
-        rlNormal3f(0.0f, 0.0f, 1.0f);
-
-        // NOTE: Default raylib font character 95 is a white square
-        rlColor4ub(col1.r, col1.g, col1.b, col1.a);
-        rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-        rlVertex2f(rec.x, rec.y);
-
-        rlColor4ub(col2.r, col2.g, col2.b, col2.a);
-        rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-        rlVertex2f(rec.x, rec.y + rec.height);
-
-        rlColor4ub(col3.r, col3.g, col3.b, col3.a);
-        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-        rlVertex2f(rec.x + rec.width, rec.y + rec.height);
-
-        rlColor4ub(col4.r, col4.g, col4.b, col4.a);
-        rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-        rlVertex2f(rec.x + rec.width, rec.y);
-    rlEnd();
-
-    rlSetTexture(0);
+    DrawShapesQuad((Vector2){ rec.x, rec.y }, (Vector2){ rec.x, rec.y + rec.height },
+        (Vector2){ rec.x + rec.width, rec.y + rec.height }, (Vector2){ rec.x + rec.width, rec.y }, colors);
 }
 
 // Draw rectangle outline
@@ -864,12 +918,19 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
     float radius = (rec.width > rec.height)? (rec.height*roundness)/2 : (rec.width*roundness)/2;
     if (radius <= 0.0f) return;
 
+    if (IsShapesSdfAvailable())
+    {
+        Vector2 center = { rec.x + rec.width/2.0f, rec.y + rec.height/2.0f };
+
+        DrawShapeQuadSdf(center, (Vector2){ 1.0f, 0.0f }, (Vector2){ rec.width/2.0f, rec.height/2.0f }, 0, roundness, color);
+        return;
+    }
+
     // Calculate number of segments to use for the corners
     if (segments < 4)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)(ceilf(2*PI/th)/4.0f);
+        // Calculate the number of segments based on the error rate (usually 0.5f)
+        segments = (int)(GetCircleDivisions(radius)/4.0f);
         if (segments <= 0) segments = 4;
     }
 
@@ -910,40 +971,46 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
         // Draw all the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
         for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
         {
-            float angle = angles[k];
+            ShapesArc arc = GetShapesArc(angles[k], stepLength, segments);
+            Vector2 p0 = GetShapesArcPoint(arc, 0);
             const Vector2 center = centers[k];
 
             // NOTE: Every QUAD actually represents two segments
             for (int i = 0; i < segments/2; i++)
             {
+                Vector2 p1 = GetShapesArcPoint(arc, 2*i + 1);
+                Vector2 p2 = GetShapesArcPoint(arc, 2*i + 2);
+
                 rlColor4ub(color.r, color.g, color.b, color.a);
                 rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
 
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength*2))*radius, center.y + sinf(DEG2RAD*(angle + stepLength*2))*radius);
+                rlVertex2f(center.x + p2.x*radius, center.y + p2.y*radius);
 
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+                rlVertex2f(center.x + p1.x*radius, center.y + p1.y*radius);
 
                 rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+                rlVertex2f(center.x + p0.x*radius, center.y + p0.y*radius);
 
-                angle += (stepLength*2);
+                p0 = p2;
             }
 
             // NOTE: In case number of segments is odd, we add one last piece to the cake
             if (segments%2)
             {
+                Vector2 p1 = GetShapesArcPoint(arc, segments);
+
                 rlColor4ub(color.r, color.g, color.b, color.a);
                 rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
 
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
+                rlVertex2f(center.x + p1.x*radius, center.y + p1.y*radius);
 
                 rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
+                rlVertex2f(center.x + p0.x*radius, center.y + p0.y*radius);
 
                 rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
@@ -1013,15 +1080,17 @@ void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color co
         // Draw all of the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
         for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
         {
-            float angle = angles[k];
+            ShapesArc arc = GetShapesArc(angles[k], stepLength, segments);
+            Vector2 p0 = GetShapesArcPoint(arc, 0);
             const Vector2 center = centers[k];
             for (int i = 0; i < segments; i++)
             {
+                Vector2 p1 = GetShapesArcPoint(arc, i + 1);
                 rlColor4ub(color.r, color.g, color.b, color.a);
                 rlVertex2f(center.x, center.y);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
-                rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-                angle += stepLength;
+                rlVertex2f(center.x + p1.x*radius, center.y + p1.y*radius);
+                rlVertex2f(center.x + p0.x*radius, center.y + p0.y*radius);
+                p0 = p1;
             }
         }
 
@@ -1094,9 +1163,8 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
     // Calculate number of segments to use for the corners
     if (segments < 4)
     {
-        // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)(ceilf(2*PI/th)/2.0f);
+        // Calculate the number of segments based on the error rate (usually 0.5f)
+        segments = (int)(GetCircleDivisions(radius)/2.0f);
         if (segments <= 0) segments = 4;
     }
 
@@ -1146,25 +1214,28 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
             // Draw all the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                ShapesArc arc = GetShapesArc(angles[k], stepLength, segments);
+                Vector2 p0 = GetShapesArcPoint(arc, 0);
                 const Vector2 center = centers[k];
                 for (int i = 0; i < segments; i++)
                 {
+                    Vector2 p1 = GetShapesArcPoint(arc, i + 1);
+
                     rlColor4ub(color.r, color.g, color.b, color.a);
 
                     rlTexCoord2f(texShapesRec.x/texShapes.width, texShapesRec.y/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
+                    rlVertex2f(center.x + p0.x*innerRadius, center.y + p0.y*innerRadius);
 
                     rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, texShapesRec.y/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
+                    rlVertex2f(center.x + p1.x*innerRadius, center.y + p1.y*innerRadius);
 
                     rlTexCoord2f((texShapesRec.x + texShapesRec.width)/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
+                    rlVertex2f(center.x + p1.x*outerRadius, center.y + p1.y*outerRadius);
 
                     rlTexCoord2f(texShapesRec.x/texShapes.width, (texShapesRec.y + texShapesRec.height)/texShapes.height);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+                    rlVertex2f(center.x + p0.x*outerRadius, center.y + p0.y*outerRadius);
 
-                    angle += stepLength;
+                    p0 = p1;
                 }
             }
 
@@ -1220,22 +1291,25 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
             // Draw all of the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                ShapesArc arc = GetShapesArc(angles[k], stepLength, segments);
+                Vector2 p0 = GetShapesArcPoint(arc, 0);
                 const Vector2 center = centers[k];
 
                 for (int i = 0; i < segments; i++)
                 {
+                    Vector2 p1 = GetShapesArcPoint(arc, i + 1);
+
                     rlColor4ub(color.r, color.g, color.b, color.a);
 
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*innerRadius, center.y + sinf(DEG2RAD*angle)*innerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+                    rlVertex2f(center.x + p0.x*innerRadius, center.y + p0.y*innerRadius);
+                    rlVertex2f(center.x + p1.x*innerRadius, center.y + p1.y*innerRadius);
+                    rlVertex2f(center.x + p0.x*outerRadius, center.y + p0.y*outerRadius);
 
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*innerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
+                    rlVertex2f(center.x + p1.x*innerRadius, center.y + p1.y*innerRadius);
+                    rlVertex2f(center.x + p1.x*outerRadius, center.y + p1.y*outerRadius);
+                    rlVertex2f(center.x + p0.x*outerRadius, center.y + p0.y*outerRadius);
 
-                    angle += stepLength;
+                    p0 = p1;
                 }
             }
 
@@ -1285,15 +1359,17 @@ void DrawRectangleRoundedLines(Rectangle rec, float roundness, int segments, flo
             // Draw all the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                ShapesArc arc = GetShapesArc(angles[k], stepLength, segments);
+                Vector2 p0 = GetShapesArcPoint(arc, 0);
                 const Vector2 center = centers[k];
 
                 for (int i = 0; i < segments; i++)
                 {
+                    Vector2 p1 = GetShapesArcPoint(arc, i + 1);
                     rlColor4ub(color.r, color.g, color.b, color.a);
-                    rlVertex2f(center.x + cosf(DEG2RAD*angle)*outerRadius, center.y + sinf(DEG2RAD*angle)*outerRadius);
-                    rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(DEG2RAD*(angle + stepLength))*outerRadius);
-                    angle += stepLength;
+                    rlVertex2f(center.x + p0.x*outerRadius, center.y + p0.y*outerRadius);
+                    rlVertex2f(center.x + p1.x*outerRadius, center.y + p1.y*outerRadius);
+                    p0 = p1;
                 }
             }
 
@@ -2230,6 +2306,176 @@ Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2)
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
 
+// Draw shapes texture quad (4 vertex colors)
+// NOTE: Quad is written directly into the render batch, vertex order: top-left, bottom-left, bottom-right, top-right
+static void DrawShapesQuad(Vector2 topLeft, Vector2 bottomLeft, Vector2 bottomRight, Vector2 topRight, const Color *colors)
+{
+    float left = texShapesRec.x/texShapes.width;
+    float right = (texShapesRec.x + texShapesRec.width)/texShapes.width;
+    float top = texShapesRec.y/texShapes.height;
+    float bottom = (texShapesRec.y + texShapesRec.height)/texShapes.height;
+
+    rlQuadBuffer quad = rlBeginQuads(texShapes.id, 1);
+
+        const Vector2 positions[4] = { topLeft, bottomLeft, bottomRight, topRight };
+        const float texcoords[8] = { left, top, left, bottom, right, bottom, right, top };
+
+        for (int i = 0; i < 4; i++)
+        {
+            float *position = RL_QUAD_POSITION(quad, i);
+            position[0] = positions[i].x;
+            position[1] = positions[i].y;
+            position[2] = quad.depth;
+
+            memcpy(RL_QUAD_TEXCOORD(quad, i), texcoords + i*2, 2*sizeof(float));
+            memcpy(RL_QUAD_COLOR(quad, i), &colors[i], sizeof(Color));
+        }
+
+    rlEndQuads(1);
+
+    rlSetTexture(0);
+}
+
+// Get number of divisions for a smooth full circle of given radius
+// NOTE: Result is cached per radius, shapes usually repeat the same radius every frame
+static float GetCircleDivisions(float radius)
+{
+    unsigned int bits = 0;
+    memcpy(&bits, &radius, sizeof(float));
+
+    int slot = (int)((bits ^ (bits >> 13))%SHAPES_CIRCLE_DIVISIONS_SLOTS);
+
+    if ((circleDivisionsValue[slot] > 0.0f) && (circleDivisionsRadius[slot] == radius)) return circleDivisionsValue[slot];
+
+    // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
+    float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
+    float divisions = ceilf(2*PI/th);
+
+    circleDivisionsRadius[slot] = radius;
+    circleDivisionsValue[slot] = divisions;
+
+    return divisions;
+}
+
+// Get unit circle points table for a number of divisions, (divisions + 1) points are provided
+// NOTE: Last point matches the first one, so full circles are closed without cracks
+static const Vector2 *GetCircleTable(int divisions)
+{
+    for (int i = 0; i < SHAPES_CIRCLE_TABLE_SLOTS; i++)
+    {
+        if (circleTablesDivisions[i] == divisions) return circleTables[i];
+    }
+
+    // Table not cached, replace the next slot
+    int slot = circleTablesNext;
+    circleTablesNext = (circleTablesNext + 1)%SHAPES_CIRCLE_TABLE_SLOTS;
+
+    Vector2 *table = circleTables[slot];
+
+    for (int i = 0; i < divisions; i++)
+    {
+        float angle = DEG2RAD*(360.0f*(float)i/(float)divisions);
+        table[i] = (Vector2){ cosf(angle), sinf(angle) };
+    }
+
+    table[divisions] = table[0];
+    circleTablesDivisions[slot] = divisions;
+
+    return table;
+}
+
+// Get unit circle points source for an arc of (segments + 1) points
+// NOTE: A cached table is used when the arc is a full circle subdivision starting on one of
+// its points, it's the case of circles, full rings and rounded rectangles corners
+static ShapesArc GetShapesArc(float startAngle, float stepLength, int segments)
+{
+    ShapesArc arc = { NULL, startAngle, stepLength };
+
+    if ((stepLength <= 0.0f) || (startAngle < 0.0f)) return arc;
+
+    float divisions = 360.0f/stepLength;
+    float start = startAngle/stepLength;
+    int divisionsCount = (int)(divisions + 0.5f);
+    int startIndex = (int)(start + 0.5f);
+
+    if ((divisionsCount > 0) && (divisionsCount <= SHAPES_CIRCLE_TABLE_MAX_DIVISIONS) &&
+        (fabsf(divisions - (float)divisionsCount) < 0.001f) && (fabsf(start - (float)startIndex) < 0.001f) &&
+        ((startIndex + segments) <= divisionsCount))
+    {
+        arc.table = GetCircleTable(divisionsCount) + startIndex;
+    }
+
+    return arc;
+}
+
+// Get unit circle point of an arc
+static inline Vector2 GetShapesArcPoint(ShapesArc arc, int index)
+{
+    if (arc.table != NULL) return arc.table[index];
+
+    float angle = DEG2RAD*(arc.startAngle + arc.stepLength*(float)index);
+
+    return (Vector2){ cosf(angle), sinf(angle) };
+}
+
+// Check if shapes can be drawn as SDF quads: SDF mode enabled, SDF shapes shader supported and default shader enabled
+// NOTE: A user shader enabled with BeginShaderMode() is kept, shapes are tessellated in that case
+static bool IsShapesSdfAvailable(void)
+{
+    bool available = false;
+
+    // NOTE: SDF shapes shader is loaded on first SDF shape drawn
+    if (shapesSdfMode && (rlGetShaderIdCurrent() == rlGetShaderIdDefault())) available = (rlGetShaderIdSdfShapes() > 0);
+
+    return available;
+}
+
+// Draw shape quad evaluated by SDF shapes shader, shape kind: 0 - rounded box (param: roundness), 1 - ring (param: inner radius/radius)
+// NOTE: Shape is defined by its center, unit direction of its local x axis and half-size,
+// shape kind and parameter are encoded as texcoords cells offsets, see rlLoadShaderSdfShapes() [rlgl]
+// NOTE: Quad is drawn with SDF shapes texture, batch draws using it are drawn with SDF shapes shader
+static void DrawShapeQuadSdf(Vector2 center, Vector2 axis, Vector2 halfSize, int kind, float param, Color color)
+{
+    if (param < 0.0f) param = 0.0f;
+    else if (param > 1.0f) param = 1.0f;
+
+    // Quad is extended to fit the anti-aliased edge, texcoords must stay in (-2.0, 2.0) range around the offsets
+    Vector2 extent = { halfSize.x + fminf(SHAPES_SDF_EDGE_MARGIN, 0.9f*halfSize.x), halfSize.y + fminf(SHAPES_SDF_EDGE_MARGIN, 0.9f*halfSize.y) };
+    Vector2 texExtent = { extent.x/halfSize.x, extent.y/halfSize.y };
+
+    // Shape code (kind*256 + param level) split in 32x16 cells centered on origin, small offsets keep texcoords precision
+    int code = kind*256 + (int)(param*254.0f + 0.5f);
+    float texOffsetX = 4.0f*(float)(code%32 - 16);
+    float texOffsetY = 4.0f*(float)(code/32 - 8);
+
+    Vector2 axisX = { axis.x*extent.x, axis.y*extent.x };
+    Vector2 axisY = { -axis.y*extent.y, axis.x*extent.y };
+
+    rlSetTexture(rlGetTextureIdSdfShapes());
+
+    rlBegin(RL_QUADS);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+
+        // Top-left corner
+        rlTexCoord2f(texOffsetX - texExtent.x, texOffsetY - texExtent.y);
+        rlVertex2f(center.x - axisX.x - axisY.x, center.y - axisX.y - axisY.y);
+
+        // Bottom-left corner
+        rlTexCoord2f(texOffsetX - texExtent.x, texOffsetY + texExtent.y);
+        rlVertex2f(center.x - axisX.x + axisY.x, center.y - axisX.y + axisY.y);
+
+        // Bottom-right corner
+        rlTexCoord2f(texOffsetX + texExtent.x, texOffsetY + texExtent.y);
+        rlVertex2f(center.x + axisX.x + axisY.x, center.y + axisX.y + axisY.y);
+
+        // Top-right corner
+        rlTexCoord2f(texOffsetX + texExtent.x, texOffsetY - texExtent.y);
+        rlVertex2f(center.x + axisX.x - axisY.x, center.y + axisX.y - axisY.y);
+    rlEnd();
+
+    rlSetTexture(0);
+}
+
 // Cubic easing in-out
 // NOTE: Used by DrawLineBezier() only
 static float EaseCubicInOut(float t, float b, float c, float d)
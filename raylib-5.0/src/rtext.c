@@ -66,7 +66,7 @@
 
 #include <stdlib.h>         // Required for: malloc(), free()
 #include <stdio.h>          // Required for: vsprintf()
-#include <string.h>         // Required for: strcmp(), strstr(), strcpy(), strncpy() [Used in TextReplace()], sscanf() [Used in LoadBMFont()]
+#include <string.h>         // Required for: strcmp(), strstr(), strcpy(), strncpy() [Used in TextReplace()], sscanf() [Used in LoadBMFont()], memcpy()
 #include <stdarg.h>         // Required for: va_list, va_start(), vsprintf(), va_end() [Used in TextFormat()]
 #include <ctype.h>          // Required for: toupper(), tolower() [Used in TextToUpper(), TextToLower()]
 
@@ -101,11 +101,79 @@
 #ifndef MAX_TEXTSPLIT_COUNT
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
 #endif
+#ifndef FONT_TTF_GLYPHS_PER_WORKER
+    #define FONT_TTF_GLYPHS_PER_WORKER            64        // Minimum number of glyphs rasterized by every worker: LoadFontData()
+#endif
+#ifndef MAX_DYNAMIC_FONTS
+    #define MAX_DYNAMIC_FONTS                      8        // Maximum number of dynamic fonts loaded at the same time: LoadFontDynamic()
+#endif
+#ifndef MAX_SDF_FONTS
+    #define MAX_SDF_FONTS                          8        // Maximum number of SDF fonts loaded at the same time: LoadFontSdf()
+#endif
+#ifndef FONT_CACHE_MAX_ATLAS_SIZE
+    #define FONT_CACHE_MAX_ATLAS_SIZE      16384        // Maximum font cache atlas width/height, larger cache atlas is not valid
+#endif
+#ifndef FONT_CACHE_FILE_EXT
+    #define FONT_CACHE_FILE_EXT         ".fontcache"        // Font cache file extension, in "<userCacheDir>/raylib/fonts": LoadFontEx(), LoadFontSdf()
+#endif
+#ifndef TEXT_GLYPH_QUADS_CHUNK
+    #define TEXT_GLYPH_QUADS_CHUNK               256        // Maximum number of glyph quads written together into render batch: DrawTextEx(), DrawTextCodepoints()
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Font glyphs rasterization job, shared by all workers: LoadFontData()
+typedef struct FontGlyphsJob {
+    const unsigned char *fileData;  // TTF file data
+    int fontSize;                   // Font size to rasterize glyphs
+    int type;                       // Font type (FontType)
+    const int *codepoints;          // Codepoints to rasterize
+    int codepointCount;             // Number of codepoints
+    GlyphInfo *glyphs;              // Output glyphs data (codepointCount)
+} FontGlyphsJob;
+
+// Dynamic font glyphs cache, glyphs are rasterized on first use into fixed-size atlas cells
+// NOTE: Font is passed by value, so the cache is found by its glyphs array and the atlas texture never changes
+typedef struct DynamicFontCache {
+    Font font;                      // Font data shared with user copies (glyphs, recs and texture)
+    unsigned char *fileData;        // TTF file data, required by fontInfo
+    stbtt_fontinfo fontInfo;        // TTF font info for glyphs rasterization
+    float scaleFactor;              // Font scale factor for baseSize
+    int ascent;                     // Font ascent scaled to baseSize
+    int cellWidth;                  // Atlas cell width (including padding)
+    int cellHeight;                 // Atlas cell height (including padding)
+    int columns;                    // Atlas cells per row
+    int glyphsUsed;                 // Number of atlas cells already used
+    int bucketCount;                // Codepoints lookup buckets count (power of two)
+    int *buckets;                   // Codepoints lookup buckets, first glyph index or -1
+    int *next;                      // Next glyph index in the same bucket or -1
+    unsigned int *lastUse;          // Glyphs last use stamp, least recently used glyph is evicted first
+    unsigned int useCounter;        // Current use stamp
+} DynamicFontCache;
+
+#if defined(SUPPORT_FONT_CACHE)
+// Font cache file header, followed by data (optionally compressed): glyphs recs (Rectangle),
+// glyphs metrics (value, offsetX, offsetY, advanceX as int) and atlas pixels (GRAY_ALPHA)
+typedef struct FontCacheHeader {
+    char id[4];                     // Cache file identifier: "rFNT"
+    int version;                    // Cache file version
+    int type;                       // Font type (FontType)
+    int fontSize;                   // Font size used on glyphs generation
+    int glyphCount;                 // Number of glyphs
+    int glyphPadding;               // Glyphs padding in atlas
+    unsigned int codepointsHash;    // Glyphs codepoints hash (FNV-1a)
+    unsigned int fileHash;          // Font file content hash (FNV-1a)
+    int fileSize;                   // Font file size
+    unsigned int fileModTime;       // Font file modification time (lower 32 bits), content hash is only checked if changed
+    int atlasWidth;                 // Atlas image width
+    int atlasHeight;                // Atlas image height
+    int dataSize;                   // Glyphs and atlas data size
+    int compDataSize;               // Compressed data size, 0 if data is not compressed
+} FontCacheHeader;
+#endif
+#endif
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -116,6 +184,11 @@
 static Font defaultFont = { 0 };
 #endif
 
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static DynamicFontCache *dynamicFonts[MAX_DYNAMIC_FONTS] = { 0 };  // Dynamic fonts glyphs caches: LoadFontDynamic()
+#endif
+static unsigned int sdfFontTextureIds[MAX_SDF_FONTS] = { 0 };      // SDF fonts atlas textures, drawn with SDF shader: LoadFontSdf()
+
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
@@ -129,10 +202,30 @@ static Font LoadBMFont(const char *fileName);   // Load a BMFont file (AngelCode
 #endif
 static int textLineSpacing = 15;                // Text vertical line spacing in pixels
 
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static void LoadFontGlyphsWork(void *data, int worker, int workerCount);       // Rasterize font glyphs assigned to one worker
+static DynamicFontCache *GetDynamicFontCache(Font font);                        // Get dynamic font glyphs cache, NULL if font is not dynamic
+static int GetDynamicFontGlyphIndex(DynamicFontCache *cache, int codepoint);    // Get glyph index from cache, rasterizing the glyph if required
+static Font LoadFontFileTTF(const char *fileName, int fontSize, int *codepoints, int codepointCount, int type); // Load font from TTF/OTF file, using font cache if available
+static void LoadFontTexture(Font *font, Image atlas);                          // Load font atlas texture and glyphs images from atlas image
+static unsigned int GetFontDataHash(const unsigned char *data, int dataSize, unsigned int hash);  // Get data hash (FNV-1a), chained from previous hash
+#if defined(SUPPORT_FONT_CACHE)
+static bool LoadFontCache(const char *fileName, const char *fontFileName, FontCacheHeader key, Font *font);  // Load font glyphs and atlas texture from cache file
+static bool SaveFontCache(const char *fileName, FontCacheHeader key, Font font, Image atlas);                 // Save font glyphs and atlas to cache file
+#endif
+#endif
+static bool BeginFontShader(Font font);         // Enable SDF shader if font requires it, returns true if shader was changed
+static void EndFontShader(bool changed);        // Restore default shader if changed by BeginFontShader()
+static int GetGlyphQuadsChunk(Font font);       // Get number of glyph quads that can be resolved before being drawn
+static void DrawGlyphQuads(Font font, const int *indices, const Vector2 *positions, int count, float fontSize, Color tint); // Draw glyph quads, written directly into render batch
+
 #if defined(SUPPORT_DEFAULT_FONT)
 extern void LoadFontDefault(void);
 extern void UnloadFontDefault(void);
 #endif
+#if defined(SUPPORT_FONT_CACHE)
+extern const char *GetFontCacheDirectory(void);     // [Module: core] Get font cache directory, NULL if not available
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -362,6 +455,18 @@ Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepoi
 {
     Font font = { 0 };
 
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    // NOTE: TTF/OTF fonts are loaded from font cache if available, skipping glyphs rasterization
+    if (IsFileExtension(fileName, ".ttf;.otf"))
+    {
+        font = LoadFontFileTTF(fileName, fontSize, codepoints, codepointCount, FONT_DEFAULT);
+
+        if (font.texture.id == 0) font = GetFontDefault();
+
+        return font;
+    }
+#endif
+
     // Loading file to memory
     int dataSize = 0;
     unsigned char *fileData = LoadFileData(fileName, &dataSize);
@@ -378,6 +483,137 @@ Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepoi
     return font;
 }
 
+// Load font from TTF font file with glyphs rasterized on first use
+// NOTE: Glyphs are cached into a fixed-size atlas, when all cells are used,
+// the least recently used glyph is evicted, glyphCapacity should exceed the glyphs drawn per frame
+Font LoadFontDynamic(const char *fileName, int fontSize, int glyphCapacity)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    int slot = -1;
+    for (int i = 0; i < MAX_DYNAMIC_FONTS; i++)
+    {
+        if (dynamicFonts[i] == NULL) { slot = i; break; }
+    }
+
+    if (!IsFileExtension(fileName, ".ttf;.otf")) TRACELOG(LOG_WARNING, "FONT: [%s] Dynamic fonts require TTF/OTF font data", fileName);
+    else if (slot == -1) TRACELOG(LOG_WARNING, "FONT: [%s] Maximum number of dynamic fonts reached (%i)", fileName, MAX_DYNAMIC_FONTS);
+    else if ((fontSize > 0) && (glyphCapacity > 0))
+    {
+        int dataSize = 0;
+        unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+        DynamicFontCache *cache = (DynamicFontCache *)RL_CALLOC(1, sizeof(DynamicFontCache));
+
+        if ((fileData != NULL) && stbtt_InitFont(&cache->fontInfo, fileData, 0))
+        {
+            cache->fileData = fileData;
+            cache->scaleFactor = stbtt_ScaleForPixelHeight(&cache->fontInfo, (float)fontSize);
+
+            int ascent, descent, lineGap;
+            stbtt_GetFontVMetrics(&cache->fontInfo, &ascent, &descent, &lineGap);
+            cache->ascent = (int)((float)ascent*cache->scaleFactor);
+
+            // Cell size fits the font bounding box, limited for fonts with oversized glyphs
+            // NOTE: Glyphs bigger than the cell are clipped
+            int x0, y0, x1, y1;
+            stbtt_GetFontBoundingBox(&cache->fontInfo, &x0, &y0, &x1, &y1);
+
+            int padding = FONT_TTF_DEFAULT_CHARS_PADDING;
+            int glyphWidth = (int)ceilf((float)(x1 - x0)*cache->scaleFactor);
+            int glyphHeight = (int)ceilf((float)(y1 - y0)*cache->scaleFactor);
+            if (glyphWidth > 2*fontSize) glyphWidth = 2*fontSize;
+            if (glyphHeight > 2*fontSize) glyphHeight = 2*fontSize;
+
+            cache->cellWidth = glyphWidth + 2*padding;
+            cache->cellHeight = glyphHeight + 2*padding;
+
+            // Atlas size is power-of-two, required cells are distributed as a square
+            int atlasWidth = 1;
+            while (atlasWidth < (int)ceilf(sqrtf((float)glyphCapacity))*cache->cellWidth) atlasWidth *= 2;
+            cache->columns = atlasWidth/cache->cellWidth;
+
+            int atlasHeight = 1;
+            while (atlasHeight < ((glyphCapacity + cache->columns - 1)/cache->columns)*cache->cellHeight) atlasHeight *= 2;
+
+            glyphCapacity = cache->columns*(atlasHeight/cache->cellHeight);
+
+            // Empty atlas (GRAY_ALPHA), glyphs are uploaded on first use
+            unsigned char *pixels = (unsigned char *)RL_MALLOC(atlasWidth*atlasHeight*2);
+            for (int i = 0; i < atlasWidth*atlasHeight; i++) { pixels[2*i] = 255; pixels[2*i + 1] = 0; }
+
+            Image atlas = { pixels, atlasWidth, atlasHeight, 1, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA };
+            font.texture = LoadTextureFromImage(atlas);
+            UnloadImage(atlas);
+
+            font.baseSize = fontSize;
+            font.glyphCount = glyphCapacity;
+            font.glyphPadding = padding;
+            font.glyphs = (GlyphInfo *)RL_CALLOC(glyphCapacity, sizeof(GlyphInfo));
+            font.recs = (Rectangle *)RL_CALLOC(glyphCapacity, sizeof(Rectangle));
+
+            cache->bucketCount = 1;
+            while (cache->bucketCount < 2*glyphCapacity) cache->bucketCount *= 2;
+            cache->buckets = (int *)RL_MALLOC(cache->bucketCount*sizeof(int));
+            for (int i = 0; i < cache->bucketCount; i++) cache->buckets[i] = -1;
+            cache->next = (int *)RL_MALLOC(glyphCapacity*sizeof(int));
+            cache->lastUse = (unsigned int *)RL_CALLOC(glyphCapacity, sizeof(unsigned int));
+
+            cache->font = font;
+            dynamicFonts[slot] = cache;
+
+            SetTextureFilter(font.texture, TEXTURE_FILTER_POINT);    // By default, we set point filter (the best performance)
+            TRACELOG(LOG_INFO, "FONT: [%s] Dynamic font loaded successfully (%i pixel size | %i glyphs capacity)", fileName, fontSize, glyphCapacity);
+        }
+        else
+        {
+            TRACELOG(LOG_WARNING, "FONT: [%s] Failed to process TTF font data", fileName);
+            UnloadFileData(fileData);
+            RL_FREE(cache);
+        }
+    }
+#endif
+
+    if (font.texture.id == 0) font = GetFontDefault();
+
+    return font;
+}
+
+// Load SDF font from TTF font file, drawn with the built-in SDF shader
+// NOTE: A single atlas serves any drawing size, fontSize only sets the distance field resolution,
+// generated atlas is cached on disk (SUPPORT_FONT_CACHE) to skip distance field generation on next loads
+Font LoadFontSdf(const char *fileName, int fontSize, int *codepoints, int codepointCount)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    int slot = -1;
+    for (int i = 0; i < MAX_SDF_FONTS; i++)
+    {
+        if (sdfFontTextureIds[i] == 0) { slot = i; break; }
+    }
+
+    if (!IsFileExtension(fileName, ".ttf;.otf")) TRACELOG(LOG_WARNING, "FONT: [%s] SDF fonts require TTF/OTF font data", fileName);
+    else if (slot == -1) TRACELOG(LOG_WARNING, "FONT: [%s] Maximum number of SDF fonts reached (%i)", fileName, MAX_SDF_FONTS);
+    else if (fontSize > 0)
+    {
+        font = LoadFontFileTTF(fileName, fontSize, codepoints, codepointCount, FONT_SDF);
+
+        if (font.texture.id > 0)
+        {
+            // NOTE: Bilinear filtering is required to interpolate the distance field
+            SetTextureFilter(font.texture, TEXTURE_FILTER_BILINEAR);
+            sdfFontTextureIds[slot] = font.texture.id;
+        }
+    }
+#endif
+
+    if (font.texture.id == 0) font = GetFontDefault();
+
+    return font;
+}
+
 // Load an Image font file (XNA style)
 Font LoadFontFromImage(Image image, Color key, int firstChar)
 {
@@ -525,15 +761,7 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
             font.glyphPadding = FONT_TTF_DEFAULT_CHARS_PADDING;
 
             Image atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, 0);
-            font.texture = LoadTextureFromImage(atlas);
-
-            // Update glyphs[i].image to use alpha, required to be used on ImageDrawText()
-            for (int i = 0; i < font.glyphCount; i++)
-            {
-                UnloadImage(font.glyphs[i].image);
-                font.glyphs[i].image = ImageFromImage(atlas, font.recs[i]);
-            }
-
+            LoadFontTexture(&font, atlas);
             UnloadImage(atlas);
 
             TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
@@ -591,14 +819,6 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
 
         if (stbtt_InitFont(&fontInfo, (unsigned char *)fileData, 0))     // Initialize font for data reading
         {
-            // Calculate font scale factor
-            float scaleFactor = stbtt_ScaleForPixelHeight(&fontInfo, (float)fontSize);
-
-            // Calculate font basic metrics
-            // NOTE: ascent is equivalent to font baseline
-            int ascent, descent, lineGap;
-            stbtt_GetFontVMetrics(&fontInfo, &ascent, &descent, &lineGap);
-
             // In case no chars count provided, default to 95
             codepointCount = (codepointCount > 0)? codepointCount : 95;
 
@@ -612,69 +832,20 @@ GlyphInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSiz
                 genFontChars = true;
             }
 
-            chars = (GlyphInfo *)RL_MALLOC(codepointCount*sizeof(GlyphInfo));
-
-            // NOTE: Using simple packaging, one char after another
-            for (int i = 0; i < codepointCount; i++)
-            {
-                int chw = 0, chh = 0;   // Character width and height (on generation)
-                int ch = codepoints[i];  // Character value to get info for
-                chars[i].value = ch;
+            chars = (GlyphInfo *)RL_CALLOC(codepointCount, sizeof(GlyphInfo));   // NOTE: SDF space glyph offsets are not set by stb_truetype
 
-                //  Render a unicode codepoint to a bitmap
-                //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
-                //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
-                //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
+            // Glyphs are rasterized by multiple workers, atlas packing is done later in a single pass
+            // NOTE: Small fonts are not worth sharing with worker pool threads
+            FontGlyphsJob job = { fileData, fontSize, type, codepoints, codepointCount, chars };
+            int workerCount = codepointCount/FONT_TTF_GLYPHS_PER_WORKER;
+            int maxWorkerCount = GetWorkerCount();
+            if (workerCount > maxWorkerCount) workerCount = maxWorkerCount;
 
-                if (type != FONT_SDF) chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
-                else if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
-                else chars[i].image.data = NULL;
-
-                stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                // Load characters images
-                chars[i].image.width = chw;
-                chars[i].image.height = chh;
-                chars[i].image.mipmaps = 1;
-                chars[i].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-
-                chars[i].offsetY += (int)((float)ascent*scaleFactor);
-
-                // NOTE: We create an empty image for space character, it could be further required for atlas packing
-                if (ch == 32)
-                {
-                    Image imSpace = {
-                        .data = RL_CALLOC(chars[i].advanceX*fontSize, 2),
-                        .width = chars[i].advanceX,
-                        .height = fontSize,
-                        .mipmaps = 1,
-                        .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
-                    };
-
-                    chars[i].image = imSpace;
-                }
-
-                if (type == FONT_BITMAP)
-                {
-                    // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
-                    // NOTE: For optimum results, bitmap font should be generated at base pixel size
-                    for (int p = 0; p < chw*chh; p++)
-                    {
-                        if (((unsigned char *)chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
-                        else ((unsigned char *)chars[i].image.data)[p] = 255;
-                    }
-                }
-
-                // Get bounding box for character (maybe offset to account for chars that dip above or below the line)
-                /*
-                int chX1, chY1, chX2, chY2;
-                stbtt_GetCodepointBitmapBox(&fontInfo, ch, scaleFactor, scaleFactor, &chX1, &chY1, &chX2, &chY2);
-
-                TRACELOGD("FONT: Character box measures: %i, %i, %i, %i", chX1, chY1, chX2 - chX1, chY2 - chY1);
-                TRACELOGD("FONT: Character offsetY: %i", (int)((float)ascent*scaleFactor) + chY1);
-                */
-            }
+#if defined(SUPPORT_TRACELOG_DEBUG)
+            double startTime = GetTime();
+#endif
+            RunWorkers(LoadFontGlyphsWork, &job, workerCount);
+            TRACELOGD("FONT: %i glyphs rasterized in %.2f ms (%i workers)", codepointCount, (GetTime() - startTime)*1000.0, (workerCount > 0)? workerCount : 1);
         }
         else TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
 
@@ -902,6 +1073,22 @@ void UnloadFont(Font font)
     // NOTE: Make sure font is not default font (fallback)
     if (font.texture.id != GetFontDefault().texture.id)
     {
+#if defined(SUPPORT_FILEFORMAT_TTF)
+        DynamicFontCache *cache = GetDynamicFontCache(font);
+
+        if (cache != NULL)
+        {
+            for (int i = 0; i < MAX_DYNAMIC_FONTS; i++) if (dynamicFonts[i] == cache) dynamicFonts[i] = NULL;
+
+            UnloadFileData(cache->fileData);
+            RL_FREE(cache->buckets);
+            RL_FREE(cache->next);
+            RL_FREE(cache->lastUse);
+            RL_FREE(cache);
+        }
+#endif
+        for (int i = 0; i < MAX_SDF_FONTS; i++) if (sdfFontTextureIds[i] == font.texture.id) sdfFontTextureIds[i] = 0;
+
         UnloadFontData(font.glyphs, font.glyphCount);
         UnloadTexture(font.texture);
         RL_FREE(font.recs);
@@ -1078,6 +1265,22 @@ void DrawFPS(int posX, int posY)
     DrawText(TextFormat("%2i FPS", fps), posX, posY, 20, color);
 }
 
+// Draw last frame rendering statistics (draw calls, vertex, uploads, GPU time)
+// NOTE: Statistics refer to the previous frame, GPU time requires rlEnableGpuTimer()
+void DrawFrameStats(int posX, int posY)
+{
+    rlFrameStats stats = rlGetFrameStats();
+    Color color = LIME;
+
+    if (stats.drawCalls > 100) color = ORANGE;      // Too many draw calls for a 2D frame
+
+    DrawText(TextFormat("DRAWS: %i  BATCHES: %i  VERTEX: %i", stats.drawCalls, stats.batchDraws, stats.vertexCount), posX, posY, 10, color);
+    DrawText(TextFormat("UPLOADS: %i (%i KB)  TEXTURES: %i  STATE: %i", stats.bufferUploads, stats.bufferUploadSize/1024, stats.textureBinds, stats.stateChanges), posX, posY + 12, 10, color);
+
+    if (stats.gpuTime >= 0.0f) DrawText(TextFormat("GPU: %.2f ms", stats.gpuTime), posX, posY + 24, 10, color);
+    else DrawText("GPU: -", posX, posY + 24, 10, color);
+}
+
 // Draw text (using default font)
 // NOTE: fontSize work like in any drawing program but if fontSize is lower than font-base-size, then font-base-size is used
 // NOTE: chars spacing is proportional to fontSize
@@ -1109,6 +1312,13 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
+    int glyphIndices[TEXT_GLYPH_QUADS_CHUNK] = { 0 };         // Glyphs pending to be drawn
+    Vector2 glyphPositions[TEXT_GLYPH_QUADS_CHUNK] = { 0 };
+    int glyphCount = 0;
+    int glyphChunk = GetGlyphQuadsChunk(font);
+
+    bool shaderChanged = BeginFontShader(font);
+
     for (int i = 0; i < size;)
     {
         // Get next codepoint from byte string and glyph index in font
@@ -1126,7 +1336,15 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
         {
             if ((codepoint != ' ') && (codepoint != '\t'))
             {
-                DrawTextCodepoint(font, codepoint, (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                glyphIndices[glyphCount] = index;
+                glyphPositions[glyphCount] = (Vector2){ position.x + textOffsetX, position.y + textOffsetY };
+                glyphCount++;
+
+                if (glyphCount == glyphChunk)
+                {
+                    DrawGlyphQuads(font, glyphIndices, glyphPositions, glyphCount, fontSize, tint);
+                    glyphCount = 0;
+                }
             }
 
             if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
@@ -1135,6 +1353,10 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
 
         i += codepointByteCount;   // Move text bytes counter to next codepoint
     }
+
+    DrawGlyphQuads(font, glyphIndices, glyphPositions, glyphCount, fontSize, tint);
+
+    EndFontShader(shaderChanged);
 }
 
 // Draw text using Font and pro parameters (rotation)
@@ -1157,22 +1379,11 @@ void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSiz
     // Character index position in sprite font
     // NOTE: In case a codepoint is not available in the font, index returned points to '?'
     int index = GetGlyphIndex(font, codepoint);
-    float scaleFactor = fontSize/font.baseSize;     // Character quad scaling factor
-
-    // Character destination rectangle on screen
-    // NOTE: We consider glyphPadding on drawing
-    Rectangle dstRec = { position.x + font.glyphs[index].offsetX*scaleFactor - (float)font.glyphPadding*scaleFactor,
-                      position.y + font.glyphs[index].offsetY*scaleFactor - (float)font.glyphPadding*scaleFactor,
-                      (font.recs[index].width + 2.0f*font.glyphPadding)*scaleFactor,
-                      (font.recs[index].height + 2.0f*font.glyphPadding)*scaleFactor };
-
-    // Character source rectangle from font texture atlas
-    // NOTE: We consider chars padding when drawing, it could be required for outline/glow shader effects
-    Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
-                         font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
 
     // Draw the character texture on the screen
-    DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+    bool shaderChanged = BeginFontShader(font);
+    DrawGlyphQuads(font, &index, &position, 1, fontSize, tint);
+    EndFontShader(shaderChanged);
 }
 
 // Draw multiple character (codepoints)
@@ -1183,6 +1394,13 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
+    int glyphIndices[TEXT_GLYPH_QUADS_CHUNK] = { 0 };         // Glyphs pending to be drawn
+    Vector2 glyphPositions[TEXT_GLYPH_QUADS_CHUNK] = { 0 };
+    int glyphCount = 0;
+    int glyphChunk = GetGlyphQuadsChunk(font);
+
+    bool shaderChanged = BeginFontShader(font);
+
     for (int i = 0; i < codepointCount; i++)
     {
         int index = GetGlyphIndex(font, codepoints[i]);
@@ -1197,13 +1415,25 @@ void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Ve
         {
             if ((codepoints[i] != ' ') && (codepoints[i] != '\t'))
             {
-                DrawTextCodepoint(font, codepoints[i], (Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                glyphIndices[glyphCount] = index;
+                glyphPositions[glyphCount] = (Vector2){ position.x + textOffsetX, position.y + textOffsetY };
+                glyphCount++;
+
+                if (glyphCount == glyphChunk)
+                {
+                    DrawGlyphQuads(font, glyphIndices, glyphPositions, glyphCount, fontSize, tint);
+                    glyphCount = 0;
+                }
             }
 
             if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
             else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
         }
     }
+
+    DrawGlyphQuads(font, glyphIndices, glyphPositions, glyphCount, fontSize, tint);
+
+    EndFontShader(shaderChanged);
 }
 
 // Set vertical line spacing when drawing with line-breaks
@@ -1292,6 +1522,12 @@ int GetGlyphIndex(Font font, int codepoint)
 {
     int index = 0;
 
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    // Dynamic fonts glyphs are looked up (and rasterized if required) in the font cache
+    DynamicFontCache *cache = GetDynamicFontCache(font);
+    if (cache != NULL) return GetDynamicFontGlyphIndex(cache, codepoint);
+#endif
+
 #define SUPPORT_UNORDERED_CHARSET
 #if defined(SUPPORT_UNORDERED_CHARSET)
     int fallbackIndex = 0;      // Get index of fallback glyph '?'
@@ -2001,6 +2237,543 @@ int GetCodepointPrevious(const char *text, int *codepointSize)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Rasterize font glyphs assigned to one worker
+// NOTE: Every worker uses its own stbtt_fontinfo, glyphs are interleaved between workers to balance work
+static void LoadFontGlyphsWork(void *data, int worker, int workerCount)
+{
+    FontGlyphsJob *job = (FontGlyphsJob *)data;
+    const int *codepoints = job->codepoints;
+    GlyphInfo *chars = job->glyphs;
+    int fontSize = job->fontSize;
+    int type = job->type;
+
+    stbtt_fontinfo fontInfo = { 0 };
+    if (!stbtt_InitFont(&fontInfo, (unsigned char *)job->fileData, 0)) return;
+
+    // Calculate font scale factor
+    float scaleFactor = stbtt_ScaleForPixelHeight(&fontInfo, (float)fontSize);
+
+    // Calculate font basic metrics
+    // NOTE: ascent is equivalent to font baseline
+    int ascent, descent, lineGap;
+    stbtt_GetFontVMetrics(&fontInfo, &ascent, &descent, &lineGap);
+
+    for (int i = worker; i < job->codepointCount; i += workerCount)
+    {
+        int chw = 0, chh = 0;   // Character width and height (on generation)
+        int ch = codepoints[i];  // Character value to get info for
+        chars[i].value = ch;
+
+        //  Render a unicode codepoint to a bitmap
+        //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
+        //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
+        //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
+
+        if (type != FONT_SDF) chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
+        else if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
+        else chars[i].image.data = NULL;
+
+        stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
+        chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
+
+        // Load characters images
+        chars[i].image.width = chw;
+        chars[i].image.height = chh;
+        chars[i].image.mipmaps = 1;
+        chars[i].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+        chars[i].offsetY += (int)((float)ascent*scaleFactor);
+
+        // NOTE: We create an empty image for space character, it could be further required for atlas packing
+        if (ch == 32)
+        {
+            Image imSpace = {
+                .data = RL_CALLOC(chars[i].advanceX*fontSize, 2),
+                .width = chars[i].advanceX,
+                .height = fontSize,
+                .mipmaps = 1,
+                .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+            };
+
+            chars[i].image = imSpace;
+        }
+
+        if (type == FONT_BITMAP)
+        {
+            // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
+            // NOTE: For optimum results, bitmap font should be generated at base pixel size
+            for (int p = 0; p < chw*chh; p++)
+            {
+                if (((unsigned char *)chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
+                else ((unsigned char *)chars[i].image.data)[p] = 255;
+            }
+        }
+
+        // Get bounding box for character (maybe offset to account for chars that dip above or below the line)
+        /*
+        int chX1, chY1, chX2, chY2;
+        stbtt_GetCodepointBitmapBox(&fontInfo, ch, scaleFactor, scaleFactor, &chX1, &chY1, &chX2, &chY2);
+
+        TRACELOGD("FONT: Character box measures: %i, %i, %i, %i", chX1, chY1, chX2 - chX1, chY2 - chY1);
+        TRACELOGD("FONT: Character offsetY: %i", (int)((float)ascent*scaleFactor) + chY1);
+        */
+    }
+}
+
+// Get dynamic font glyphs cache, NULL if font is not dynamic
+static DynamicFontCache *GetDynamicFontCache(Font font)
+{
+    if (font.glyphs == NULL) return NULL;
+
+    for (int i = 0; i < MAX_DYNAMIC_FONTS; i++)
+    {
+        if ((dynamicFonts[i] != NULL) && (dynamicFonts[i]->font.glyphs == font.glyphs)) return dynamicFonts[i];
+    }
+
+    return NULL;
+}
+
+// Get glyph index from cache, rasterizing the glyph if required
+// NOTE: Codepoints not available in the font fallback to '?'
+static int GetDynamicFontGlyphIndex(DynamicFontCache *cache, int codepoint)
+{
+    GlyphInfo *glyphs = cache->font.glyphs;
+    int bucket = (int)(((unsigned int)codepoint*2654435761u) & (unsigned int)(cache->bucketCount - 1));
+
+    // Use stamps are reset on overflow, it only affects eviction order
+    cache->useCounter++;
+    if (cache->useCounter == 0)
+    {
+        for (int i = 0; i < cache->font.glyphCount; i++) cache->lastUse[i] = 0;
+        cache->useCounter = 1;
+    }
+
+    for (int i = cache->buckets[bucket]; i != -1; i = cache->next[i])
+    {
+        if (glyphs[i].value == codepoint)
+        {
+            cache->lastUse[i] = cache->useCounter;
+            return i;
+        }
+    }
+
+    if ((codepoint != '?') && (stbtt_FindGlyphIndex(&cache->fontInfo, codepoint) == 0)) return GetDynamicFontGlyphIndex(cache, '?');
+
+    int index = 0;
+
+    if (cache->glyphsUsed < cache->font.glyphCount) index = cache->glyphsUsed++;
+    else
+    {
+        // Evict least recently used glyph
+        for (int i = 1; i < cache->font.glyphCount; i++) if (cache->lastUse[i] < cache->lastUse[index]) index = i;
+
+        int evictedBucket = (int)(((unsigned int)glyphs[index].value*2654435761u) & (unsigned int)(cache->bucketCount - 1));
+        int *link = &cache->buckets[evictedBucket];
+        while (*link != index) link = &cache->next[*link];
+        *link = cache->next[index];
+
+        UnloadImage(glyphs[index].image);
+
+        // Batched draws could still reference evicted glyph atlas cell
+        rlDrawRenderBatchActive();
+    }
+
+    // Rasterize glyph and upload the full atlas cell (clearing previous glyph)
+    int chw = 0, chh = 0, offsetX = 0, offsetY = 0, advanceX = 0;
+    unsigned char *bitmap = stbtt_GetCodepointBitmap(&cache->fontInfo, cache->scaleFactor, cache->scaleFactor, codepoint, &chw, &chh, &offsetX, &offsetY);
+    stbtt_GetCodepointHMetrics(&cache->fontInfo, codepoint, &advanceX, NULL);
+
+    int padding = cache->font.glyphPadding;
+    int width = (chw < (cache->cellWidth - 2*padding))? chw : (cache->cellWidth - 2*padding);
+    int height = (chh < (cache->cellHeight - 2*padding))? chh : (cache->cellHeight - 2*padding);
+
+    Rectangle cell = { (float)((index%cache->columns)*cache->cellWidth), (float)((index/cache->columns)*cache->cellHeight), (float)cache->cellWidth, (float)cache->cellHeight };
+    unsigned char *pixels = (unsigned char *)RL_CALLOC(cache->cellWidth*cache->cellHeight, 2);
+    for (int i = 0; i < cache->cellWidth*cache->cellHeight; i++) pixels[2*i] = 255;
+
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++) pixels[2*((y + padding)*cache->cellWidth + x + padding) + 1] = bitmap[y*chw + x];
+    }
+
+    UpdateTextureRec(cache->font.texture, cell, pixels);
+
+    glyphs[index].value = codepoint;
+    glyphs[index].offsetX = offsetX;
+    glyphs[index].offsetY = offsetY + cache->ascent;
+    glyphs[index].advanceX = (int)((float)advanceX*cache->scaleFactor);
+    glyphs[index].image = (Image){ 0 };
+
+    // Glyph image is kept (GRAY_ALPHA), required to be used on ImageDrawText()
+    if ((width > 0) && (height > 0))
+    {
+        Image cellImage = { pixels, cache->cellWidth, cache->cellHeight, 1, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA };
+        glyphs[index].image = ImageFromImage(cellImage, (Rectangle){ (float)padding, (float)padding, (float)width, (float)height });
+    }
+
+    cache->font.recs[index] = (Rectangle){ cell.x + padding, cell.y + padding, (float)width, (float)height };
+
+    cache->next[index] = cache->buckets[bucket];
+    cache->buckets[bucket] = index;
+    cache->lastUse[index] = cache->useCounter;
+
+    RL_FREE(pixels);
+    stbtt_FreeBitmap(bitmap, NULL);
+
+    return index;
+}
+
+// Load font from TTF/OTF file, using font cache if available (SUPPORT_FONT_CACHE)
+// NOTE: On cache miss, glyphs are rasterized and font cache is saved for next loads
+static Font LoadFontFileTTF(const char *fileName, int fontSize, int *codepoints, int codepointCount, int type)
+{
+    Font font = { 0 };
+    font.baseSize = fontSize;
+    font.glyphCount = (codepointCount > 0)? codepointCount : 95;
+    font.glyphPadding = (type == FONT_SDF)? 0 : FONT_TTF_DEFAULT_CHARS_PADDING;    // NOTE: SDF glyphs already include distance field padding
+
+    bool loaded = false;
+
+#if defined(SUPPORT_FONT_CACHE)
+    // NOTE: Font file path hash keeps apart caches of fonts with same file name
+    const char *cacheDirectory = GetFontCacheDirectory();
+    char cacheFileName[512] = { 0 };
+    if (cacheDirectory != NULL) snprintf(cacheFileName, 512, "%s/%s.%08x.%i%s" FONT_CACHE_FILE_EXT, cacheDirectory, GetFileName(fileName),
+        GetFontDataHash((const unsigned char *)fileName, (int)strlen(fileName), 0), fontSize, (type == FONT_SDF)? ".sdf" : "");
+
+    FontCacheHeader key = { .id = { 'r', 'F', 'N', 'T' }, .version = 1, .type = type, .fontSize = fontSize, .glyphCount = font.glyphCount, .glyphPadding = font.glyphPadding };
+
+    // NOTE: Codepoints hash uses the default charset (32..126) if no codepoints provided
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        int codepoint = (codepoints != NULL)? codepoints[i] : (i + 32);
+        key.codepointsHash = GetFontDataHash((const unsigned char *)&codepoint, sizeof(int), key.codepointsHash);
+    }
+
+    key.fileSize = GetFileLength(fileName);
+    key.fileModTime = (unsigned int)GetFileModTime(fileName);
+
+    if (cacheDirectory != NULL) loaded = LoadFontCache(cacheFileName, fileName, key, &font);
+#endif
+
+    if (!loaded)
+    {
+        int dataSize = 0;
+        unsigned char *fileData = LoadFileData(fileName, &dataSize);
+
+        if (fileData != NULL) font.glyphs = LoadFontData(fileData, dataSize, font.baseSize, codepoints, font.glyphCount, type);
+
+        if (font.glyphs != NULL)
+        {
+            Image atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, (type == FONT_SDF)? 1 : 0);
+#if defined(SUPPORT_FONT_CACHE)
+            key.fileHash = GetFontDataHash(fileData, dataSize, 0);
+            if ((cacheDirectory != NULL) && !SaveFontCache(cacheFileName, key, font, atlas)) TRACELOG(LOG_WARNING, "FONT: [%s] Failed to save font cache", fileName);
+#endif
+            LoadFontTexture(&font, atlas);
+            UnloadImage(atlas);
+            loaded = true;
+        }
+
+        UnloadFileData(fileData);
+    }
+
+    if (loaded) TRACELOG(LOG_INFO, "FONT: [%s] Data loaded successfully (%i pixel size | %i glyphs)", fileName, font.baseSize, font.glyphCount);
+    else
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Failed to process TTF font data", fileName);
+        font = (Font){ 0 };
+    }
+
+    return font;
+}
+
+// Load font atlas texture and glyphs images from atlas image
+// NOTE: Glyphs images are updated to use alpha, required to be used on ImageDrawText()
+static void LoadFontTexture(Font *font, Image atlas)
+{
+    font->texture = LoadTextureFromImage(atlas);
+
+    for (int i = 0; i < font->glyphCount; i++)
+    {
+        UnloadImage(font->glyphs[i].image);
+        font->glyphs[i].image = ImageFromImage(atlas, font->recs[i]);
+    }
+}
+
+// Get data hash (FNV-1a), chained from previous hash
+// NOTE: Hash 0 starts a new hash
+static unsigned int GetFontDataHash(const unsigned char *data, int dataSize, unsigned int hash)
+{
+    if (hash == 0) hash = 2166136261u;
+
+    for (int i = 0; i < dataSize; i++) hash = (hash ^ data[i])*16777619u;
+
+    return hash;
+}
+
+#if defined(SUPPORT_FONT_CACHE)
+// Load font glyphs and atlas texture from cache file
+// NOTE: Cache file is memory mapped (if supported), uncompressed atlas is uploaded directly from mapped memory
+static bool LoadFontCache(const char *fileName, const char *fontFileName, FontCacheHeader key, Font *font)
+{
+    bool loaded = false;
+
+    if (!FileExists(fileName)) return loaded;
+
+    int fileSize = 0;
+    const unsigned char *fileData = LoadFileMapped(fileName, &fileSize);
+
+    FontCacheHeader header = { 0 };
+    if ((fileData != NULL) && (fileSize >= (int)sizeof(FontCacheHeader))) memcpy(&header, fileData, sizeof(FontCacheHeader));
+
+    // NOTE: Atlas size is checked before computing its data size, corrupted header could overflow it
+    bool valid = ((header.atlasWidth > 0) && (header.atlasWidth <= FONT_CACHE_MAX_ATLAS_SIZE) &&
+                  (header.atlasHeight > 0) && (header.atlasHeight <= FONT_CACHE_MAX_ATLAS_SIZE));
+
+    int glyphsSize = key.glyphCount*(sizeof(Rectangle) + 4*sizeof(int));
+    int atlasSize = valid? header.atlasWidth*header.atlasHeight*2 : 0;
+
+    valid = (valid && (memcmp(header.id, key.id, 4) == 0) && (header.version == key.version) && (header.type == key.type) &&
+             (header.fontSize == key.fontSize) && (header.glyphCount == key.glyphCount) &&
+             (header.glyphPadding == key.glyphPadding) && (header.codepointsHash == key.codepointsHash) &&
+             (header.dataSize == glyphsSize + atlasSize) &&
+             (fileSize == (int)sizeof(FontCacheHeader) + ((header.compDataSize > 0)? header.compDataSize : header.dataSize)));
+
+    // Font file metadata changed (i.e. file copied), font file content decides
+    if (valid && ((header.fileSize != key.fileSize) || (header.fileModTime != key.fileModTime)))
+    {
+        int fontDataSize = 0;
+        unsigned char *fontData = LoadFileData(fontFileName, &fontDataSize);
+
+        valid = ((fontData != NULL) && (fontDataSize == header.fileSize) &&
+                 (GetFontDataHash(fontData, fontDataSize, 0) == header.fileHash));
+
+        UnloadFileData(fontData);
+    }
+
+    if (valid)
+    {
+        const unsigned char *data = fileData + sizeof(FontCacheHeader);
+        unsigned char *decompData = NULL;
+
+        if (header.compDataSize > 0)
+        {
+#if defined(SUPPORT_COMPRESSION_API)
+            int decompDataSize = 0;
+            decompData = DecompressData(data, header.compDataSize, &decompDataSize);
+
+            if (decompDataSize != header.dataSize)
+            {
+                MemFree(decompData);
+                decompData = NULL;
+            }
+#endif
+            data = decompData;
+        }
+
+        if (data != NULL)
+        {
+            font->recs = (Rectangle *)RL_MALLOC(key.glyphCount*sizeof(Rectangle));
+            memcpy(font->recs, data, key.glyphCount*sizeof(Rectangle));
+            data += key.glyphCount*sizeof(Rectangle);
+
+            // Glyphs recs must be inside atlas, glyphs images are copied from it
+            for (int i = 0; i < key.glyphCount; i++)
+            {
+                Rectangle rec = font->recs[i];
+
+                if (!((rec.x >= 0) && (rec.y >= 0) && (rec.width >= 0) && (rec.height >= 0) &&
+                      (rec.x + rec.width <= header.atlasWidth) && (rec.y + rec.height <= header.atlasHeight)))
+                {
+                    RL_FREE(font->recs);
+                    font->recs = NULL;
+                    data = NULL;
+                    break;
+                }
+            }
+        }
+
+        if (data != NULL)
+        {
+            font->glyphs = (GlyphInfo *)RL_CALLOC(key.glyphCount, sizeof(GlyphInfo));
+            for (int i = 0; i < key.glyphCount; i++, data += 4*sizeof(int))
+            {
+                int metrics[4] = { 0 };
+                memcpy(metrics, data, 4*sizeof(int));
+                font->glyphs[i].value = metrics[0];
+                font->glyphs[i].offsetX = metrics[1];
+                font->glyphs[i].offsetY = metrics[2];
+                font->glyphs[i].advanceX = metrics[3];
+            }
+
+            // NOTE: Atlas image data is not owned, it is only read by LoadFontTexture()
+            Image atlas = { (void *)data, header.atlasWidth, header.atlasHeight, 1, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA };
+            LoadFontTexture(font, atlas);
+
+            loaded = true;
+            TRACELOGD("FONT: [%s] Font cache loaded successfully", fileName);
+        }
+
+        MemFree(decompData);
+    }
+    else TRACELOGD("FONT: [%s] Font cache outdated, regenerating", fileName);
+
+    UnloadFileMapped(fileData, fileSize);
+
+    return loaded;
+}
+
+// Save font glyphs and atlas to cache file, returns true if saved
+static bool SaveFontCache(const char *fileName, FontCacheHeader key, Font font, Image atlas)
+{
+    int glyphsSize = font.glyphCount*(sizeof(Rectangle) + 4*sizeof(int));
+    int atlasSize = atlas.width*atlas.height*2;
+
+    key.atlasWidth = atlas.width;
+    key.atlasHeight = atlas.height;
+    key.dataSize = glyphsSize + atlasSize;
+    key.compDataSize = 0;
+
+    unsigned char *data = (unsigned char *)RL_MALLOC(key.dataSize);
+    unsigned char *dataPtr = data;
+
+    memcpy(dataPtr, font.recs, font.glyphCount*sizeof(Rectangle));
+    dataPtr += font.glyphCount*sizeof(Rectangle);
+
+    for (int i = 0; i < font.glyphCount; i++, dataPtr += 4*sizeof(int))
+    {
+        int metrics[4] = { font.glyphs[i].value, font.glyphs[i].offsetX, font.glyphs[i].offsetY, font.glyphs[i].advanceX };
+        memcpy(dataPtr, metrics, 4*sizeof(int));
+    }
+
+    memcpy(dataPtr, atlas.data, atlasSize);     // NOTE: Atlas generated by GenImageFontAtlas() is GRAY_ALPHA
+
+    unsigned char *compData = NULL;
+#if defined(SUPPORT_FONT_CACHE_COMPRESSION) && defined(SUPPORT_COMPRESSION_API)
+    compData = CompressData(data, key.dataSize, &key.compDataSize);
+    if (compData == NULL) key.compDataSize = 0;
+#endif
+
+    int payloadSize = (compData != NULL)? key.compDataSize : key.dataSize;
+    unsigned char *fileData = (unsigned char *)RL_MALLOC(sizeof(FontCacheHeader) + payloadSize);
+
+    memcpy(fileData, &key, sizeof(FontCacheHeader));
+    memcpy(fileData + sizeof(FontCacheHeader), (compData != NULL)? compData : data, payloadSize);
+
+    bool saved = SaveFileData(fileName, fileData, sizeof(FontCacheHeader) + payloadSize);
+
+    RL_FREE(fileData);
+    MemFree(compData);
+    RL_FREE(data);
+
+    return saved;
+}
+#endif
+#endif
+
+// Enable SDF shader if font requires it, returns true if shader was changed
+// NOTE: A user shader enabled with BeginShaderMode() is kept, it is expected to support SDF
+static bool BeginFontShader(Font font)
+{
+    bool changed = false;
+
+    if ((font.texture.id > 0) && (rlGetShaderIdCurrent() == rlGetShaderIdDefault()))
+    {
+        for (int i = 0; i < MAX_SDF_FONTS; i++)
+        {
+            if (sdfFontTextureIds[i] == font.texture.id)
+            {
+                unsigned int shaderId = rlGetShaderIdSdf();
+
+                if (shaderId > 0)
+                {
+                    rlSetShader(shaderId, rlGetShaderLocsSdf());
+                    changed = true;
+                }
+                break;
+            }
+        }
+    }
+
+    return changed;
+}
+
+// Restore default shader if changed by BeginFontShader()
+static void EndFontShader(bool changed)
+{
+    if (changed) rlSetShader(rlGetShaderIdDefault(), rlGetShaderLocsDefault());
+}
+
+// Get number of glyph quads that can be resolved before being drawn
+// NOTE: Dynamic fonts could evict a glyph on lookup, pending glyphs are always more recently used
+// than some cached glyph as long as they are less than the glyphs that can be evicted (glyphCount - 1)
+static int GetGlyphQuadsChunk(Font font)
+{
+    int chunk = font.glyphCount - 1;
+
+    if (chunk > TEXT_GLYPH_QUADS_CHUNK) chunk = TEXT_GLYPH_QUADS_CHUNK;
+    if (chunk < 1) chunk = 1;
+
+    return chunk;
+}
+
+// Draw glyph quads, written directly into render batch
+// NOTE: We consider glyphPadding on drawing, it could be required for outline/glow shader effects
+static void DrawGlyphQuads(Font font, const int *indices, const Vector2 *positions, int count, float fontSize, Color tint)
+{
+    if ((font.texture.id == 0) || (count <= 0)) return;
+
+    float scaleFactor = fontSize/font.baseSize;     // Character quad scaling factor
+    float padding = (float)font.glyphPadding;
+    float width = (float)font.texture.width;
+    float height = (float)font.texture.height;
+
+    for (int i = 0; i < count;)
+    {
+        // NOTE: Reserved quads could be less than requested if render batch is full
+        rlQuadBuffer quads = rlBeginQuads(font.texture.id, count - i);
+        if (quads.count == 0) break;
+
+        for (int q = 0; q < quads.count; q++, i++)
+        {
+            Rectangle rec = font.recs[indices[i]];
+
+            // Character destination rectangle on screen
+            float x0 = positions[i].x + (font.glyphs[indices[i]].offsetX - padding)*scaleFactor;
+            float y0 = positions[i].y + (font.glyphs[indices[i]].offsetY - padding)*scaleFactor;
+            float x1 = x0 + (rec.width + 2.0f*padding)*scaleFactor;
+            float y1 = y0 + (rec.height + 2.0f*padding)*scaleFactor;
+
+            // Character source rectangle from font texture atlas
+            float left = (rec.x - padding)/width;
+            float top = (rec.y - padding)/height;
+            float right = (rec.x + rec.width + padding)/width;
+            float bottom = (rec.y + rec.height + padding)/height;
+
+            // Top-left, bottom-left, bottom-right and top-right corners
+            const float corners[8] = { x0, y0, x0, y1, x1, y1, x1, y0 };
+            const float texcoords[8] = { left, top, left, bottom, right, bottom, right, top };
+
+            for (int v = 0; v < 4; v++)
+            {
+                float *position = RL_QUAD_POSITION(quads, q*4 + v);
+                position[0] = corners[v*2];
+                position[1] = corners[v*2 + 1];
+                position[2] = quads.depth;
+
+                memcpy(RL_QUAD_TEXCOORD(quads, q*4 + v), texcoords + v*2, 2*sizeof(float));
+                memcpy(RL_QUAD_COLOR(quads, q*4 + v), &tint, sizeof(Color));
+            }
+        }
+
+        rlEndQuads(quads.count);
+    }
+
+    rlSetTexture(0);
+}
+
 #if defined(SUPPORT_FILEFORMAT_FNT)
 // Read a line from memory
 // REQUIRES: memcpy()
@@ -74,7 +74,7 @@
 #include "rlgl.h"               // OpenGL abstraction layer to OpenGL 1.1, 3.3 or ES2
 
 #include <stdlib.h>             // Required for: malloc(), free()
-#include <string.h>             // Required for: strlen() [Used in ImageTextEx()], strcmp() [Used in LoadImageFromMemory()]
+#include <string.h>             // Required for: strlen() [Used in ImageTextEx()], strcmp() [Used in LoadImageFromMemory()], memcpy()
 #include <math.h>               // Required for: fabsf() [Used in DrawTextureRec()]
 #include <stdio.h>              // Required for: sprintf() [Used in ExportImageAsCode()]
 
@@ -234,6 +234,10 @@
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
 
+#ifndef TEXTURE_ATLAS_MAX_SIZE
+    #define TEXTURE_ATLAS_MAX_SIZE  4096    // Maximum texture atlas width/height, atlas growth stops there
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -255,6 +259,8 @@ extern void LoadFontDefault(void);          // [Module: text] Loads default font
 static float HalfToFloat(unsigned short x);
 static unsigned short FloatToHalf(float x);
 static Vector4 *LoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static bool PackTextureAtlasRec(TextureAtlas *atlas, int width, int height, int *posX, int *posY); // Find skyline position for rectangle in atlas
+static bool GrowTextureAtlas(TextureAtlas *atlas);          // Grow texture atlas size, already packed sprites keep their position
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -4012,33 +4018,32 @@ void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2
             bottomRight.y = y + (dx + dest.width)*sinRotation + (dy + dest.height)*cosRotation;
         }
 
-        rlSetTexture(texture.id);
-        rlBegin(RL_QUADS);
+        float left = source.x/width;
+        float right = (source.x + source.width)/width;
+        float top = source.y/height;
+        float bottom = (source.y + source.height)/height;
 
-            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+        if (flipX) { float temp = left; left = right; right = temp; }
 
-            // Top-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            else rlTexCoord2f(source.x/width, source.y/height);
-            rlVertex2f(topLeft.x, topLeft.y);
+        // Quad written directly into render batch, no per-vertex state calls required
+        rlQuadBuffer quad = rlBeginQuads(texture.id, 1);
 
-            // Bottom-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            rlVertex2f(bottomLeft.x, bottomLeft.y);
+            // Top-left, bottom-left, bottom-right and top-right corners for texture and quad
+            const Vector2 positions[4] = { topLeft, bottomLeft, bottomRight, topRight };
+            const float texcoords[8] = { left, top, left, bottom, right, bottom, right, top };
 
-            // Bottom-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            rlVertex2f(bottomRight.x, bottomRight.y);
+            for (int i = 0; i < 4; i++)
+            {
+                float *position = RL_QUAD_POSITION(quad, i);
+                position[0] = positions[i].x;
+                position[1] = positions[i].y;
+                position[2] = quad.depth;
 
-            // Top-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, source.y/height);
-            else rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            rlVertex2f(topRight.x, topRight.y);
+                memcpy(RL_QUAD_TEXCOORD(quad, i), texcoords + i*2, 2*sizeof(float));
+                memcpy(RL_QUAD_COLOR(quad, i), &tint, sizeof(Color));
+            }
 
-        rlEnd();
+        rlEndQuads(1);
         rlSetTexture(0);
 
         // NOTE: Vertex position can be transformed using matrices
@@ -4280,6 +4285,140 @@ void DrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest,
     }
 }
 
+//------------------------------------------------------------------------------------
+// Texture atlas functions
+//------------------------------------------------------------------------------------
+// Load empty texture atlas
+// NOTE: Atlas is kept in CPU memory (R8G8B8A8) and GPU memory, new images are packed using
+// a bottom-left skyline algorithm and only the updated rectangle is uploaded to GPU
+TextureAtlas LoadTextureAtlas(int width, int height, int padding)
+{
+    TextureAtlas atlas = { 0 };
+
+    if ((width <= 0) || (height <= 0) || (width > TEXTURE_ATLAS_MAX_SIZE) || (height > TEXTURE_ATLAS_MAX_SIZE))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Texture atlas size not valid: %ix%i", width, height);
+        return atlas;
+    }
+
+    atlas.image = GenImageColor(width, height, BLANK);
+    atlas.texture = LoadTextureFromImage(atlas.image);
+    atlas.padding = (padding > 0)? padding : 0;
+
+    // Skyline starts as a single node covering the full atlas width
+    // NOTE: Every node is at least 1 pixel width, so width + 1 nodes is enough
+    atlas.nodes = (int *)RL_CALLOC((width + 1)*3, sizeof(int));
+    atlas.nodes[2] = width;
+    atlas.nodeCount = 1;
+
+    return atlas;
+}
+
+// Check if a texture atlas is ready
+bool IsTextureAtlasReady(TextureAtlas atlas)
+{
+    return (IsImageReady(atlas.image) &&        // Validate atlas image data
+            IsTextureReady(atlas.texture) &&    // Validate atlas texture
+            (atlas.nodes != NULL));             // Validate skyline nodes
+}
+
+// Unload texture atlas from CPU and GPU memory
+void UnloadTextureAtlas(TextureAtlas atlas)
+{
+    UnloadImage(atlas.image);
+    UnloadTexture(atlas.texture);
+
+    RL_FREE(atlas.recs);
+    RL_FREE(atlas.nodes);
+}
+
+// Pack image into texture atlas, returns sprite index (-1 on failure)
+// NOTE: Atlas size is doubled when there is no space left, previously retrieved sprites must be
+// retrieved again in that case because atlas texture is reloaded
+int AddTextureAtlasImage(TextureAtlas *atlas, Image image)
+{
+    if ((atlas->nodes == NULL) || (image.data == NULL) || (image.width == 0) || (image.height == 0)) return -1;
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Compressed images can not be packed into texture atlas");
+        return -1;
+    }
+
+    int width = image.width + 2*atlas->padding;
+    int height = image.height + 2*atlas->padding;
+    int posX = 0;
+    int posY = 0;
+
+    while (!PackTextureAtlasRec(atlas, width, height, &posX, &posY))
+    {
+        if (!GrowTextureAtlas(atlas))
+        {
+            TRACELOG(LOG_WARNING, "TEXTURE: Texture atlas is full, image %ix%i could not be packed", image.width, image.height);
+            return -1;
+        }
+    }
+
+    Rectangle rec = { (float)(posX + atlas->padding), (float)(posY + atlas->padding), (float)image.width, (float)image.height };
+
+    // Copy image pixels into atlas image, converting format if required
+    Image pixels = image;
+    if (image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+    {
+        pixels = ImageCopy(image);
+        ImageFormat(&pixels, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    }
+
+    for (int y = 0; y < image.height; y++)
+    {
+        memcpy((unsigned char *)atlas->image.data + (((int)rec.y + y)*atlas->image.width + (int)rec.x)*4,
+               (unsigned char *)pixels.data + y*image.width*4, image.width*4);
+    }
+
+    // Only the packed rectangle is uploaded to GPU
+    UpdateTextureRec(atlas->texture, rec, pixels.data);
+
+    if (pixels.data != image.data) UnloadImage(pixels);
+
+    Rectangle *recs = (Rectangle *)RL_REALLOC(atlas->recs, (atlas->spriteCount + 1)*sizeof(Rectangle));
+    if (recs == NULL) return -1;
+
+    atlas->recs = recs;
+    atlas->recs[atlas->spriteCount] = rec;
+    atlas->spriteCount++;
+
+    return atlas->spriteCount - 1;
+}
+
+// Get sprite handle from texture atlas
+// NOTE: Sprite references atlas texture, it must be retrieved again if atlas grows
+Sprite GetTextureAtlasSprite(TextureAtlas atlas, int index)
+{
+    Sprite sprite = { 0 };
+
+    if ((index >= 0) && (index < atlas.spriteCount))
+    {
+        sprite.texture = atlas.texture;
+        sprite.source = atlas.recs[index];
+    }
+    else TRACELOG(LOG_WARNING, "TEXTURE: Texture atlas sprite index not valid: %i", index);
+
+    return sprite;
+}
+
+// Draw a sprite
+void DrawSprite(Sprite sprite, Vector2 position, Color tint)
+{
+    DrawTextureRec(sprite.texture, sprite.source, position, tint);
+}
+
+// Draw a sprite with 'pro' parameters
+// NOTE: origin is relative to destination rectangle size
+void DrawSpritePro(Sprite sprite, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    DrawTexturePro(sprite.texture, sprite.source, dest, origin, rotation, tint);
+}
+
 // Get color with alpha applied, alpha goes from 0.0f to 1.0f
 Color Fade(Color color, float alpha)
 {
@@ -4967,4 +5106,122 @@ static Vector4 *LoadImageDataNormalized(Image image)
     return pixels;
 }
 
+// Find skyline position for rectangle in atlas (bottom-left heuristic)
+// NOTE: Skyline nodes are stored as (x, y, width) triplets, covering the full atlas width
+static bool PackTextureAtlasRec(TextureAtlas *atlas, int width, int height, int *posX, int *posY)
+{
+    int *nodes = atlas->nodes;
+    int bestIndex = -1;
+    int bestBottom = atlas->image.height + 1;
+    int bestWidth = atlas->image.width + 1;
+
+    for (int i = 0; i < atlas->nodeCount; i++)
+    {
+        int x = nodes[3*i];
+        if ((x + width) > atlas->image.width) break;
+
+        // Rectangle rests on the highest node it spans
+        int y = 0;
+        for (int j = i, spanned = 0; (j < atlas->nodeCount) && (spanned < width); j++)
+        {
+            if (nodes[3*j + 1] > y) y = nodes[3*j + 1];
+            spanned += nodes[3*j + 2];
+        }
+
+        if ((y + height) > atlas->image.height) continue;
+
+        if (((y + height) < bestBottom) || (((y + height) == bestBottom) && (nodes[3*i + 2] < bestWidth)))
+        {
+            bestIndex = i;
+            bestBottom = y + height;
+            bestWidth = nodes[3*i + 2];
+            *posX = x;
+            *posY = y;
+        }
+    }
+
+    if (bestIndex == -1) return false;
+
+    // Insert new node on top of the packed rectangle
+    memmove(nodes + 3*(bestIndex + 1), nodes + 3*bestIndex, (atlas->nodeCount - bestIndex)*3*sizeof(int));
+    nodes[3*bestIndex] = *posX;
+    nodes[3*bestIndex + 1] = bestBottom;
+    nodes[3*bestIndex + 2] = width;
+    atlas->nodeCount++;
+
+    // Shrink or remove the following nodes covered by the new one
+    for (int i = bestIndex + 1; i < atlas->nodeCount;)
+    {
+        int prevEnd = nodes[3*(i - 1)] + nodes[3*(i - 1) + 2];
+
+        if (nodes[3*i] >= prevEnd) break;
+
+        int shrink = prevEnd - nodes[3*i];
+        nodes[3*i] += shrink;
+        nodes[3*i + 2] -= shrink;
+
+        if (nodes[3*i + 2] > 0) break;
+
+        memmove(nodes + 3*i, nodes + 3*(i + 1), (atlas->nodeCount - i - 1)*3*sizeof(int));
+        atlas->nodeCount--;
+    }
+
+    // Merge neighbour nodes at the same height
+    for (int i = 0; i < (atlas->nodeCount - 1);)
+    {
+        if (nodes[3*i + 1] == nodes[3*(i + 1) + 1])
+        {
+            nodes[3*i + 2] += nodes[3*(i + 1) + 2];
+            memmove(nodes + 3*(i + 1), nodes + 3*(i + 2), (atlas->nodeCount - i - 2)*3*sizeof(int));
+            atlas->nodeCount--;
+        }
+        else i++;
+    }
+
+    return true;
+}
+
+// Grow texture atlas size, already packed sprites keep their position
+// NOTE: Smaller dimension is doubled first, atlas texture is reloaded
+static bool GrowTextureAtlas(TextureAtlas *atlas)
+{
+    int newWidth = atlas->image.width;
+    int newHeight = atlas->image.height;
+
+    if (((newWidth <= newHeight) && ((newWidth*2) <= TEXTURE_ATLAS_MAX_SIZE)) || ((newHeight*2) > TEXTURE_ATLAS_MAX_SIZE)) newWidth *= 2;
+    else newHeight *= 2;
+
+    if ((newWidth > TEXTURE_ATLAS_MAX_SIZE) || (newHeight > TEXTURE_ATLAS_MAX_SIZE)) return false;
+
+    if (newWidth != atlas->image.width)
+    {
+        int *nodes = (int *)RL_REALLOC(atlas->nodes, (newWidth + 1)*3*sizeof(int));
+        if (nodes == NULL) return false;
+
+        atlas->nodes = nodes;
+
+        // Extend skyline with the new empty area
+        int last = atlas->nodeCount - 1;
+        if (nodes[3*last + 1] == 0) nodes[3*last + 2] += (newWidth - atlas->image.width);
+        else
+        {
+            nodes[3*atlas->nodeCount] = atlas->image.width;
+            nodes[3*atlas->nodeCount + 1] = 0;
+            nodes[3*atlas->nodeCount + 2] = newWidth - atlas->image.width;
+            atlas->nodeCount++;
+        }
+    }
+
+    ImageResizeCanvas(&atlas->image, newWidth, newHeight, 0, 0, BLANK);
+
+    // Pending batched draws could still reference previous atlas texture
+    rlDrawRenderBatchActive();
+    UnloadTexture(atlas->texture);
+    atlas->texture = LoadTextureFromImage(atlas->image);
+
+    TRACELOG(LOG_INFO, "TEXTURE: Texture atlas grown to %ix%i", newWidth, newHeight);
+
+    return true;
+}
+
 #endif      // SUPPORT_MODULE_RTEXTURES
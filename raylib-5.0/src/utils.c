@@ -7,6 +7,11 @@
 *           Show TraceLog() output messages
 *           NOTE: By default LOG_DEBUG traces not shown
 *
+*       #define SUPPORT_WORKER_THREADS
+*           Run heavy work on multiple threads with RunWorkers() or in background with QueueWorkerTask(), requires pthreads
+*           NOTE: Work runs on a pool of persistent worker threads, released with CloseWorkerPool(),
+*           on Windows and Web platforms work is always run on the calling thread
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -49,12 +54,61 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+#if defined(SUPPORT_WORKER_THREADS) && !defined(_WIN32) && !defined(PLATFORM_WEB)
+    #define WORKER_THREADS_AVAILABLE
+    #include <pthread.h>                // Required for: pthread_create(), pthread_join(), pthread_mutex_lock(), pthread_cond_wait()
+    #include <unistd.h>                 // Required for: sysconf()
+#endif
+
+#if defined(SUPPORT_FILE_MAPPING) && defined(SUPPORT_STANDARD_FILEIO) && !defined(_WIN32) && !defined(PLATFORM_WEB) && !defined(PLATFORM_ANDROID)
+    #define FILE_MAPPING_AVAILABLE
+    #include <sys/mman.h>               // Required for: mmap(), munmap()
+    #include <sys/stat.h>               // Required for: fstat()
+    #include <fcntl.h>                  // Required for: open()
+    #include <unistd.h>                 // Required for: close()
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
 #ifndef MAX_TRACELOG_MSG_LENGTH
     #define MAX_TRACELOG_MSG_LENGTH     256         // Max length of one trace-log message
 #endif
+#ifndef MAX_WORKER_THREADS
+    #define MAX_WORKER_THREADS            8         // Maximum number of worker threads in worker pool
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+#if defined(WORKER_THREADS_AVAILABLE)
+// Worker pool job, work parts are claimed by index by pool threads and calling thread
+typedef struct WorkerJob {
+    void (*work)(void *data, int worker, int workerCount);
+    void *data;
+    int workerCount;                // Number of work parts
+    int nextWorker;                 // Next work part to be claimed
+    int pendingCount;               // Work parts claimed by pool threads and not finished yet
+} WorkerJob;
+
+// Worker pool task, queued to run in background
+typedef struct WorkerTask {
+    void (*work)(void *data);
+    void *data;
+    struct WorkerTask *next;
+} WorkerTask;
+
+// Worker pool, threads are created on demand and reused until CloseWorkerPool()
+typedef struct WorkerPool {
+    pthread_t threads[MAX_WORKER_THREADS];
+    int threadCount;                // Number of pool threads created
+    int idleCount;                  // Number of pool threads waiting for work
+    bool closing;                   // Pool threads must exit once queued work is done
+    WorkerJob *job;                 // Current RunWorkers() job, only one shared at a time
+    WorkerTask *firstTask;          // Queued background tasks (first to run)
+    WorkerTask *lastTask;           // Queued background tasks (last queued)
+} WorkerPool;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -67,6 +121,14 @@ static SaveFileDataCallback saveFileData = NULL;    // SaveFileText callback fun
 static LoadFileTextCallback loadFileText = NULL;    // LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback function pointer
 
+#if defined(WORKER_THREADS_AVAILABLE)
+static pthread_mutex_t workerDataMutex = PTHREAD_MUTEX_INITIALIZER;     // Mutex for data shared with background workers
+static pthread_mutex_t workerPoolMutex = PTHREAD_MUTEX_INITIALIZER;     // Mutex for worker pool state
+static pthread_cond_t workerPoolQueued = PTHREAD_COND_INITIALIZER;      // Signaled when work is queued or pool is closing
+static pthread_cond_t workerPoolDone = PTHREAD_COND_INITIALIZER;        // Signaled when a job work part is finished
+static WorkerPool workerPool = { 0 };                                   // Worker pool state
+#endif
+
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
 //----------------------------------------------------------------------------------
@@ -95,6 +157,11 @@ static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
 #endif
 
+#if defined(WORKER_THREADS_AVAILABLE)
+static void *WorkerThreadMain(void *arg);           // Worker pool thread entry point
+static void AddWorkerThreads(int count);            // Create pool threads until count of them are idle
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utilities
 //----------------------------------------------------------------------------------
@@ -179,6 +246,142 @@ void MemFree(void *ptr)
     RL_FREE(ptr);
 }
 
+// Get number of workers available to RunWorkers()
+// NOTE: Returns 1 if worker threads are not supported
+int GetWorkerCount(void)
+{
+    int count = 1;
+
+#if defined(WORKER_THREADS_AVAILABLE) && defined(_SC_NPROCESSORS_ONLN)
+    count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (count < 1) count = 1;
+    else if (count > MAX_WORKER_THREADS) count = MAX_WORKER_THREADS;
+#endif
+
+    return count;
+}
+
+// Run work on multiple threads and wait for all of them
+// NOTE: Calling thread runs worker 0 and any work part not claimed by a pool thread,
+// work is split by the callback using worker index and count
+void RunWorkers(void (*work)(void *data, int worker, int workerCount), void *data, int workerCount)
+{
+    if (workerCount > MAX_WORKER_THREADS) workerCount = MAX_WORKER_THREADS;
+    if (workerCount < 1) workerCount = 1;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    WorkerJob job = { work, data, workerCount, 1, 0 };
+    bool shared = false;
+
+    pthread_mutex_lock(&workerPoolMutex);
+    if ((workerCount > 1) && (workerPool.job == NULL) && !workerPool.closing)
+    {
+        // NOTE: If another job is running (RunWorkers() called from several threads),
+        // this one is run entirely on the calling thread
+        AddWorkerThreads(workerCount - 1);
+        workerPool.job = &job;
+        pthread_cond_broadcast(&workerPoolQueued);
+        shared = true;
+    }
+    pthread_mutex_unlock(&workerPoolMutex);
+
+    if (shared)
+    {
+        work(data, 0, workerCount);
+
+        // Run work parts not claimed yet and wait for the claimed ones
+        pthread_mutex_lock(&workerPoolMutex);
+        while (job.nextWorker < job.workerCount)
+        {
+            int worker = job.nextWorker++;
+            pthread_mutex_unlock(&workerPoolMutex);
+            work(data, worker, workerCount);
+            pthread_mutex_lock(&workerPoolMutex);
+        }
+        while (job.pendingCount > 0) pthread_cond_wait(&workerPoolDone, &workerPoolMutex);
+        workerPool.job = NULL;
+        pthread_mutex_unlock(&workerPoolMutex);
+    }
+    else
+#endif
+    {
+        for (int i = 0; i < workerCount; i++) work(data, i, workerCount);
+    }
+}
+
+// Queue work to run in background on a worker pool thread (not waited)
+// NOTE: Returns false if threads are not supported or no pool thread is available,
+// in that case work is not run and caller is responsible of running it
+bool QueueWorkerTask(void (*work)(void *data), void *data)
+{
+    bool queued = false;
+
+#if defined(WORKER_THREADS_AVAILABLE)
+    pthread_mutex_lock(&workerPoolMutex);
+    if (!workerPool.closing)
+    {
+        AddWorkerThreads(1);
+
+        if (workerPool.threadCount > 0)
+        {
+            WorkerTask *task = (WorkerTask *)RL_MALLOC(sizeof(WorkerTask));
+            task->work = work;
+            task->data = data;
+            task->next = NULL;
+
+            if (workerPool.lastTask != NULL) workerPool.lastTask->next = task;
+            else workerPool.firstTask = task;
+            workerPool.lastTask = task;
+
+            pthread_cond_broadcast(&workerPoolQueued);
+            queued = true;
+        }
+    }
+    pthread_mutex_unlock(&workerPoolMutex);
+#endif
+
+    return queued;
+}
+
+// Close worker pool, queued tasks are finished and all pool threads joined
+// NOTE: Pool threads are created again on demand by next RunWorkers()/QueueWorkerTask() calls
+void CloseWorkerPool(void)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    pthread_mutex_lock(&workerPoolMutex);
+    workerPool.closing = true;
+    pthread_cond_broadcast(&workerPoolQueued);
+    int threadCount = workerPool.threadCount;
+    pthread_mutex_unlock(&workerPoolMutex);
+
+    for (int i = 0; i < threadCount; i++) pthread_join(workerPool.threads[i], NULL);
+
+    pthread_mutex_lock(&workerPoolMutex);
+    workerPool.threadCount = 0;
+    workerPool.idleCount = 0;
+    workerPool.closing = false;
+    pthread_mutex_unlock(&workerPoolMutex);
+
+    if (threadCount > 0) TRACELOG(LOG_DEBUG, "SYSTEM: Worker pool closed (%i threads)", threadCount);
+#endif
+}
+
+// Lock data shared with background workers
+void LockWorkerData(void)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    pthread_mutex_lock(&workerDataMutex);
+#endif
+}
+
+// Unlock data shared with background workers
+void UnlockWorkerData(void)
+{
+#if defined(WORKER_THREADS_AVAILABLE)
+    pthread_mutex_unlock(&workerDataMutex);
+#endif
+}
+
 // Load data from file into a buffer
 unsigned char *LoadFileData(const char *fileName, int *dataSize)
 {
@@ -251,6 +454,61 @@ void UnloadFileData(unsigned char *data)
     RL_FREE(data);
 }
 
+// Load file data mapped into memory (read-only)
+// NOTE: Custom file data loader is not used for mapped files, if mapping is not supported,
+// data is loaded with LoadFileData(), in any case data must be unloaded with UnloadFileMapped()
+const unsigned char *LoadFileMapped(const char *fileName, int *dataSize)
+{
+    const unsigned char *data = NULL;
+    *dataSize = 0;
+
+#if defined(FILE_MAPPING_AVAILABLE)
+    if (fileName != NULL)
+    {
+        int file = open(fileName, O_RDONLY);
+
+        if (file >= 0)
+        {
+            struct stat fileStat = { 0 };
+
+            // NOTE: dataSize is unified along raylib as a 'int' type, bigger files are not mapped
+            if ((fstat(file, &fileStat) == 0) && (fileStat.st_size > 0) && (fileStat.st_size <= 2147483647))
+            {
+                void *map = mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+                if (map != MAP_FAILED)
+                {
+                    data = (const unsigned char *)map;
+                    *dataSize = (int)fileStat.st_size;
+
+                    TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully", fileName);
+                }
+                else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to map file", fileName);
+            }
+            else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read file", fileName);
+
+            close(file);    // NOTE: Mapping is kept after closing the file descriptor
+        }
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
+#else
+    data = LoadFileData(fileName, dataSize);
+#endif
+
+    return data;
+}
+
+// Unload file data loaded with LoadFileMapped()
+void UnloadFileMapped(const unsigned char *data, int dataSize)
+{
+#if defined(FILE_MAPPING_AVAILABLE)
+    if (data != NULL) munmap((void *)data, (size_t)dataSize);
+#else
+    UnloadFileData((unsigned char *)data);
+#endif
+}
+
 // Save data to file from buffer
 bool SaveFileData(const char *fileName, void *data, int dataSize)
 {
@@ -479,6 +737,68 @@ FILE *android_fopen(const char *fileName, const char *mode)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+#if defined(WORKER_THREADS_AVAILABLE)
+// Worker pool thread entry point
+// NOTE: Job work parts are run first, then queued tasks, thread exits when pool is closing and no work is left
+static void *WorkerThreadMain(void *arg)
+{
+    pthread_mutex_lock(&workerPoolMutex);
+
+    while (true)
+    {
+        WorkerJob *job = workerPool.job;
+
+        if ((job != NULL) && (job->nextWorker < job->workerCount))
+        {
+            int worker = job->nextWorker++;
+            job->pendingCount++;
+            workerPool.idleCount--;
+            pthread_mutex_unlock(&workerPoolMutex);
+
+            job->work(job->data, worker, job->workerCount);
+
+            pthread_mutex_lock(&workerPoolMutex);
+            workerPool.idleCount++;
+            job->pendingCount--;
+            if (job->pendingCount == 0) pthread_cond_broadcast(&workerPoolDone);
+        }
+        else if (workerPool.firstTask != NULL)
+        {
+            WorkerTask *task = workerPool.firstTask;
+            workerPool.firstTask = task->next;
+            if (workerPool.firstTask == NULL) workerPool.lastTask = NULL;
+            workerPool.idleCount--;
+            pthread_mutex_unlock(&workerPoolMutex);
+
+            task->work(task->data);
+            RL_FREE(task);
+
+            pthread_mutex_lock(&workerPoolMutex);
+            workerPool.idleCount++;
+        }
+        else if (workerPool.closing) break;
+        else pthread_cond_wait(&workerPoolQueued, &workerPoolMutex);
+    }
+
+    pthread_mutex_unlock(&workerPoolMutex);
+
+    return NULL;
+}
+
+// Create pool threads until count of them are idle (or pool is full)
+// NOTE: Requires workerPoolMutex locked, new threads are idle until they claim work
+static void AddWorkerThreads(int count)
+{
+    while ((workerPool.idleCount < count) && (workerPool.threadCount < MAX_WORKER_THREADS))
+    {
+        if (pthread_create(&workerPool.threads[workerPool.threadCount], NULL, WorkerThreadMain, NULL) != 0) break;
+
+        workerPool.threadCount++;
+        workerPool.idleCount++;
+    }
+}
+#endif
+
 #if defined(PLATFORM_ANDROID)
 static int android_read(void *cookie, char *data, int dataSize)
 {
@@ -74,6 +74,16 @@ void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initia
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!
 #endif
 
+int GetWorkerCount(void);                                              // Get number of workers available to RunWorkers() (1 if threads not supported)
+void RunWorkers(void (*work)(void *data, int worker, int workerCount), void *data, int workerCount); // Run work on multiple threads and wait for all of them
+bool QueueWorkerTask(void (*work)(void *data), void *data);            // Queue work to run in background on a worker pool thread, returns false if not queued
+void CloseWorkerPool(void);                                            // Close worker pool, finishes queued tasks and joins all pool threads
+void LockWorkerData(void);                                             // Lock data shared with background workers
+void UnlockWorkerData(void);                                           // Unlock data shared with background workers
+
+const unsigned char *LoadFileMapped(const char *fileName, int *dataSize);   // Load file data mapped into memory (read-only), LoadFileData() if not supported
+void UnloadFileMapped(const unsigned char *data, int dataSize);            // Unload file data loaded with LoadFileMapped()
+
 #if defined(__cplusplus)
 }
 #endif